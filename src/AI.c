@@ -1,14 +1,28 @@
-#include "Analysis.h"
+#define _POSIX_C_SOURCE 200112L
+#include "AI.h"
 #include <assert.h>
+#include <time.h>
 
 #define MAX_TURNS 150
+#define MAX_TARGETS  12     /* frontier squares considered by the planner */
 
-static int dist[HEIGHT][WIDTH];
+/* Returns the number of unknown squares next to (r,c) that are not known to
+   be walled off: */
+static int frontier_value(const MazeMap *mm, int r, int c)
+{
+    int dir, v = 0;
+    for (dir = 0; dir < 4; ++dir)
+    {
+        if (SQUARE(mm, RDR(r, dir), CDC(c, dir)) == UNKNOWN &&
+            WALL(mm, r, c, dir) != PRESENT) ++v;
+    }
+    return v;
+}
 
-static Point explore(MazeMap *mm)
+static Point explore(MazeMap *mm, int dist[HEIGHT][WIDTH])
 {
     Point res;
-    int r, c, dir;
+    int r, c;
     int best_v = 0, best_dist = 0;
     for (r = 0; r < HEIGHT; ++r)
     {
@@ -16,12 +30,7 @@ static Point explore(MazeMap *mm)
         {
             if (dist[r][c] != -1)
             {
-                int v = 0;
-                for (dir = 0; dir < 4; ++dir)
-                {
-                    if (SQUARE(mm, RDR(r, dir), CDC(c, dir)) == UNKNOWN &&
-                        WALL(mm, r, c, dir) != PRESENT) ++v;
-                }
+                int v = frontier_value(mm, r, c);
                 if (v > best_v || (v == best_v && dist[r][c] < best_dist))
                 {
                     best_v = v;
@@ -36,7 +45,8 @@ static Point explore(MazeMap *mm)
     return res;
 }
 
-static Point squash(MazeMap *mm, int distsq)
+static Point squash( MazeMap *mm, int dist[HEIGHT][WIDTH], int distsq,
+                     const Belief *belief )
 {
     Point res;
     int r, c, best_dist = -1;
@@ -56,6 +66,7 @@ static Point squash(MazeMap *mm, int distsq)
             {
                 int r = (mm->loc.r + dr + HEIGHT)%HEIGHT,
                     c = (mm->loc.c + dc + WIDTH)%WIDTH;
+                if (!bt_possible(belief, mm, r, c)) continue;
                 if (best_dist == -1 || dist[r][c] < best_dist)
                 {
                     best_dist = dist[r][c];
@@ -69,20 +80,233 @@ static Point squash(MazeMap *mm, int distsq)
     return res;
 }
 
+/* Anytime multi-target exploration.
+
+   Squares are only discovered by looking around at the start of a turn (the
+   squares next to open walls are always known already), so a turn should end
+   where the most can be seen. explore() greedily picks the nearest of the
+   squares with the most unknown neighbours; the planner instead orders the
+   MAX_TARGETS best frontier squares into a tour starting at the player's
+   location that visits all of them in as few moves as possible, and walks to
+   the first square of that tour (the rest of the tour will be replanned with
+   the new information next turn).
+
+   The tour is built by cheapest insertion (in the order explore() ranks the
+   squares) and then shortened with 2-opt moves until none is left or the
+   context's plan_time has elapsed. The tour is valid at every step, so when
+   time runs out the best one found is used.
+
+   All distances are looked up in the context's MazeDistance table. */
+
+typedef struct Planner
+{
+    long    start, budget;              /* in microseconds */
+    int     num_targets;
+    Point   target[MAX_TARGETS + 1];    /* target[0] is the start */
+    int     dist[MAX_TARGETS + 1][MAX_TARGETS + 1];
+    int     tour[MAX_TARGETS], tour_len;
+} Planner;
+
+/* Returns the current value of a monotonic clock in microseconds. (Time
+   limits are enforced in wall-clock time, which processor time may lag.) */
+static long now_us()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return 1000000L*ts.tv_sec + ts.tv_nsec/1000;
+}
+
+static bool out_of_time(const Planner *pl)
+{
+    return now_us() - pl->start >= pl->budget;
+}
+
+/* Selects the best frontier squares (ranked as in explore()) and computes
+   the distances between them. */
+static void find_targets( Planner *pl, const MazeMap *mm,
+                          int dist[HEIGHT][WIDTH], const MazeDistance *md )
+{
+    int value[MAX_TARGETS + 1], r, c, v, i, j, n = 0;
+
+    pl->target[0] = mm->loc;
+    for (r = 0; r < HEIGHT; ++r)
+    {
+        for (c = 0; c < WIDTH; ++c)
+        {
+            if (dist[r][c] <= 0 || (v = frontier_value(mm, r, c)) == 0)
+                continue;
+            for (i = n; i > 0; --i)
+            {
+                const Point *t = &pl->target[i];
+                if (v < value[i] ||
+                    (v == value[i] && dist[r][c] >= dist[t->r][t->c])) break;
+                if (i < MAX_TARGETS)
+                {
+                    value[i + 1] = value[i];
+                    pl->target[i + 1] = pl->target[i];
+                }
+            }
+            if (i < MAX_TARGETS)
+            {
+                value[i + 1] = v;
+                pl->target[i + 1].r = r;
+                pl->target[i + 1].c = c;
+                if (n < MAX_TARGETS) ++n;
+            }
+        }
+    }
+    pl->num_targets = n;
+
+    for (i = 0; i <= n; ++i)
+    {
+        for (j = 0; j <= n; ++j)
+        {
+            pl->dist[i][j] = md_distance( md, pl->target[i].r,
+                                          pl->target[i].c, pl->target[j].r,
+                                          pl->target[j].c );
+        }
+    }
+}
+
+/* Builds the initial tour by cheapest insertion. */
+static void insert_targets(Planner *pl)
+{
+    int t, i, pos, best_pos, delta, best_delta, prev;
+
+    pl->tour[0]  = 1;
+    pl->tour_len = 1;
+    for (t = 2; t <= pl->num_targets; ++t)
+    {
+        best_pos = -1;
+        best_delta = 0;
+        for (pos = 0; pos <= pl->tour_len; ++pos)
+        {
+            prev  = (pos == 0) ? 0 : pl->tour[pos - 1];
+            delta = pl->dist[prev][t];
+            if (pos < pl->tour_len)
+            {
+                delta += pl->dist[t][pl->tour[pos]] -
+                         pl->dist[prev][pl->tour[pos]];
+            }
+            if (best_pos == -1 || delta < best_delta)
+            {
+                best_pos   = pos;
+                best_delta = delta;
+            }
+        }
+        for (i = pl->tour_len; i > best_pos; --i) pl->tour[i] = pl->tour[i - 1];
+        pl->tour[best_pos] = t;
+        ++pl->tour_len;
+        if (out_of_time(pl)) break;
+    }
+}
+
+/* Shortens the tour by reversing parts of it (2-opt) until no reversal helps
+   or time runs out. */
+static void improve_tour(Planner *pl)
+{
+    bool improved = true;
+    int i, j, a, b, delta, tmp;
+
+    while (improved && !out_of_time(pl))
+    {
+        improved = false;
+        for (i = 0; i < pl->tour_len - 1; ++i)
+        {
+            for (j = i + 1; j < pl->tour_len; ++j)
+            {
+                a = (i == 0) ? 0 : pl->tour[i - 1];
+                delta = pl->dist[a][pl->tour[j]] - pl->dist[a][pl->tour[i]];
+                if (j + 1 < pl->tour_len)
+                {
+                    b = pl->tour[j + 1];
+                    delta += pl->dist[pl->tour[i]][b] -
+                             pl->dist[pl->tour[j]][b];
+                }
+                if (delta >= 0) continue;
+                for (a = i, b = j; a < b; ++a, --b)
+                {
+                    tmp = pl->tour[a];
+                    pl->tour[a] = pl->tour[b];
+                    pl->tour[b] = tmp;
+                }
+                improved = true;
+            }
+            if (out_of_time(pl)) break;
+        }
+    }
+}
+
+/* Returns the first square of the planned tour, or `dst' (explore()'s
+   choice) if there are too few targets to plan for. */
+static Point plan_tour( const MazeMap *mm, AIContext *ctx, Point dst,
+                        long start )
+{
+    Planner pl;
+
+    pl.start  = start;
+    pl.budget = 1000*ctx->plan_time;
+    find_targets(&pl, mm, ctx->dist, ctx->md);
+    if (pl.num_targets < 2) return dst;
+    insert_targets(&pl);
+    improve_tour(&pl);
+    return pl.target[pl.tour[0]];
+}
+
 const char *pick_move(MazeMap *mm, int distsq)
 {
+    static MazeDistance md;
+    static AIContext ctx;
+    if (ctx.md == NULL)
+    {
+        ctx.md = &md;
+        bt_reset(&ctx.belief, BT_MAX_MOVES);
+    }
+    return pick_move_r(mm, distsq, &ctx);
+}
+
+const char *pick_move_r(MazeMap *mm, int distsq, AIContext *ctx)
+{
+    const long start = now_us();
+    const char *turn;
     Point dst;
+    int len;
+
+    /* Keep track of changes, even if the turn is taken from the book */
+    if (ctx->md != NULL) md_update(ctx->md, mm);
+    bt_observe(&ctx->belief, mm, distsq);
+    if (ctx->book != NULL && (turn = book_lookup(ctx->book, mm->hash)) != NULL)
+        return turn;
 
-    find_distance(mm, dist, mm->loc.r, mm->loc.c);
+    if (ctx->md != NULL)
+        md_find_distance(ctx->md, ctx->dist, mm->loc.r, mm->loc.c);
+    else
+        find_distance(mm, ctx->dist, mm->loc.r, mm->loc.c);
 
     if (mm_count_squares(mm) < WIDTH*HEIGHT)
-        dst = explore(mm);
+    {
+        if (ctx->cache == NULL || !mc_find_move(ctx->cache, mm, &dst))
+        {
+            dst = explore(mm, ctx->dist);
+            if (ctx->md != NULL && ctx->plan_time > 0)
+                dst = plan_tour(mm, ctx, dst, start);
+            if (ctx->cache != NULL) mc_store_move(ctx->cache, mm, dst);
+        }
+    }
     else /* mm_count_squares(mm) == WIDTH*HEIGHT */
-        dst = squash(mm, distsq);
+    if (distsq > 0 && ctx->md != NULL && ctx->pursuit != NULL &&
+        ctx->belief.valid)
+    {
+        dst = ps_search(ctx->pursuit, mm, ctx->md, &ctx->belief);
+    }
+    else
+    {
+        dst = squash(mm, ctx->dist, distsq, &ctx->belief);
+    }
 
     if (dst.r == mm->loc.r && dst.c == mm->loc.c)
         return "T";
 
-    return construct_turn(mm, dist, mm->loc.r, mm->loc.c, mm->dir, dst.r, dst.c,
-                          NULL, NULL);
+    return construct_turn_r( mm, ctx->dist, mm->loc.r, mm->loc.c, mm->dir,
+                             dst.r, dst.c, ctx->path, ctx->turn, &len );
 }
@@ -0,0 +1,53 @@
+#ifndef AI_H_INCLUDED
+#define AI_H_INCLUDED
+
+#include "Analysis.h"
+#include "MazeCache.h"
+#include "Belief.h"
+#include "MazeDist.h"
+#include "OpeningBook.h"
+#include "Pursuit.h"
+
+/* Scratch space used by pick_move_r(). One context per concurrently running
+   player suffices; pick_move() uses a static one.
+
+   If `md' is not NULL, distances are taken from it (after updating it with
+   md_update()) instead of being searched for on every call. This requires the
+   map to have a journal that is reset only after pick_move_r() returns (see
+   MazeDist.h); otherwise, all distances are recomputed on every call.
+
+   If `plan_time' is positive (and `md' is set), an anytime planner orders
+   several frontier squares into a tour, refining the order until
+   `plan_time' milliseconds (of wall-clock time) have passed; a turn that
+   explores the maze walks only to the first square of the tour, and the
+   tour is planned again on the next turn. Otherwise, each turn goes to the
+   single most promising square.
+
+   `belief' tracks where the opponent may be; it must be initialized with
+   bt_reset() before the first call. Once the map is complete, only squares it
+   considers possible are chased: if `pursuit' is not NULL (and `md' is set),
+   by the pursuit search of Pursuit.h; otherwise, by going to the nearest.
+
+   If `cache' is not NULL, squares explored towards are memoized in it (see
+   MazeCache.h). If `book' is not NULL, turns found in it are played without
+   searching (though `md' and `belief' are still updated). */
+typedef struct AIContext
+{
+    MazeDistance    *md;
+    long            plan_time;
+    Belief          belief;
+    Pursuit         *pursuit;
+    MazeCache       *cache;
+    const OpeningBook *book;
+    int             dist[HEIGHT][WIDTH];
+    Point           path[HEIGHT*WIDTH];
+    char            turn[HEIGHT*WIDTH];
+} AIContext;
+
+/* Returns the next turn to perform on the given map, where `distsq' is the
+   squared distance to the opponent (or -1 in a one-player game). The result
+   remains valid until the next call with the same context. */
+extern const char *pick_move(MazeMap *mm, int distsq);
+extern const char *pick_move_r(MazeMap *mm, int distsq, AIContext *ctx);
+
+#endif /* ndef AI_H_INCLUDED */
@@ -41,7 +41,16 @@ const char *construct_turn(const MazeMap *mm, int dist[HEIGHT][WIDTH],
     static char turn_buf[HEIGHT*WIDTH];
     static Point path_buf[HEIGHT*WIDTH];
 
-    Point *loc = (path_out == NULL) ? path_buf : path_out;
+    return construct_turn_r( mm, dist, r1, c1, dir1, r2, c2,
+                             (path_out == NULL) ? path_buf : path_out,
+                             turn_buf, len_out );
+}
+
+char *construct_turn_r(const MazeMap *mm, int dist[HEIGHT][WIDTH],
+                       int r1, int c1, int dir1, int r2, int c2,
+                       Point loc[HEIGHT*WIDTH], char turn_buf[HEIGHT*WIDTH],
+                       int *len_out)
+{
     int pos, len, dir;
 
     /* Find path (r1,c1)==pos[0], pos[1], pos[2], .., pos[len]==(r2,c2) */
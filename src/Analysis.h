@@ -10,4 +10,11 @@ extern const char *construct_turn( const MazeMap *mm, int dist[HEIGHT][WIDTH],
                                    int r1, int c1, int dir1, int r2, int c2,
                                    Point path[HEIGHT*WIDTH], int *len);
 
+/* Like construct_turn(), but writes the path and turn to the given buffers
+   (neither of which may be NULL) instead of static ones. */
+extern char *construct_turn_r( const MazeMap *mm, int dist[HEIGHT][WIDTH],
+                               int r1, int c1, int dir1, int r2, int c2,
+                               Point path[HEIGHT*WIDTH],
+                               char turn[HEIGHT*WIDTH], int *len );
+
 #endif /* ndef ANALYSIS_H_INCLUDED */
@@ -0,0 +1,90 @@
+#define _POSIX_C_SOURCE 200112L
+#include "AsyncLog.h"
+#include <errno.h>
+#include <stdlib.h>
+
+static void wait_for(sem_t *sem)
+{
+    while (sem_wait(sem) != 0 && errno == EINTR) { }
+}
+
+static void *writer(void *arg)
+{
+    AsyncLog *al = arg;
+
+    for (;;)
+    {
+        if (sem_trywait(&al->filled) != 0)
+        {
+            /* Caught up; flush before blocking */
+            if (al->idle != NULL) al->idle(al->arg);
+            wait_for(&al->filled);
+        }
+        if (al->stop[al->tail]) break;
+        al->write(al->arg, al->slots + al->record_size*al->tail);
+        al->tail = (al->tail + 1)%al->capacity;
+        sem_post(&al->free);
+    }
+    if (al->idle != NULL) al->idle(al->arg);
+    return NULL;
+}
+
+bool al_start( AsyncLog *al, size_t record_size, int capacity,
+               AsyncLogWrite *write, AsyncLogIdle *idle, void *arg )
+{
+    al->slots       = malloc(record_size*capacity);
+    al->stop        = calloc(capacity, 1);
+    al->record_size = record_size;
+    al->capacity    = capacity;
+    al->head        = al->tail = 0;
+    al->write       = write;
+    al->idle        = idle;
+    al->arg         = arg;
+    if (al->slots == NULL || al->stop == NULL) goto failed;
+    if (sem_init(&al->filled, 0, 0) != 0) goto failed;
+    if (sem_init(&al->free, 0, capacity) != 0)
+    {
+        sem_destroy(&al->filled);
+        goto failed;
+    }
+    if (pthread_create(&al->thread, NULL, writer, al) != 0)
+    {
+        sem_destroy(&al->filled);
+        sem_destroy(&al->free);
+        goto failed;
+    }
+    return true;
+
+failed:
+    free(al->slots);
+    free(al->stop);
+    al->slots = NULL;
+    al->stop  = NULL;
+    return false;
+}
+
+void *al_reserve(AsyncLog *al)
+{
+    wait_for(&al->free);
+    return al->slots + al->record_size*al->head;
+}
+
+void al_commit(AsyncLog *al)
+{
+    al->head = (al->head + 1)%al->capacity;
+    sem_post(&al->filled);
+}
+
+void al_stop(AsyncLog *al)
+{
+    wait_for(&al->free);
+    al->stop[al->head] = 1;
+    sem_post(&al->filled);
+    pthread_join(al->thread, NULL);
+    sem_destroy(&al->filled);
+    sem_destroy(&al->free);
+    free(al->slots);
+    free(al->stop);
+    al->slots = NULL;
+    al->stop  = NULL;
+}
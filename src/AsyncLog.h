@@ -0,0 +1,48 @@
+#ifndef ASYNC_LOG_H_INCLUDED
+#define ASYNC_LOG_H_INCLUDED
+
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Asynchronous logging.
+
+   An AsyncLog passes fixed-size records from one producer thread to a
+   background writer thread, through a ring buffer of `capacity' slots. The
+   producer fills the slot returned by al_reserve() and publishes it with
+   al_commit(); the writer calls write() for every record, in order, and
+   idle() (if not NULL) whenever it has caught up, which is the time to flush
+   output streams.
+
+   Only the producer touches `head' and only the writer touches `tail'; the
+   two semaphores count filled and free slots, so neither side takes a lock
+   and the producer only waits if the writer falls a full ring behind.
+
+   al_stop() waits for all records to be written and stops the writer. */
+
+typedef void AsyncLogWrite(void *arg, void *record);
+typedef void AsyncLogIdle(void *arg);
+
+typedef struct AsyncLog
+{
+    unsigned char   *slots;
+    char            *stop;          /* per slot: record is the stop marker */
+    size_t          record_size;
+    int             capacity;
+    int             head, tail;     /* next slot to fill and to write */
+    sem_t           filled, free;
+    pthread_t       thread;
+    AsyncLogWrite   *write;
+    AsyncLogIdle    *idle;
+    void            *arg;
+} AsyncLog;
+
+/* Returns false if memory couldn't be allocated or the thread started. */
+extern bool al_start( AsyncLog *al, size_t record_size, int capacity,
+                      AsyncLogWrite *write, AsyncLogIdle *idle, void *arg );
+extern void *al_reserve(AsyncLog *al);
+extern void al_commit(AsyncLog *al);
+extern void al_stop(AsyncLog *al);
+
+#endif /* ndef ASYNC_LOG_H_INCLUDED */
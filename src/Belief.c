@@ -0,0 +1,135 @@
+#include "Belief.h"
+#include <string.h>
+
+/* Converts map coordinates to maze coordinates: */
+#define MAZE_ROW(mm, r) (((r) - (mm)->border.top + HEIGHT)%HEIGHT)
+#define MAZE_COL(mm, c) (((c) - (mm)->border.left + WIDTH)%WIDTH)
+
+static bool borders_known(const MazeMap *mm)
+{
+    return mm->border.top == mm->border.bottom &&
+           mm->border.left == mm->border.right;
+}
+
+void bt_reset(Belief *bt, int max_moves)
+{
+    int d, dr, dc;
+
+    bt->max_moves   = max_moves;
+    bt->valid       = false;
+    bt->walls_final = false;
+    memset(bt->ring_dc, -1, sizeof(bt->ring_dc));
+    for (dr = 0; dr < HEIGHT; ++dr)
+    {
+        for (dc = 0; dc < WIDTH; ++dc)
+        {
+            d = dr*dr + dc*dc;
+            if (d <= BT_MAX_DISTSQ) bt->ring_dc[d][dr] = (signed char)dc;
+        }
+    }
+}
+
+/* Collects the walls known to be absent, in maze coordinates. Once the map is
+   complete, this needs to be done only once. */
+static void load_walls(Belief *bt, const MazeMap *mm)
+{
+    int r, c;
+
+    if (bt->walls_final) return;
+    for (r = 0; r < HEIGHT; ++r)
+    {
+        const int mr = (r + mm->border.top)%HEIGHT;
+        bt->open_n[r] = bt->open_w[r] = 0;
+        for (c = 0; c < WIDTH; ++c)
+        {
+            const int mc = (c + mm->border.left)%WIDTH;
+            if (mm->grid[mr][mc].wall_n == ABSENT)
+                bt->open_n[r] |= (MazeRow)1 << c;
+            if (mm->grid[mr][mc].wall_w == ABSENT)
+                bt->open_w[r] |= (MazeRow)1 << c;
+        }
+    }
+    bt->walls_final = mm_count_squares(mm) == HEIGHT*WIDTH;
+}
+
+/* Since the outer walls of the maze are present, moves never wrap around. */
+void bt_expand(const Belief *bt, MazeRow set[HEIGHT], int moves)
+{
+    MazeRow next[HEIGHT];
+    int r, n;
+    bool changed = true;
+
+    for (n = 0; n < moves && changed; ++n)
+    {
+        changed = false;
+        for (r = 0; r < HEIGHT; ++r)
+        {
+            next[r] = set[r] |
+                      ((set[r]&bt->open_w[r]) >> 1) |
+                      ((set[r] << 1)&bt->open_w[r]&MB_ROW_MASK);
+            if (r > 0)
+                next[r] |= set[r - 1]&bt->open_n[r];
+            if (r + 1 < HEIGHT)
+                next[r] |= set[r + 1]&bt->open_n[r + 1];
+        }
+        for (r = 0; r < HEIGHT; ++r)
+        {
+            if (next[r] != set[r]) changed = true;
+            set[r] = next[r];
+        }
+    }
+}
+
+void bt_ring(const Belief *bt, int r, int c, int distsq, MazeRow ring[HEIGHT])
+{
+    int nr, dr, dc;
+
+    for (nr = 0; nr < HEIGHT; ++nr)
+    {
+        ring[nr] = 0;
+        dr = (nr > r) ? nr - r : r - nr;
+        if (distsq > BT_MAX_DISTSQ || (dc = bt->ring_dc[distsq][dr]) < 0)
+            continue;
+        if (c + dc < WIDTH) ring[nr] |= (MazeRow)1 << (c + dc);
+        if (c - dc >= 0)    ring[nr] |= (MazeRow)1 << (c - dc);
+    }
+}
+
+void bt_observe(Belief *bt, const MazeMap *mm, int distsq)
+{
+    MazeRow ring[HEIGHT], any = 0;
+    int r;
+
+    if (distsq < 0) return;
+    if (!borders_known(mm))
+    {
+        bt->valid = false;
+        return;
+    }
+
+    load_walls(bt, mm);
+    bt_ring( bt, MAZE_ROW(mm, mm->loc.r), MAZE_COL(mm, mm->loc.c),
+             distsq, ring );
+    if (bt->valid)
+    {
+        bt_expand(bt, bt->pos, bt->max_moves);
+        for (r = 0; r < HEIGHT; ++r) any |= bt->pos[r] &= ring[r];
+    }
+    if (any == 0) memcpy(bt->pos, ring, sizeof(ring));
+    bt->valid = true;
+}
+
+bool bt_possible(const Belief *bt, const MazeMap *mm, int r, int c)
+{
+    return !bt->valid ||
+           ((bt->pos[MAZE_ROW(mm, r)] >> MAZE_COL(mm, c))&1) != 0;
+}
+
+int bt_count(const Belief *bt)
+{
+    int r, n = 0;
+
+    if (!bt->valid) return -1;
+    for (r = 0; r < HEIGHT; ++r) n += mb_popcount(bt->pos[r]);
+    return n;
+}
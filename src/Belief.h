@@ -0,0 +1,63 @@
+#ifndef BELIEF_H_INCLUDED
+#define BELIEF_H_INCLUDED
+
+#include "MazeBits.h"
+
+/* Opponent belief tracker.
+
+   Keeps the set of squares where the opponent could be, as a bit plane (one
+   MazeRow per row) in maze coordinates: row and column numbers relative to
+   the top-left corner of the maze (mm->border.top and mm->border.left), which
+   are the coordinates the arbiter computes squared distances with. These are
+   only meaningful once the borders of the maze are known, so until then the
+   tracker considers every square possible.
+
+   Each observation of the squared distance first expands the set by the moves
+   the opponent could have made since the previous one (at most `max_moves'
+   moves through walls known to be absent; BT_MAX_MOVES is always sound) and
+   then intersects it with the ring of squares at that distance, which is
+   built from a precomputed table of the column offsets at each row offset.
+   If the intersection is empty (because the opponent moved further than
+   assumed, or walls were unknown), the set is reset to the ring. */
+
+#define BT_MAX_MOVES  256   /* longest turn the arbiter accepts */
+#define BT_MAX_DISTSQ ((HEIGHT - 1)*(HEIGHT - 1) + (WIDTH - 1)*(WIDTH - 1))
+
+typedef struct Belief
+{
+    int     max_moves;          /* assumed moves per opponent turn */
+    bool    valid;              /* `pos' holds an observation */
+    bool    walls_final;        /* open_n/open_w reflect a complete map */
+    MazeRow pos[HEIGHT];        /* possible opponent squares */
+    MazeRow open_n[HEIGHT];     /* northern walls known to be absent */
+    MazeRow open_w[HEIGHT];     /* western walls known to be absent */
+
+    /* Column offset (or -1) of the squares at each squared distance and row
+       offset, filled by bt_reset(): */
+    signed char ring_dc[BT_MAX_DISTSQ + 1][HEIGHT];
+} Belief;
+
+extern void bt_reset(Belief *bt, int max_moves);
+
+/* Updates the belief with the squared distance observed at the start of a
+   turn (ignored if negative, i.e. in one-player games). */
+extern void bt_observe(Belief *bt, const MazeMap *mm, int distsq);
+
+/* Returns whether the opponent could be on square (r,c) of the map. */
+extern bool bt_possible(const Belief *bt, const MazeMap *mm, int r, int c);
+
+/* Returns the number of squares the opponent could be on, or -1 if the
+   belief does not hold an observation. */
+extern int bt_count(const Belief *bt);
+
+/* Adds to `set' (in maze coordinates) every square reachable from it in at
+   most `moves' moves through the walls known to be absent on the last call to
+   bt_observe(). */
+extern void bt_expand(const Belief *bt, MazeRow set[HEIGHT], int moves);
+
+/* Computes the set of squares at squared distance `distsq' from square (r,c),
+   all in maze coordinates. */
+extern void bt_ring( const Belief *bt, int r, int c, int distsq,
+                     MazeRow ring[HEIGHT] );
+
+#endif /* ndef BELIEF_H_INCLUDED */
@@ -0,0 +1,341 @@
+#include "GameEngine.h"
+#include "MazeIO.h"
+#include "MazePack.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Computes the line of sight from square (r,c) in direction `front'. */
+static void build_sight(const Game *g, char *buf, int r, int c, Dir front)
+{
+    char *p = buf;
+    Dir left = TURN(front, LEFT), right = TURN(front, RIGHT);
+
+    while (WALL(&g->mm_master, r, c, front) == ABSENT)
+    {
+        bool open_left, open_right;
+        r = RDR(r, front);
+        c = CDC(c, front);
+        open_left  = WALL(&g->mm_master, r, c, left)  == ABSENT;
+        open_right = WALL(&g->mm_master, r, c, right) == ABSENT;
+        if (open_left && open_right)
+            *p++ = 'B';
+        else
+        if (open_left && !open_right)
+            *p++ = 'L';
+        else
+        if (!open_left && open_right)
+            *p++ = 'R';
+        else  /* (!open_left && !open_right) */
+            *p++ = 'N';
+        assert(p < buf + MAX_SIGHT);
+    }
+    *p++ = 'W';
+    *p   = '\0';
+}
+
+/* Fills the sight and step tables for the current master maze. */
+static void build_tables(Game *g)
+{
+    int r, c, dir, rel_dir;
+
+    for (r = 0; r < HEIGHT; ++r)
+    {
+        for (c = 0; c < WIDTH; ++c)
+        {
+            for (dir = 0; dir < 4; ++dir)
+            {
+                build_sight(g, g->sight_table[r][c][dir], r, c, (Dir)dir);
+                for (rel_dir = 0; rel_dir < 4; ++rel_dir)
+                {
+                    Step *s = &g->step_table[r][c][dir][rel_dir];
+                    Dir d = TURN(dir, rel_dir);
+                    s->r   = RDR(r, d);
+                    s->c   = CDC(c, d);
+                    s->dir = d;
+                    s->blocked = WALL(&g->mm_master, r, c, d) != ABSENT;
+                }
+            }
+        }
+    }
+}
+
+bool ge_load_maze(Game *g, const char *path)
+{
+    FILE *fp;
+    bool ok;
+
+    /* Mazes in packs are decoded directly; anything else is parsed */
+    if (!mp_load(&g->mm_master, path))
+    {
+        fp = fopen(path, "rt");
+        ok = fp != NULL && mm_scan(&g->mm_master, fp);
+        if (fp != NULL) fclose(fp);
+        if (!ok) return false;
+    }
+    mm_clear_squares(&g->mm_master);
+    build_tables(g);
+    return true;
+}
+
+const char *ge_line_of_sight(const Game *g, int player, RelDir rel_dir)
+{
+    const MazeMap *mm = &g->mm_player[player];
+    return g->sight_table[mm->loc.r][mm->loc.c][TURN(mm->dir, rel_dir)];
+}
+
+int ge_player_dist(const Game *g)
+{
+    int dr, dc;
+    if (g->num_players < 2) return -1;
+    dr = g->mm_player[0].loc.r - g->mm_player[1].loc.r;
+    dc = g->mm_player[0].loc.c - g->mm_player[1].loc.c;
+    return dr*dr + dc*dc;
+}
+
+int ge_player(const Game *g)
+{
+    return g->turn_no%g->num_players;
+}
+
+static void place_player(const Game *g, MazeMap *mm)
+{
+    int r, c, dir;
+    do {
+        r   = rand()%HEIGHT;
+        c   = rand()%WIDTH;
+        dir = (Dir)(rand()%4);
+    } while (WALL(&g->mm_master, r, c, TURN(dir, BACK)) != ABSENT);
+    mm_initialize(mm, r, c, dir);
+}
+
+/* Marks a square as discovered in the master map. Returns whether the square
+   was discovered first. */
+static bool discover_square(Game *g, int r, int c)
+{
+    if (SQUARE(&g->mm_master, r, c) != UNKNOWN) return false;
+    SET_SQUARE(&g->mm_master, r, c, PRESENT);
+    return true;
+}
+
+/* Ends the game after the current turn, won by `player' (or drawn). */
+static void finish(Game *g, int player)
+{
+    g->over = true;
+    if (g->num_players == 1 || g->turn_no == MAX_TURNS*g->num_players)
+        player = -1;
+    g->winner = player;
+}
+
+/* Adds the squares `player' discovered since its last observation to its
+   score, and counts a capture if the players meet. */
+static void player_scores(Game *g, int player, const char *turn)
+{
+    int r, c, i;
+    MazeMap *mm = &g->mm_player[player];
+    const MazeJournal *j = mm->journal;
+    Score *sc = &g->score[player];
+
+    sc->moves += strlen(turn);
+
+    /* Count discovered squares; normally only the squares that changed since
+       the last observation need to be examined. */
+    if (j->incomplete)
+    {
+        sc->sq_disc = 0;
+        for (r = 0; r < HEIGHT; ++r)
+        {
+            for (c = 0; c < WIDTH; ++c)
+            {
+                if (SQUARE(mm, r, c) == PRESENT)
+                {
+                    ++sc->sq_disc;
+                    if (discover_square(g, r, c)) ++sc->sq_disc_first;
+                }
+            }
+        }
+    }
+    else
+    {
+        for (i = 0; i < j->size; ++i)
+        {
+            if (JE_KIND(j->entry[i]) == JE_SQUARE &&
+                JE_VALUE(j->entry[i]) == PRESENT)
+            {
+                r = JE_ROW(j->entry[i]);
+                c = JE_COL(j->entry[i]);
+                ++sc->sq_disc;
+                if (discover_square(g, r, c)) ++sc->sq_disc_first;
+            }
+        }
+    }
+
+    if (sc->sq_disc == HEIGHT*WIDTH)
+    {
+        g->map_complete[player] = true;
+    }
+    else
+    {
+        if (ge_player_dist(g) == 0)
+            ++sc->captures;
+    }
+}
+
+void ge_init(Game *g, int num_players, const StartPose *poses, int num_fixed)
+{
+    int p;
+
+    mm_clear_squares(&g->mm_master);
+    g->num_players = num_players;
+    for (p = 0; p < num_fixed && p < num_players; ++p)
+        mm_initialize(&g->mm_player[p], poses[p].r, poses[p].c, poses[p].dir);
+    do {
+        for (p = num_fixed; p < num_players; ++p)
+            place_player(g, &g->mm_player[p]);
+    } while (num_players > 1 && ge_player_dist(g) < 17*17);
+
+    g->turn_no   = 0;
+    g->over      = false;
+    g->winner    = -1;
+    g->truncated = 0;
+    g->returned  = false;
+
+    /* Discover starting squares */
+    for (p = 0; p < num_players; ++p)
+    {
+        mm_set_journal(&g->mm_player[p], &g->journal[p]);
+        mi_reset(&g->inference[p]);
+        memset(&g->score[p], 0, sizeof(Score));
+        g->map_complete[p] = false;
+        player_scores(g, p, "");
+    }
+}
+
+void ge_observe(Game *g, int player, const char *lines[4])
+{
+    static const Dir look_dirs[4] = { FRONT, RIGHT, BACK, LEFT };
+
+    int d;
+
+    mm_journal_reset(&g->journal[player]);
+    for (d = 0; d < 4; ++d)
+    {
+        const char *line = ge_line_of_sight(g, player, look_dirs[d]);
+        mm_look(&g->mm_player[player], line, look_dirs[d]);
+        if (lines != NULL) lines[d] = line;
+    }
+
+    /* Infer other parts of the maze */
+    mi_infer(&g->inference[player], &g->mm_player[player]);
+}
+
+/* Checks the syntax of the turn for syntactic validity.
+
+   A turn is syntactically valid if it consists only of letters F, T, L and R,
+   and is between 1 and 256 (inclusive) letters long. */
+static bool is_valid_turn(const char *s)
+{
+    const char *p;
+    for (p = s; *p; ++p) if (strchr("FTLR", *p) == NULL) return false;
+    return p > s && p <= s + 256;
+}
+
+/* Computes the length of the maximal prefix of `turn' that constitues a valid
+   turn from the given position, assuming the turn is syntactically valid. A
+   turn is valid if all moves in the turn can be performed in order without
+   walking through walls. */
+static int valid_turn_size( const Game *g, const char *turn,
+                            int r, int c, Dir dir )
+{
+    const Step *s;
+    int i;
+
+    for (i = 0; turn[i]; ++i)
+    {
+        switch (turn[i])
+        {
+        case 'F': s = &g->step_table[r][c][dir][FRONT]; break;
+        case 'T': s = &g->step_table[r][c][dir][BACK];  break;
+        case 'L': s = &g->step_table[r][c][dir][LEFT];  break;
+        case 'R': s = &g->step_table[r][c][dir][RIGHT]; break;
+        default: assert(0); return i;
+        }
+        if (s->blocked) break;
+        r   = s->r;
+        c   = s->c;
+        dir = (Dir)s->dir;
+    }
+
+    return i;
+}
+
+bool ge_move(Game *g, const char *turn)
+{
+    MazeMap *mm = &g->mm_player[ge_player(g)];
+    Point old_loc = mm->loc;
+    int len;
+
+    assert(!g->over);
+    g->truncated = 0;
+    g->returned  = false;
+    if (!is_valid_turn(turn))
+    {
+        ge_abort(g);
+        return false;
+    }
+
+    /* Perform valid moves */
+    len = valid_turn_size(g, turn, mm->loc.r, mm->loc.c, mm->dir);
+    g->truncated = (int)strlen(turn) - len;
+    for (; len > 0; --len) mm_move(mm, *turn++);
+
+    /* If we end up at our starting point, do an extra T move */
+    if (mm->loc.r == old_loc.r && mm->loc.c == old_loc.c)
+    {
+        g->returned = true;
+        mm_move(mm, 'T');
+    }
+
+    return true;
+}
+
+void ge_score(Game *g, const char *turn)
+{
+    const int p = ge_player(g);
+
+    player_scores(g, p, turn);
+    ++g->turn_no;
+    if (g->map_complete[p] && (g->num_players == 1 || ge_player_dist(g) == 0))
+        finish(g, p);
+    else
+    if (g->turn_no == MAX_TURNS*g->num_players)
+        finish(g, -1);
+}
+
+bool ge_step(Game *g, const char *turn)
+{
+    if (!ge_move(g, turn)) return false;
+    ge_score(g, turn);
+    return true;
+}
+
+void ge_abort(Game *g)
+{
+    /* The player forfeits: its opponent (if any) wins */
+    finish(g, (ge_player(g) + 1)%g->num_players);
+}
+
+int ge_total_score(const Score *sc)
+{
+    return -sc->moves + sc->sq_disc + sc->sq_disc_first + 100*sc->captures;
+}
+
+int ge_final_score(const Game *g, int player)
+{
+    int res = ge_total_score(&g->score[player]);
+    if (g->winner != -1) res = (player == g->winner) ? 2*res : 0;
+    if (res < 0) res = 0;
+    if (res > 1000) res = 1000;
+    return res;
+}
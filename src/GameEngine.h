@@ -0,0 +1,136 @@
+#ifndef GAME_ENGINE_H_INCLUDED
+#define GAME_ENGINE_H_INCLUDED
+
+#include "MazeMap.h"
+#include "MazeInfer.h"
+
+/* Headless game engine.
+
+   Implements the rules of the game as played by the arbiter, without any
+   processes, pipes or output, so that many games can be simulated quickly
+   (possibly concurrently, since all state is kept in the Game structure).
+
+   A game is played as follows:
+
+    ge_load_maze()  loads the master maze (this may be reused for several
+                    games, since the maze is not modified by playing)
+    ge_init()       places the players and discovers their starting squares
+    then, until `over' is set, for the player to move (turn_no%num_players):
+        ge_observe()    updates the player's map with what it currently sees
+        ge_step()       performs the player's turn and updates the scores
+    ge_final_score() computes the final scores.
+
+   ge_step() consists of ge_move() followed by ge_score(); the arbiter calls
+   these separately to time them. A player that fails to produce a valid
+   turn forfeits: ge_move() calls ge_abort() for an invalid turn, and the
+   caller calls it when a player produces no turn at all. In a two-player
+   game, the opponent then wins (and the forfeiting player scores 0).
+
+   The player maps (mm_player) are exactly what the players can know about the
+   maze (including inferred squares and walls). Their journals record all
+   changes since the player's last observation, until the next one. */
+
+#define MAX_TURNS 150
+#define MAX_SIGHT ((WIDTH > HEIGHT ? WIDTH : HEIGHT) + 1)
+
+/* Score components:
+    - number of moves requested (-1 point each)
+    - number of squares discovered (1 point each)
+    - number of squares discovered first (1 additional point each)
+    - number of times the opponent was captured (100 points each) */
+typedef struct Score
+{
+    int moves, sq_disc, sq_disc_first, captures;
+} Score;
+
+/* Starting position and direction of a player: */
+typedef struct StartPose
+{
+    int r, c;
+    Dir dir;
+} StartPose;
+
+/* Result of a single move from a given square and direction: */
+typedef struct Step
+{
+    unsigned char r, c, dir;
+    bool blocked;           /* a wall prevents the move */
+} Step;
+
+/* State of a single game.
+
+   The master maze map keeps track of existing walls and squares discovered
+   (by either player). Initially, all squares are unknown, and all walls are
+   known (either present or absent). This is used to determine valid moves and
+   keep track of which player discovers squares first.
+
+   Since the master maze's walls never change after it is loaded,
+   ge_load_maze() precomputes the line of sight from every square in every
+   (absolute) direction, and the result of every move (indexed by relative
+   direction) from every square and direction. */
+typedef struct Game
+{
+    int             num_players;
+    MazeMap         mm_master, mm_player[2];
+    MazeJournal     journal[2];
+    MazeInference   inference[2];
+    bool            map_complete[2];
+    Score           score[2];
+    char            sight_table[HEIGHT][WIDTH][4][MAX_SIGHT + 1];
+    Step            step_table[HEIGHT][WIDTH][4][4];
+
+    int             turn_no;        /* number of turns played so far */
+    bool            over;           /* game has ended */
+    int             winner;         /* if over: winning player, or -1 */
+
+    /* Set by ge_move(), for reporting: */
+    int             truncated;      /* number of moves dropped */
+    bool            returned;       /* extra T added after returning */
+} Game;
+
+/* Loads the master maze from a file, or from a maze pack if `path' is of the
+   form <pack file>:<index> (see MazePack.h); returns false on failure. */
+extern bool ge_load_maze(Game *g, const char *path);
+
+/* Starts a new game on the loaded maze. The first `num_fixed' players start
+   at the given poses (which may be NULL if num_fixed is 0); the others are
+   placed randomly (using rand()), with an opening behind them, and at least
+   17 squares away from each other. */
+extern void ge_init(Game *g, int num_players, const StartPose *poses,
+                    int num_fixed);
+
+/* Returns the player whose turn it is. */
+extern int ge_player(const Game *g);
+
+/* Determines what `player' can see in the given direction. */
+extern const char *ge_line_of_sight(const Game *g, int player, RelDir rel_dir);
+
+/* Returns the squared Euclidian distance between the players, or -1 in a
+   one-player game. */
+extern int ge_player_dist(const Game *g);
+
+/* Updates the map of `player' with the four lines of sight (front, right,
+   back and left; stored in `lines' if it is not NULL) and inferred walls. */
+extern void ge_observe(Game *g, int player, const char *lines[4]);
+
+/* Performs the current player's turn. Returns false (and ends the game) if
+   the turn is not syntactically valid; otherwise, the turn is truncated at
+   the first move into a wall, and an extra T move is made if the player ends
+   where it started. */
+extern bool ge_move(Game *g, const char *turn);
+
+/* Updates the current player's score after ge_move() and passes the turn to
+   the next player, ending the game when appropriate. */
+extern void ge_score(Game *g, const char *turn);
+
+/* Equivalent to ge_move() followed by ge_score() if the former succeeds. */
+extern bool ge_step(Game *g, const char *turn);
+
+/* Ends the game because the current player failed to produce a valid turn;
+   in a two-player game, its opponent wins. */
+extern void ge_abort(Game *g);
+
+extern int ge_total_score(const Score *sc);
+extern int ge_final_score(const Game *g, int player);
+
+#endif /* ndef GAME_ENGINE_H_INCLUDED */
@@ -0,0 +1,371 @@
+#define _POSIX_C_SOURCE 200112L
+#include "GameStore.h"
+#include <assert.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+const char * const gs_column_names[GS_NUM_COLUMNS] = {
+    "maze", "seed", "player1", "player2", "turns",
+    "moves1", "discovered1", "first1", "captures1", "total1", "final1",
+    "moves2", "discovered2", "first2", "captures2", "total2", "final2" };
+
+int gs_find_column(const char *name)
+{
+    int c;
+    for (c = 0; c < GS_NUM_COLUMNS; ++c)
+        if (strcmp(gs_column_names[c], name) == 0) return c;
+    return -1;
+}
+
+bool gs_is_name_column(int column)
+{
+    return column == GS_MAZE || column == GS_PLAYER1 || column == GS_PLAYER2;
+}
+
+static void put32(unsigned char *p, int value)
+{
+    unsigned long v = (unsigned long)value;
+    p[0] = v&255;
+    p[1] = (v >> 8)&255;
+    p[2] = (v >> 16)&255;
+    p[3] = (v >> 24)&255;
+}
+
+static int get32(const unsigned char *p)
+{
+    unsigned long v = p[0] | (p[1] << 8) | ((unsigned long)p[2] << 16) |
+                      ((unsigned long)p[3] << 24);
+    return (v < 0x80000000ul) ? (int)v : -(int)(0xfffffffful - v) - 1;
+}
+
+/* Returns whether the column files can be used in memory as they are: */
+static bool native_ints()
+{
+    const int one = 1;
+    return sizeof(int) == 4 && *(const char*)&one == 1;
+}
+
+static char *column_path(char *buf, const char *dir, const char *name)
+{
+    sprintf(buf, "%s/%s.col", dir, name);
+    return buf;
+}
+
+/* Returns the number of complete rows in the store (0 if it is empty or
+   doesn't exist). */
+static long count_rows(const char *dir, char *path)
+{
+    struct stat st;
+    long rows = -1, n;
+    int c;
+
+    for (c = 0; c < GS_NUM_COLUMNS; ++c)
+    {
+        column_path(path, dir, gs_column_names[c]);
+        n = (stat(path, &st) == 0) ? (long)(st.st_size/4) : 0;
+        if (rows == -1 || n < rows) rows = n;
+    }
+    return rows;
+}
+
+
+/* Names */
+
+static unsigned long hash_name(const char *s)
+{
+    unsigned long h = 2166136261ul;
+    while (*s != '\0') h = ((h ^ (unsigned char)*s++)*16777619ul)&0xfffffffful;
+    return h;
+}
+
+static int find_name(const GsNames *names, const char *name)
+{
+    unsigned long i;
+    int id;
+
+    if (names->table_size == 0) return -1;
+    for (i = hash_name(name); ; ++i)
+    {
+        id = names->table[i&(names->table_size - 1)];
+        if (id == -1 || strcmp(names->name[id], name) == 0) return id;
+    }
+}
+
+static bool rehash_names(GsNames *names, int table_size)
+{
+    int *table = malloc(sizeof(int)*table_size), id;
+    unsigned long i;
+
+    if (table == NULL) return false;
+    for (i = 0; i < (unsigned long)table_size; ++i) table[i] = -1;
+    for (id = 0; id < names->count; ++id)
+    {
+        for (i = hash_name(names->name[id]); table[i&(table_size - 1)] != -1;
+             ++i) { }
+        table[i&(table_size - 1)] = id;
+    }
+    free(names->table);
+    names->table      = table;
+    names->table_size = table_size;
+    return true;
+}
+
+/* Adds a name that doesn't occur yet; returns its number or -1 if memory
+   couldn't be allocated. */
+static int add_name(GsNames *names, const char *name)
+{
+    unsigned long i;
+    char *copy;
+
+    if (names->count == names->capacity)
+    {
+        int capacity = names->capacity ? 2*names->capacity : 64;
+        char **name = realloc(names->name, sizeof(char*)*capacity);
+        if (name == NULL) return -1;
+        names->name     = name;
+        names->capacity = capacity;
+    }
+    if (2*(names->count + 1) > names->table_size &&
+        !rehash_names(names, names->table_size ? 2*names->table_size : 128))
+        return -1;
+    if ((copy = malloc(strlen(name) + 1)) == NULL) return -1;
+    names->name[names->count] = strcpy(copy, name);
+    for (i = hash_name(name); names->table[i&(names->table_size - 1)] != -1;
+         ++i) { }
+    names->table[i&(names->table_size - 1)] = names->count;
+    return names->count++;
+}
+
+/* Reads the names file, if there is one. */
+static bool load_names(GsNames *names, const char *path)
+{
+    char line[4096], *eol;
+    FILE *fp;
+    bool ok = true;
+
+    if ((fp = fopen(path, "rt")) == NULL) return true;
+    while (ok && fgets(line, sizeof(line), fp) != NULL)
+    {
+        if ((eol = strchr(line, '\n')) != NULL) *eol = '\0';
+        ok = add_name(names, line) != -1;
+    }
+    fclose(fp);
+    return ok;
+}
+
+static void free_names(GsNames *names)
+{
+    int id;
+    for (id = 0; id < names->count; ++id) free(names->name[id]);
+    free(names->name);
+    free(names->table);
+    memset(names, 0, sizeof(*names));
+}
+
+
+/* Writing */
+
+bool gs_open(GameStore *gs, const char *dir)
+{
+    char *path = malloc(strlen(dir) + 32);
+    struct stat st;
+    bool ok = true;
+    int c, fd;
+
+    memset(gs, 0, sizeof(*gs));
+    if (path == NULL) return false;
+    if (mkdir(dir, 0777) != 0 && errno != EEXIST)
+    {
+        free(path);
+        return false;
+    }
+
+    /* Drop incomplete rows, then open all columns for appending */
+    gs->rows = count_rows(dir, path);
+    for (c = 0; c < GS_NUM_COLUMNS; ++c)
+    {
+        column_path(path, dir, gs_column_names[c]);
+        if (stat(path, &st) == 0 && st.st_size != 4*gs->rows)
+        {
+            if ((fd = open(path, O_WRONLY)) == -1 ||
+                ftruncate(fd, 4*gs->rows) != 0) ok = false;
+            if (fd != -1) close(fd);
+        }
+        if ((gs->fp[c] = fopen(path, "ab")) == NULL) ok = false;
+    }
+
+    sprintf(path, "%s/names.txt", dir);
+    if (!load_names(&gs->names, path) ||
+        (gs->fp_names = fopen(path, "at")) == NULL) ok = false;
+    free(path);
+    if (!ok) gs_close(gs);
+    return ok;
+}
+
+/* Returns the number of a name, adding it to the store if necessary. */
+static int name_id(GameStore *gs, const char *name)
+{
+    int id;
+
+    if (name == NULL) return GS_NO_PLAYER;
+    if ((id = find_name(&gs->names, name)) != -1) return id;
+    id = add_name(&gs->names, name);
+    assert(id != -1);
+    fprintf(gs->fp_names, "%s\n", name);
+    return id;
+}
+
+void gs_append(GameStore *gs, const GameRow *row)
+{
+    int value[GS_NUM_COLUMNS], *v, c, p;
+    unsigned char buf[4];
+
+    value[GS_MAZE]    = name_id(gs, row->maze);
+    value[GS_SEED]    = row->seed;
+    value[GS_PLAYER1] = name_id(gs, row->player[0]);
+    value[GS_PLAYER2] = name_id(gs, row->player[1]);
+    value[GS_TURNS]   = row->turns;
+    for (p = 0; p < 2; ++p)
+    {
+        v = value + GS_MOVES1 + GS_PLAYER_COLUMNS*p;
+        v[GS_MOVES1      - GS_MOVES1] = row->moves[p];
+        v[GS_DISCOVERED1 - GS_MOVES1] = row->discovered[p];
+        v[GS_FIRST1      - GS_MOVES1] = row->first[p];
+        v[GS_CAPTURES1   - GS_MOVES1] = row->captures[p];
+        v[GS_TOTAL1      - GS_MOVES1] = row->total[p];
+        v[GS_FINAL1      - GS_MOVES1] = row->final[p];
+    }
+    for (c = 0; c < GS_NUM_COLUMNS; ++c)
+    {
+        put32(buf, value[c]);
+        fwrite(buf, 1, 4, gs->fp[c]);
+    }
+    ++gs->rows;
+}
+
+bool gs_flush(GameStore *gs)
+{
+    bool ok = fflush(gs->fp_names) == 0;
+    int c;
+
+    for (c = 0; c < GS_NUM_COLUMNS; ++c)
+        if (fflush(gs->fp[c]) != 0) ok = false;
+    return ok;
+}
+
+bool gs_close(GameStore *gs)
+{
+    bool ok = true;
+    int c;
+
+    /* Names first, so no row refers to a name that wasn't written */
+    if (gs->fp_names != NULL && fclose(gs->fp_names) != 0) ok = false;
+    for (c = 0; c < GS_NUM_COLUMNS; ++c)
+        if (gs->fp[c] != NULL && fclose(gs->fp[c]) != 0) ok = false;
+    free_names(&gs->names);
+    memset(gs, 0, sizeof(*gs));
+    return ok;
+}
+
+
+/* Reading */
+
+bool gt_open(GameTable *gt, const char *dir)
+{
+    char *path;
+    struct stat st;
+    bool ok;
+
+    memset(gt, 0, sizeof(*gt));
+    if (stat(dir, &st) != 0 || !S_ISDIR(st.st_mode)) return false;
+    if ((path = malloc(strlen(dir) + 32)) == NULL) return false;
+    if ((gt->dir = malloc(strlen(dir) + 1)) == NULL)
+    {
+        free(path);
+        return false;
+    }
+    strcpy(gt->dir, dir);
+    gt->rows = count_rows(dir, path);
+    sprintf(path, "%s/names.txt", dir);
+    ok = load_names(&gt->names, path);
+    free(path);
+    if (!ok) gt_close(gt);
+    return ok;
+}
+
+void gt_close(GameTable *gt)
+{
+    int c;
+
+    for (c = 0; c < GS_NUM_COLUMNS; ++c)
+    {
+        if (gt->mapped[c])
+            munmap(gt->data[c], 4*gt->rows);
+        else
+            free(gt->data[c]);
+    }
+    free_names(&gt->names);
+    free(gt->dir);
+    memset(gt, 0, sizeof(*gt));
+}
+
+const int *gt_column(GameTable *gt, int column)
+{
+    static const int empty[1] = { 0 };
+    char *path;
+    unsigned char *buf;
+    int *values, fd;
+    long i;
+
+    if (gt->column[column] != NULL) return gt->column[column];
+    if (gt->rows == 0) return gt->column[column] = empty;
+
+    if ((path = malloc(strlen(gt->dir) + 32)) == NULL) return NULL;
+    fd = open(column_path(path, gt->dir, gs_column_names[column]), O_RDONLY);
+    free(path);
+    if (fd == -1) return NULL;
+
+    if (native_ints())
+    {
+        void *data = mmap(NULL, 4*gt->rows, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        if (data == MAP_FAILED) return NULL;
+        gt->data[column]   = data;
+        gt->mapped[column] = true;
+        return gt->column[column] = data;
+    }
+
+    /* Decode into memory */
+    values = malloc(sizeof(int)*gt->rows);
+    buf    = malloc(4*gt->rows);
+    if (values == NULL || buf == NULL ||
+        read(fd, buf, 4*gt->rows) != (ssize_t)(4*gt->rows))
+    {
+        free(values);
+        free(buf);
+        close(fd);
+        return NULL;
+    }
+    close(fd);
+    for (i = 0; i < gt->rows; ++i) values[i] = get32(buf + 4*i);
+    free(buf);
+    gt->data[column] = values;
+    return gt->column[column] = values;
+}
+
+const char *gt_name(const GameTable *gt, int id)
+{
+    if (id == GS_NO_PLAYER) return "-";
+    if (id < 0 || id >= gt->names.count) return "?";
+    return gt->names.name[id];
+}
+
+int gt_find_name(const GameTable *gt, const char *name)
+{
+    return find_name(&gt->names, name);
+}
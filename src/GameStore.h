@@ -0,0 +1,101 @@
+#ifndef GAME_STORE_H_INCLUDED
+#define GAME_STORE_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdio.h>
+
+/* Column store of game summaries.
+
+   A store is a directory with one file per column (<column name>.col), which
+   holds one 32-bit little-endian integer per game, and a file of names
+   (names.txt, one per line) that the maze and player columns refer to by line
+   number, counting from 0. A game is added by appending a value to every
+   column file, so a query only needs to read (or map) the columns it uses.
+
+   If the column files have different lengths, because a writer was
+   interrupted, the shortest one determines the number of games; gs_open()
+   truncates the others to match. */
+
+typedef enum GsColumn
+{
+    GS_MAZE, GS_SEED, GS_PLAYER1, GS_PLAYER2, GS_TURNS,
+    GS_MOVES1, GS_DISCOVERED1, GS_FIRST1, GS_CAPTURES1, GS_TOTAL1, GS_FINAL1,
+    GS_MOVES2, GS_DISCOVERED2, GS_FIRST2, GS_CAPTURES2, GS_TOTAL2, GS_FINAL2,
+    GS_NUM_COLUMNS
+} GsColumn;
+
+/* Number of per-player columns (from GS_MOVES1 up to and including
+   GS_FINAL1): */
+#define GS_PLAYER_COLUMNS (GS_MOVES2 - GS_MOVES1)
+
+/* Value of the player2 column in one-player games: */
+#define GS_NO_PLAYER -1
+
+extern const char * const gs_column_names[GS_NUM_COLUMNS];
+
+/* Returns the column with the given name, or -1 if there is none. */
+extern int gs_find_column(const char *name);
+
+/* Returns whether the column's values are names (maze and players). */
+extern bool gs_is_name_column(int column);
+
+/* Summary of a game, as added to a store: */
+typedef struct GameRow
+{
+    const char  *maze, *player[2];      /* player[1] is NULL if absent */
+    int         seed, turns;
+    int         moves[2], discovered[2], first[2], captures[2];
+    int         total[2], final[2];
+} GameRow;
+
+/* Names, with a hash table (of `table_size' slots, a power of two) mapping
+   them back to their numbers: */
+typedef struct GsNames
+{
+    char        **name;
+    int         count, capacity;
+    int         *table;                 /* name numbers; -1 if unused */
+    int         table_size;
+} GsNames;
+
+/* Writing: */
+typedef struct GameStore
+{
+    FILE        *fp[GS_NUM_COLUMNS], *fp_names;
+    GsNames     names;
+    long        rows;
+} GameStore;
+
+/* Opens the store in directory `dir' for appending, creating it if it
+   doesn't exist yet. */
+extern bool gs_open(GameStore *gs, const char *dir);
+extern void gs_append(GameStore *gs, const GameRow *row);
+extern bool gs_flush(GameStore *gs);
+extern bool gs_close(GameStore *gs);
+
+/* Reading: */
+typedef struct GameTable
+{
+    char        *dir;
+    long        rows;
+    GsNames     names;
+    const int   *column[GS_NUM_COLUMNS];    /* NULL until loaded */
+    void        *data[GS_NUM_COLUMNS];      /* mapped or allocated */
+    bool        mapped[GS_NUM_COLUMNS];
+} GameTable;
+
+extern bool gt_open(GameTable *gt, const char *dir);
+extern void gt_close(GameTable *gt);
+
+/* Returns the values of a column (`rows' of them), loading it if necessary,
+   or NULL if it couldn't be loaded. Where ints are 32-bit little-endian, the
+   file is mapped into memory as is. */
+extern const int *gt_column(GameTable *gt, int column);
+
+/* Returns the name with the given number (or "-" for GS_NO_PLAYER). */
+extern const char *gt_name(const GameTable *gt, int id);
+
+/* Returns the number of a name, or -1 if it doesn't occur in the store. */
+extern int gt_find_name(const GameTable *gt, const char *name);
+
+#endif /* ndef GAME_STORE_H_INCLUDED */
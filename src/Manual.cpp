@@ -1,7 +1,7 @@
 extern "C"
 {
 #include "MazeIO.h"
-#include "Analysis.h"
+#include "AI.h"
 }
 
 #include <string>
@@ -14,7 +14,7 @@ extern "C"
 class MazeWindow : public Fl_Double_Window
 {
 public:
-    MazeWindow(MazeMap *mm, int distsq);
+    MazeWindow(MazeMap *mm, int distsq, MazeDistance *md, Belief *belief);
     ~MazeWindow();
     int square(int r, int c);
     int wall(int r, int c, Dir dir);
@@ -26,6 +26,8 @@ public:
 private:
     const MazeMap   *mm;
     int             distsq;
+    MazeDistance    *m_md;
+    Belief          *m_belief;
     int             m_dist[HEIGHT][WIDTH];
     std::string     m_turn;
     pthread_cond_t  cond;
@@ -53,12 +55,15 @@ static MazeWindow   *g_maze_window;
 static pthread_t    g_gui_thread;
 static std::string  g_turn;
 
-MazeWindow::MazeWindow(MazeMap *mm, int distsq)
+MazeWindow::MazeWindow( MazeMap *mm, int distsq, MazeDistance *md,
+                        Belief *belief )
     : Fl_Double_Window(SZ_CE*mm_width(mm) + SZ_WA,
                        SZ_CE*mm_height(mm) + SZ_WA, "MazeMap")
 {
     pthread_cond_init(&cond, NULL);
     pthread_mutex_init(&mutex, NULL);
+    m_md = md;
+    m_belief = belief;
     update(mm, distsq);
 }
 
@@ -122,13 +127,15 @@ void MazeWindow::draw()
     int pr = (mm->loc.r - mm->border.top + HEIGHT)%HEIGHT;
     int pc = (mm->loc.c - mm->border.left + WIDTH)%WIDTH;
 
-    // Draw opponent's potential locaiton
+    // Draw opponent's potential locaiton (narrowed down by the belief, once
+    // the borders are known)
     for (int r = 0; r < H; ++r)
     {
         for (int c = 0; c < W; ++c)
         {
             int dr = r - pr, dc = c - pc;
-            if (dr*dr + dc*dc == distsq)
+            if (m_belief->valid ? ((m_belief->pos[r] >> c)&1) != 0
+                                : dr*dr + dc*dc == distsq)
             {
                 fl_begin_complex_polygon();
                 fl_color(op_color);
@@ -227,7 +234,9 @@ void MazeWindow::update(MazeMap *mm, int distsq)
     this->m_last_c      = -1;
     this->m_path_len    = 0;
     this->m_turn        = "T";
-    find_distance(mm, m_dist, mm->loc.r, mm->loc.c);
+    md_update(m_md, mm);
+    md_find_distance(m_md, m_dist, mm->loc.r, mm->loc.c);
+    bt_observe(m_belief, mm, distsq);
     resize(x(), y(), SZ_CE*mm_width(mm) + SZ_WA, SZ_CE*mm_height(mm) + SZ_WA);
     redraw();
     Fl::awake();
@@ -262,11 +271,11 @@ static void *gui_thread_func(void *arg)
 }
 
 extern "C"
-const char *pick_move(MazeMap *mm, int distsq)
+const char *pick_move_r(MazeMap *mm, int distsq, AIContext *ctx)
 {
     if (g_maze_window == NULL)
     {
-        g_maze_window = new MazeWindow(mm, distsq);
+        g_maze_window = new MazeWindow(mm, distsq, ctx->md, &ctx->belief);
         g_maze_window->end();
         pthread_create(&g_gui_thread, NULL, &gui_thread_func, NULL);
     }
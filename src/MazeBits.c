@@ -0,0 +1,334 @@
+#include "MazeBits.h"
+#include <assert.h>
+#include <string.h>
+
+/* Rotates a row so that bit c holds the bit of column c + 1 (c - 1): */
+#define COL_NEXT(x) ((((x) >> 1) | (((x)&1) << (WIDTH - 1)))&MB_ROW_MASK)
+#define COL_PREV(x) ((((x) << 1) | ((x) >> (WIDTH - 1)))&MB_ROW_MASK)
+
+/* Bits that are known to be absent: */
+#define ABSENT_BITS(known, present) ((known)&~(present))
+
+/* Bits set in exactly three of four rows: */
+#define THREE_OF_FOUR(a, b, c, d) \
+    ((((a)&(b)&(c)) | ((a)&(b)&(d)) | ((a)&(c)&(d)) | ((b)&(c)&(d))) & \
+     ~((a)&(b)&(c)&(d)))
+
+static void set_bit(MazeRow *known, MazeRow *present, int c, int val)
+{
+    const MazeRow bit = (MazeRow)1 << c;
+    if (val == UNKNOWN) *known &= ~bit; else *known |= bit;
+    if (val == PRESENT) *present |= bit; else *present &= ~bit;
+}
+
+int mb_get_wall(const MazeBits *mb, int r, int c, Dir dir)
+{
+    if (((int)dir&1) == 0)  /* north/south */
+    {
+        if (dir == SOUTH) r = (r + 1)%HEIGHT;
+        return MB_VALUE(mb->wn_known[r], mb->wn_present[r], c);
+    }
+    else  /* east/west */
+    {
+        if (dir == EAST) c = (c + 1)%WIDTH;
+        return MB_VALUE(mb->ww_known[r], mb->ww_present[r], c);
+    }
+}
+
+void mb_set_wall(MazeBits *mb, int r, int c, Dir dir, int val)
+{
+    if (((int)dir&1) == 0)  /* north/south */
+    {
+        if (dir == SOUTH) r = (r + 1)%HEIGHT;
+        set_bit(&mb->wn_known[r], &mb->wn_present[r], c, val);
+    }
+    else  /* east/west */
+    {
+        if (dir == EAST) c = (c + 1)%WIDTH;
+        set_bit(&mb->ww_known[r], &mb->ww_present[r], c, val);
+    }
+}
+
+void mb_set_square(MazeBits *mb, int r, int c, int val)
+{
+    set_bit(&mb->sq_known[r], &mb->sq_present[r], c, val);
+}
+
+void mb_load(MazeBits *mb, const MazeMap *mm)
+{
+    int r, c;
+
+    memset(mb, 0, sizeof(MazeBits));
+    for (r = 0; r < HEIGHT; ++r)
+    {
+        for (c = 0; c < WIDTH; ++c)
+        {
+            const MazeCell *cell = &mm->grid[r][c];
+            set_bit(&mb->sq_known[r], &mb->sq_present[r], c, cell->square);
+            set_bit(&mb->wn_known[r], &mb->wn_present[r], c, cell->wall_n);
+            set_bit(&mb->ww_known[r], &mb->ww_present[r], c, cell->wall_w);
+        }
+    }
+    mb->loc    = mm->loc;
+    mb->dir    = mm->dir;
+    mb->border = mm->border;
+}
+
+void mb_store(const MazeBits *mb, MazeMap *mm)
+{
+    int r, c;
+
+    for (r = 0; r < HEIGHT; ++r)
+    {
+        for (c = 0; c < WIDTH; ++c)
+        {
+            const MazeCell *cell = &mm->grid[r][c];
+            int v;
+            if ((v = MB_SQUARE(mb, r, c)) != cell->square)
+                SET_SQUARE(mm, r, c, v);
+            if ((v = MB_VALUE(mb->wn_known[r], mb->wn_present[r], c))
+                != cell->wall_n)
+                SET_WALL(mm, r, c, NORTH, v);
+            if ((v = MB_VALUE(mb->ww_known[r], mb->ww_present[r], c))
+                != cell->wall_w)
+                SET_WALL(mm, r, c, WEST, v);
+        }
+    }
+    mm->loc    = mb->loc;
+    mm->dir    = mb->dir;
+    mm->border = mb->border;
+    mm_rehash(mm);
+}
+
+int mb_popcount(MazeRow row)
+{
+#ifdef __GNUC__
+    return __builtin_popcountl(row);
+#else
+    int n;
+    for (n = 0; row != 0; ++n) row &= row - 1;
+    return n;
+#endif
+}
+
+int mb_lowest_bit(unsigned long x)
+{
+#ifdef __GNUC__
+    return __builtin_ctzl(x);
+#else
+    int n;
+    for (n = 0; (x&1) == 0; ++n) x >>= 1;
+    return n;
+#endif
+}
+
+int mb_count_squares(const MazeBits *mb)
+{
+    int r, res = 0;
+    for (r = 0; r < HEIGHT; ++r)
+        res += mb_popcount(mb->sq_present[r]);
+    return res;
+}
+
+/* Dead-end rule (see mm_infer): a square with three sides that are either
+   walls or openings to dead-end squares is a dead-end square itself; it is
+   discovered, and so are its openings. Evaluated for an entire row at once,
+   until no more dead-end squares are found. */
+bool mb_infer_dead_ends(MazeBits *mb)
+{
+    MazeRow dead[HEIGHT], n, s, w, e, found;
+    int r, up, down;
+    bool changed = false, progress;
+
+    memset(dead, 0, sizeof(dead));
+    do {
+        progress = false;
+        for (r = 0; r < HEIGHT; ++r)
+        {
+            up   = (r + HEIGHT - 1)%HEIGHT;
+            down = (r + 1)%HEIGHT;
+
+            /* Sides that are walls, or openings to dead-end squares: */
+            n = mb->wn_present[r] |
+                (ABSENT_BITS(mb->wn_known[r], mb->wn_present[r])&dead[up]);
+            s = mb->wn_present[down] |
+                (ABSENT_BITS(mb->wn_known[down], mb->wn_present[down]) &
+                 dead[down]);
+            w = mb->ww_present[r] |
+                (ABSENT_BITS(mb->ww_known[r], mb->ww_present[r]) &
+                 COL_PREV(dead[r]));
+            e = COL_NEXT(mb->ww_present[r] |
+                (ABSENT_BITS(mb->ww_known[r], mb->ww_present[r])&dead[r]));
+            assert((n&s&w&e&~dead[r]) == 0);
+
+            found = THREE_OF_FOUR(n, s, w, e)&~dead[r];
+            if (found == 0) continue;
+            progress = true;
+            dead[r] |= found;
+
+            /* Discover the square and its unknown walls (as openings) */
+            if ((found&~mb->sq_known[r]) != 0 ||
+                (found&~mb->wn_known[r]) != 0 ||
+                (found&~mb->wn_known[down]) != 0 ||
+                (found&~mb->ww_known[r]) != 0 ||
+                (COL_PREV(found)&~mb->ww_known[r]) != 0) changed = true;
+            mb->sq_known[r]    |= found;
+            mb->sq_present[r]  |= found;
+            mb->wn_known[r]    |= found;
+            mb->wn_known[down] |= found;
+            mb->ww_known[r]    |= found | COL_PREV(found);
+        }
+    } while (progress);
+
+    return changed;
+}
+
+/* Corner rule (see mm_infer): if three of the four edges meeting in a corner
+   are openings, the fourth is a wall. Row r handles the corners between rows
+   r and r + 1; bit c describes the south-west corner of square (r, c), where
+   the four edges are (clockwise, starting north):
+        wall_w of (r, c), wall_n of (r + 1, c), wall_w of (r + 1, c) and
+        wall_n of (r + 1, c - 1). */
+bool mb_infer_corners(MazeBits *mb)
+{
+    MazeRow an, ae, as, aw, m;
+    int r, r1;
+    bool changed = false;
+
+    for (r = 0; r < HEIGHT; ++r)
+    {
+        r1 = (r + 1)%HEIGHT;
+        an = ABSENT_BITS(mb->ww_known[r],  mb->ww_present[r]);
+        ae = ABSENT_BITS(mb->wn_known[r1], mb->wn_present[r1]);
+        as = ABSENT_BITS(mb->ww_known[r1], mb->ww_present[r1]);
+        aw = COL_PREV(ABSENT_BITS(mb->wn_known[r1], mb->wn_present[r1]));
+        assert((an&ae&as&aw) == 0);
+
+        if ((m = ae&as&aw&~mb->ww_known[r]) != 0)
+        {
+            mb->ww_known[r]   |= m;
+            mb->ww_present[r] |= m;
+            changed = true;
+        }
+        if ((m = an&as&aw&~mb->wn_known[r1]) != 0)
+        {
+            mb->wn_known[r1]   |= m;
+            mb->wn_present[r1] |= m;
+            changed = true;
+        }
+        if ((m = an&ae&aw&~mb->ww_known[r1]) != 0)
+        {
+            mb->ww_known[r1]   |= m;
+            mb->ww_present[r1] |= m;
+            changed = true;
+        }
+        if ((m = COL_NEXT(an&ae&as&~COL_PREV(mb->wn_known[r1]))) != 0)
+        {
+            mb->wn_known[r1]   |= m;
+            mb->wn_present[r1] |= m;
+            changed = true;
+        }
+    }
+
+    return changed;
+}
+
+/* Border rules (see mm_infer): once the explored region spans all columns
+   (rows), the western (northern) walls of its leftmost column (top row) are
+   the outer edges of the maze. */
+bool mb_infer_borders(MazeBits *mb)
+{
+    const MazeRow bit = (MazeRow)1 << mb->border.left;
+    const int top = mb->border.top;
+    bool changed = false;
+    int r;
+
+    if (mb->border.left == mb->border.right)
+    {
+        for (r = 0; r < HEIGHT; ++r)
+        {
+            if ((mb->ww_present[r]&bit) == 0)
+            {
+                assert((mb->ww_known[r]&bit) == 0);
+                mb->ww_known[r]   |= bit;
+                mb->ww_present[r] |= bit;
+                changed = true;
+            }
+        }
+    }
+
+    if (mb->border.top == mb->border.bottom &&
+        mb->wn_present[top] != MB_ROW_MASK)
+    {
+        assert(mb->wn_known[top] == mb->wn_present[top]);
+        mb->wn_known[top]   = MB_ROW_MASK;
+        mb->wn_present[top] = MB_ROW_MASK;
+        changed = true;
+    }
+
+    return changed;
+}
+
+void mb_infer(MazeBits *mb)
+{
+    bool changed;
+
+    do {
+        changed = mb_infer_dead_ends(mb);
+        if (mb_infer_corners(mb)) changed = true;
+        if (mb_infer_borders(mb)) changed = true;
+    } while (changed);
+}
+
+void mb_find_distance( const MazeBits *mb, int dist[HEIGHT][WIDTH],
+                       int r, int c )
+{
+    MazeRow open_n[HEIGHT], open_w[HEIGHT];
+    MazeRow seen[HEIGHT], front[HEIGHT], next[HEIGHT], f;
+    unsigned long active, touched, m;   /* sets of rows */
+    int i, d, up, down;
+
+    for (i = 0; i < HEIGHT; ++i)
+    {
+        open_n[i] = ABSENT_BITS(mb->wn_known[i], mb->wn_present[i]);
+        open_w[i] = ABSENT_BITS(mb->ww_known[i], mb->ww_present[i]);
+        seen[i] = front[i] = next[i] = 0;
+    }
+    memset(dist, -1, sizeof(int)*HEIGHT*WIDTH);
+    dist[r][c] = 0;
+    seen[r] = front[r] = (MazeRow)1 << c;
+    active = 1ul << r;
+
+    for (d = 1; active != 0; ++d)
+    {
+        /* Move every square on the frontier in all four directions */
+        touched = 0;
+        for (m = active; m != 0; m &= m - 1)
+        {
+            r    = mb_lowest_bit(m);
+            up   = (r + HEIGHT - 1)%HEIGHT;
+            down = (r + 1)%HEIGHT;
+            f    = front[r];
+            next[up]   |= f&open_n[r];
+            next[down] |= f&open_n[down];
+            next[r]    |= COL_NEXT(f&open_w[r]) | (COL_PREV(f)&open_w[r]);
+            touched |= (1ul << up) | (1ul << r) | (1ul << down);
+            front[r] = 0;
+        }
+
+        /* Squares not seen before form the next frontier */
+        active = 0;
+        for (m = touched; m != 0; m &= m - 1)
+        {
+            r = mb_lowest_bit(m);
+            f = next[r]&~seen[r];
+            next[r] = 0;
+            if (f == 0) continue;
+            seen[r] |= f;
+            front[r] = f;
+            active |= 1ul << r;
+            for (; f != 0; f &= f - 1)
+                dist[r][mb_lowest_bit(f)] = d;
+        }
+    }
+}
@@ -0,0 +1,70 @@
+#ifndef MAZE_BITS_H_INCLUDED
+#define MAZE_BITS_H_INCLUDED
+
+#include "MazeMap.h"
+
+/* Bit-plane representation of a maze map.
+
+   Instead of a grid of cells, the map is stored as six bit planes with one
+   word per row, where bit c of a row word describes column c:
+
+        sq_known,  sq_present       squares
+        wn_known,  wn_present       northern walls (as MazeCell.wall_n)
+        ww_known,  ww_present       western walls  (as MazeCell.wall_w)
+
+   A value is UNKNOWN if its known bit is clear, PRESENT if both bits are set
+   and ABSENT if only the known bit is set; present bits are never set without
+   the corresponding known bits. MB_SQUARE and MB_WALL return the same values
+   as SQUARE and WALL would for the equivalent MazeMap.
+
+   This allows counting and most inference rules to operate on entire rows at
+   once. Bit planes are not journaled; mb_store() writes the differences back
+   to a MazeMap through SET_SQUARE and SET_WALL. */
+
+typedef unsigned long MazeRow;      /* must hold at least WIDTH bits */
+
+#define MB_ROW_MASK ((MazeRow)((1ul << WIDTH) - 1))
+
+typedef struct MazeBits
+{
+    MazeRow sq_known[HEIGHT], sq_present[HEIGHT];
+    MazeRow wn_known[HEIGHT], wn_present[HEIGHT];
+    MazeRow ww_known[HEIGHT], ww_present[HEIGHT];
+    Point   loc;
+    Dir     dir;
+    Rect    border;
+} MazeBits;
+
+#define MB_VALUE(known, present, c) \
+    ((((known) >> (c))&1) ? ((((present) >> (c))&1) ? PRESENT : ABSENT) \
+                          : UNKNOWN)
+
+#define MB_SQUARE(mb, r, c) \
+    MB_VALUE((mb)->sq_known[r], (mb)->sq_present[r], c)
+#define MB_WALL(mb, r, c, dir) (mb_get_wall(mb, r, c, dir))
+
+extern void mb_load(MazeBits *mb, const MazeMap *mm);
+extern void mb_store(const MazeBits *mb, MazeMap *mm);
+extern int  mb_get_wall(const MazeBits *mb, int r, int c, Dir dir);
+extern void mb_set_wall(MazeBits *mb, int r, int c, Dir dir, int val);
+extern void mb_set_square(MazeBits *mb, int r, int c, int val);
+extern int  mb_count_squares(const MazeBits *mb);
+extern int  mb_popcount(MazeRow row);
+
+/* Returns the index of the lowest set bit of a nonzero word: */
+extern int  mb_lowest_bit(unsigned long x);
+
+/* Inference rules; each returns whether the map was changed. mb_infer()
+   applies all of them until nothing changes, like mm_infer(). */
+extern bool mb_infer_dead_ends(MazeBits *mb);
+extern bool mb_infer_corners(MazeBits *mb);
+extern bool mb_infer_borders(MazeBits *mb);
+extern void mb_infer(MazeBits *mb);
+
+/* Computes distances like find_distance() (see Analysis.h), with a breadth-
+   first search that expands the frontier of all rows at once. Only rows that
+   have squares on the frontier are visited at each step. */
+extern void mb_find_distance( const MazeBits *mb, int dist[HEIGHT][WIDTH],
+                              int r, int c );
+
+#endif /* ndef MAZE_BITS_H_INCLUDED */
@@ -0,0 +1,87 @@
+#include "MazeCache.h"
+#include <assert.h>
+#include <string.h>
+
+void mc_reset(MazeCache *mc)
+{
+    int i;
+
+    mc->infer_hits = mc->infer_misses = 0;
+    mc->move_hits  = mc->move_misses  = 0;
+    for (i = 0; i < MC_INFER_SIZE; ++i) mc->infer[i].num_changes = -1;
+    for (i = 0; i < MC_MOVE_SIZE; ++i) mc->move[i].used = false;
+}
+
+/* Applies a change recorded in a journal entry to the map: */
+static void apply(MazeMap *mm, unsigned short e)
+{
+    const int r = JE_ROW(e), c = JE_COL(e);
+
+    switch (JE_KIND(e))
+    {
+    case JE_SQUARE: SET_SQUARE(mm, r, c, JE_VALUE(e)); break;
+    case JE_WALL_N: SET_WALL(mm, r, c, NORTH, JE_VALUE(e)); break;
+    case JE_WALL_W: SET_WALL(mm, r, c, WEST, JE_VALUE(e)); break;
+    default: assert(0);
+    }
+}
+
+void mc_infer(MazeCache *mc, MazeInference *mi, MazeMap *mm)
+{
+    const MazeHash key = mm->hash ^ mm_pose_hash(mm);
+    MazeCacheInfer *e = &mc->infer[key%MC_INFER_SIZE];
+    const MazeJournal *journal = mm->journal;
+    int i, r, c, start;
+
+    if (e->num_changes >= 0 && e->key == key)
+    {
+        ++mc->infer_hits;
+        for (i = 0; i < e->num_changes; ++i) apply(mm, e->change[i]);
+        mi_restore(mi, mm, e->dead_end);
+        return;
+    }
+    ++mc->infer_misses;
+
+    /* Infer, and record the changes appended to the journal */
+    start = (journal != NULL) ? journal->size : 0;
+    mi_infer(mi, mm);
+    if (journal == NULL || journal->size < start ||
+        journal->size == MAX_JOURNAL || journal->size - start > MC_MAX_CHANGES)
+        return;
+    e->key = key;
+    e->num_changes = journal->size - start;
+    memcpy(e->change, journal->entry + start,
+           sizeof(*e->change)*e->num_changes);
+    memset(e->dead_end, 0, sizeof(e->dead_end));
+    for (r = 0; r < HEIGHT; ++r)
+    {
+        for (c = 0; c < WIDTH; ++c)
+        {
+            i = r*WIDTH + c;
+            if (mi->dead_end[r][c]) e->dead_end[i/8] |= 1 << (i%8);
+        }
+    }
+}
+
+bool mc_find_move(MazeCache *mc, const MazeMap *mm, Point *dst)
+{
+    const MazeCacheMove *e = &mc->move[mm->hash%MC_MOVE_SIZE];
+
+    if (e->used && e->key == mm->hash)
+    {
+        ++mc->move_hits;
+        *dst = e->dst;
+        return true;
+    }
+    ++mc->move_misses;
+    return false;
+}
+
+void mc_store_move(MazeCache *mc, const MazeMap *mm, Point dst)
+{
+    MazeCacheMove *e = &mc->move[mm->hash%MC_MOVE_SIZE];
+
+    e->key  = mm->hash;
+    e->used = true;
+    e->dst  = dst;
+}
@@ -0,0 +1,68 @@
+#ifndef MAZE_CACHE_H_INCLUDED
+#define MAZE_CACHE_H_INCLUDED
+
+#include "MazeInfer.h"
+
+/* Memo cache of inference results and moves, keyed by map hashes.
+
+   Knowledge states repeat when the same maze is played many times (e.g. in
+   tournaments or parameter sweeps): every game started from the same square
+   and direction sees the same states until the players' choices diverge.
+   Since both inference and exploration are functions of the map alone, their
+   results can be reused for states seen before.
+
+   mc_infer() is a drop-in replacement for mi_infer(). It is keyed by what is
+   known about the maze (mm->hash ^ mm_pose_hash(mm)), and stores the changes
+   inference made, as journal entries, along with the dead-end squares of the
+   resulting map; on a hit, the changes are applied with SET_SQUARE/SET_WALL,
+   so the journal and hash stay up to date, and the dead ends are handed to
+   mi_restore(), so the MazeInference ends up as if mi_infer() had run (and
+   games play out the same with or without the cache). Results are
+   only stored if the map has a journal (which is not reset in between) and
+   inference changed at most MC_MAX_CHANGES squares and walls.
+
+   mc_find_move() and mc_store_move() cache the square the AI explores towards
+   by the full hash, which includes the player's pose.
+
+   Both tables are direct-mapped and bounded: a new entry replaces whichever
+   entry was in its slot. The cache may be shared by all players of the same
+   AI, but not by concurrently running ones. */
+
+#define MC_INFER_SIZE   1024
+#define MC_MOVE_SIZE    4096
+#define MC_MAX_CHANGES  126
+
+typedef struct MazeCacheInfer
+{
+    MazeHash        key;
+    int             num_changes;    /* or -1 if unused */
+    unsigned short  change[MC_MAX_CHANGES];
+    unsigned char   dead_end[(HEIGHT*WIDTH + 7)/8];     /* see mi_restore() */
+} MazeCacheInfer;
+
+typedef struct MazeCacheMove
+{
+    MazeHash        key;
+    bool            used;
+    Point           dst;
+} MazeCacheMove;
+
+typedef struct MazeCache
+{
+    long            infer_hits, infer_misses;
+    long            move_hits, move_misses;
+    MazeCacheInfer  infer[MC_INFER_SIZE];
+    MazeCacheMove   move[MC_MOVE_SIZE];
+} MazeCache;
+
+/* Clears all entries and counters. */
+extern void mc_reset(MazeCache *mc);
+
+extern void mc_infer(MazeCache *mc, MazeInference *mi, MazeMap *mm);
+
+/* Looks up the move for the map's current state (counting a hit or a miss).
+   Returns whether it was found; if so, stores the target square in `dst'. */
+extern bool mc_find_move(MazeCache *mc, const MazeMap *mm, Point *dst);
+extern void mc_store_move(MazeCache *mc, const MazeMap *mm, Point dst);
+
+#endif /* ndef MAZE_CACHE_H_INCLUDED */
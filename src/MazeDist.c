@@ -0,0 +1,153 @@
+#include "MazeDist.h"
+#include "Analysis.h"
+#include <assert.h>
+#include <string.h>
+
+#define INDEX(r, c) ((r)*WIDTH + (c))
+
+void md_reset(MazeDistance *md)
+{
+    md->journal = NULL;
+    md->valid   = false;
+}
+
+/* Recomputes all distances with a breadth-first search from every square
+   that has an open wall (early in the game, most squares have none). */
+static void rebuild(MazeDistance *md, const MazeMap *mm)
+{
+    int dist[HEIGHT][WIDTH];
+    int r1, c1, r2, c2, dir;
+    unsigned short *row;
+
+    for (r1 = 0; r1 < HEIGHT; ++r1)
+    {
+        for (c1 = 0; c1 < WIDTH; ++c1)
+        {
+            row = md->dist[INDEX(r1, c1)];
+            for (dir = 0; dir < 4; ++dir)
+                if (WALL(mm, r1, c1, dir) == ABSENT) break;
+            if (dir == 4)
+            {
+                for (r2 = 0; r2 < HEIGHT*WIDTH; ++r2) row[r2] = MD_INFINITY;
+                row[INDEX(r1, c1)] = 0;
+                continue;
+            }
+            find_distance(mm, dist, r1, c1);
+            for (r2 = 0; r2 < HEIGHT; ++r2)
+            {
+                for (c2 = 0; c2 < WIDTH; ++c2)
+                {
+                    *row++ = (dist[r2][c2] < 0) ? MD_INFINITY
+                                                : (unsigned short)dist[r2][c2];
+                }
+            }
+        }
+    }
+}
+
+/* Updates distances after the wall between squares u and v has opened.
+   Distances are symmetric, so only rows u and v need to be scanned. */
+static void open_wall(MazeDistance *md, int u, int v)
+{
+    const unsigned short *du = md->dist[u], *dv = md->dist[v];
+    short near_u[HEIGHT*WIDTH], near_v[HEIGHT*WIDTH];
+    int num_u = 0, num_v = 0, i, j, x, y, d;
+
+    if (du[v] <= 1) return;
+
+    /* Squares closer to u than to v (including u), and vice versa: */
+    for (x = 0; x < HEIGHT*WIDTH; ++x)
+    {
+        if (du[x] + 1 < dv[x]) near_u[num_u++] = (short)x;
+        else
+        if (dv[x] + 1 < du[x]) near_v[num_v++] = (short)x;
+    }
+
+    for (i = 0; i < num_u; ++i)
+    {
+        unsigned short *dx;
+        x  = near_u[i];
+        dx = md->dist[x];
+        for (j = 0; j < num_v; ++j)
+        {
+            y = near_v[j];
+            d = du[x] + 1 + dv[y];
+            if (d < dx[y]) dx[y] = md->dist[y][x] = (unsigned short)d;
+        }
+    }
+}
+
+void md_update(MazeDistance *md, const MazeMap *mm)
+{
+    const MazeJournal *journal = mm->journal;
+    int i, e, r, c;
+
+    if (journal == NULL)
+    {
+        md->valid = false;
+    }
+    else
+    if (journal != md->journal || journal->generation != md->generation)
+    {
+        md->journal    = journal;
+        md->generation = journal->generation;
+        md->pos        = 0;
+    }
+    if (journal != NULL && journal->incomplete) md->valid = false;
+
+    for (i = md->pos; md->valid && i < journal->size; ++i)
+    {
+        e = journal->entry[i];
+        if (JE_KIND(e) == JE_SQUARE || JE_VALUE(e) == PRESENT) continue;
+        if (JE_VALUE(e) == UNKNOWN)
+        {
+            md->valid = false;  /* forgotten */
+            break;
+        }
+        r = JE_ROW(e);
+        c = JE_COL(e);
+        if (JE_KIND(e) == JE_WALL_N)
+            open_wall(md, INDEX(r, c), INDEX((r + HEIGHT - 1)%HEIGHT, c));
+        else
+            open_wall(md, INDEX(r, c), INDEX(r, (c + WIDTH - 1)%WIDTH));
+    }
+
+    if (!md->valid)
+    {
+        rebuild(md, mm);
+        md->valid = journal != NULL;
+    }
+    if (journal != NULL) md->pos = journal->size;
+}
+
+int md_distance(const MazeDistance *md, int r1, int c1, int r2, int c2)
+{
+    const int d = md->dist[INDEX(r1, c1)][INDEX(r2, c2)];
+    return (d == MD_INFINITY) ? -1 : d;
+}
+
+int md_next_dir(const MazeDistance *md, int r1, int c1, int r2, int c2)
+{
+    const unsigned short *to = md->dist[INDEX(r2, c2)];
+    const int from = INDEX(r1, c1), d = to[from];
+    int dir, next;
+
+    if (d == 0 || d == MD_INFINITY) return -1;
+    for (dir = 0; dir < 4; ++dir)
+    {
+        next = INDEX(RDR(r1, dir), CDC(c1, dir));
+        if (md->dist[from][next] == 1 && to[next] == d - 1) return dir;
+    }
+    assert(0);
+    return -1;
+}
+
+void md_find_distance( const MazeDistance *md, int dist[HEIGHT][WIDTH],
+                       int r, int c )
+{
+    const unsigned short *row = md->dist[INDEX(r, c)];
+    int i;
+
+    for (i = 0; i < HEIGHT*WIDTH; ++i)
+        dist[i/WIDTH][i%WIDTH] = (row[i] == MD_INFINITY) ? -1 : row[i];
+}
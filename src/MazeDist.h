@@ -0,0 +1,52 @@
+#ifndef MAZE_DIST_H_INCLUDED
+#define MAZE_DIST_H_INCLUDED
+
+#include "MazeMap.h"
+
+/* All-pairs shortest distances.
+
+   Keeps the distance between every pair of squares, moving only through walls
+   known to be absent (as find_distance() does for a single source). Since
+   walls only ever change from UNKNOWN to known, the graph of open walls only
+   grows, and md_update() only has to process the walls opened since the
+   previous call (as recorded in the map's journal): when a wall between u and
+   v opens, the distance between x and y can only decrease if x is closer to u
+   than to v and y is closer to v than to u, so only those pairs are updated.
+
+   If the map has no journal, or the journal is incomplete or records a wall
+   being forgotten, all distances are recomputed instead. As with mi_infer(),
+   the journal must not be reset between changing the map and calling
+   md_update(), and md_reset() must be called after replacing the map's
+   contents other than through SET_SQUARE/SET_WALL.
+
+   Queries take constant time. The table takes HEIGHT*WIDTH*HEIGHT*WIDTH*2
+   bytes, so instances should be allocated statically or on the heap. */
+
+#define MD_INFINITY 0xffff
+
+typedef struct MazeDistance
+{
+    const MazeJournal   *journal;       /* journal read on the last call */
+    unsigned            generation;     /* generation of `journal' */
+    int                 pos;            /* number of entries processed */
+    bool                valid;          /* dist reflects the map */
+
+    /* Distance between squares (indexed by r*WIDTH + c), or MD_INFINITY: */
+    unsigned short      dist[HEIGHT*WIDTH][HEIGHT*WIDTH];
+} MazeDistance;
+
+extern void md_reset(MazeDistance *md);
+extern void md_update(MazeDistance *md, const MazeMap *mm);
+
+/* Returns the distance from (r1,c1) to (r2,c2), or -1 if unreachable. */
+extern int md_distance(const MazeDistance *md, int r1, int c1, int r2, int c2);
+
+/* Returns the direction of the first move on a shortest path from (r1,c1) to
+   (r2,c2), or -1 if there is none (the squares are equal or disconnected). */
+extern int md_next_dir(const MazeDistance *md, int r1, int c1, int r2, int c2);
+
+/* Fills `dist' exactly as find_distance() would. */
+extern void md_find_distance( const MazeDistance *md, int dist[HEIGHT][WIDTH],
+                              int r, int c );
+
+#endif /* ndef MAZE_DIST_H_INCLUDED */
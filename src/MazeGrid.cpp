@@ -0,0 +1,51 @@
+#include "MazeGrid.hpp"
+
+extern "C"
+{
+#include "MazeGrid.h"
+}
+
+/* The C MazeMap is indexed as grid[r][c], like amaze::MazeMap: */
+static_assert(WIDTH == HEIGHT, "MazeMap.grid is declared [WIDTH][HEIGHT]");
+
+void mmg_look(MazeMap *mm, const char *line, RelDir rel_dir)
+{
+    amaze::look<WIDTH, HEIGHT>(*mm, line, rel_dir);
+}
+
+void mmg_infer(MazeMap *mm)
+{
+    amaze::infer<WIDTH, HEIGHT>(*mm);
+}
+
+void mmg_find_distance(const MazeMap *mm, int dist[HEIGHT][WIDTH],
+                       int r, int c)
+{
+    amaze::find_distance<WIDTH, HEIGHT>(*mm, dist, r, c);
+}
+
+const char *mmg_construct_turn(const MazeMap *mm, int dist[HEIGHT][WIDTH],
+                               int r1, int c1, int dir1, int r2, int c2,
+                               Point path[HEIGHT*WIDTH], int *len)
+{
+    static char turn_buf[HEIGHT*WIDTH];
+    static Point path_buf[HEIGHT*WIDTH];
+
+    return mmg_construct_turn_r( mm, dist, r1, c1, dir1, r2, c2,
+                                 (path == NULL) ? path_buf : path,
+                                 turn_buf, len );
+}
+
+char *mmg_construct_turn_r(const MazeMap *mm, int dist[HEIGHT][WIDTH],
+                           int r1, int c1, int dir1, int r2, int c2,
+                           Point path[HEIGHT*WIDTH], char turn[HEIGHT*WIDTH],
+                           int *len)
+{
+    return amaze::construct_turn_r<WIDTH, HEIGHT>(
+        *mm, dist, r1, c1, dir1, r2, c2, path, turn, len);
+}
+
+void mmg_line_of_sight(const MazeMap *mm, int r, int c, Dir dir, char *buf)
+{
+    amaze::line_of_sight<WIDTH, HEIGHT>(*mm, r, c, dir, buf);
+}
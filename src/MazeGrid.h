@@ -0,0 +1,28 @@
+#ifndef MAZE_GRID_H_INCLUDED
+#define MAZE_GRID_H_INCLUDED
+
+#include "MazeMap.h"
+
+/* The 25x25 instances of the kernels in MazeGrid.hpp. These take the same
+   arguments as (and produce results identical to) their counterparts in
+   MazeMap.c and Analysis.c; mmg_line_of_sight() computes the line of sight
+   from (r,c) in direction `dir' of the fully known maze `mm' into `buf',
+   which must hold at least max(WIDTH, HEIGHT) + 2 chars. */
+
+extern void mmg_look(MazeMap *mm, const char *line, RelDir rel_dir);
+extern void mmg_infer(MazeMap *mm);
+extern void mmg_find_distance( const MazeMap *mm, int dist[HEIGHT][WIDTH],
+                               int r, int c );
+extern const char *mmg_construct_turn( const MazeMap *mm,
+                                       int dist[HEIGHT][WIDTH],
+                                       int r1, int c1, int dir1,
+                                       int r2, int c2,
+                                       Point path[HEIGHT*WIDTH], int *len );
+extern char *mmg_construct_turn_r( const MazeMap *mm, int dist[HEIGHT][WIDTH],
+                                   int r1, int c1, int dir1, int r2, int c2,
+                                   Point path[HEIGHT*WIDTH],
+                                   char turn[HEIGHT*WIDTH], int *len );
+extern void mmg_line_of_sight( const MazeMap *mm, int r, int c, Dir dir,
+                               char *buf );
+
+#endif /* ndef MAZE_GRID_H_INCLUDED */
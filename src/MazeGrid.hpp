@@ -0,0 +1,475 @@
+#ifndef MAZE_GRID_HPP_INCLUDED
+#define MAZE_GRID_HPP_INCLUDED
+
+/* Maze map kernels for compile-time maze dimensions.
+
+   These are the algorithms of MazeMap.c (mm_look, mm_infer), Analysis.c
+   (find_distance, construct_turn_r) and the arbiter's line of sight, written
+   as templates over the maze width W and height H. All wrap-around arithmetic
+   goes through constant neighbour tables, so no division is left in the inner
+   loops. The kernels perform the same steps in the same order as the C code,
+   so they produce identical maps (and journals, and hashes of C MazeMaps).
+   They keep no static state, so they may be used from several threads at
+   once.
+
+   The kernels work on any map type with the members of MazeMap (grid, loc,
+   dir, border, journal); amaze::MazeMap<W,H> is such a type for arbitrary
+   dimensions, and the C MazeMap is the 25x25 instance exported by
+   MazeGrid.cpp (see MazeGrid.h). */
+
+extern "C"
+{
+#include "MazeMap.h"
+}
+
+#include <cassert>
+#include <cstring>
+
+namespace amaze
+{
+
+template<int W, int H>
+struct MazeMap
+{
+    MazeCell    grid[H][W];
+    Point       loc;
+    Dir         dir;
+    Rect        border;
+    MazeJournal *journal;
+};
+
+/* Neighbour tables: step_r[dir][r] == RDR(r, dir), step_c[dir][c] ==
+   CDC(c, dir), and turn[dir][rel_dir] == TURN(dir, rel_dir). */
+template<int W, int H>
+struct Torus
+{
+    int step_r[4][H], step_c[4][W];
+    Dir turn[4][4];
+
+    constexpr Torus() : step_r(), step_c(), turn()
+    {
+        const int dr[4] = { -1,  0, +1,  0 }, dc[4] = {  0, +1,  0, -1 };
+        for (int dir = 0; dir < 4; ++dir)
+        {
+            for (int r = 0; r < H; ++r) step_r[dir][r] = (r + dr[dir] + H)%H;
+            for (int c = 0; c < W; ++c) step_c[dir][c] = (c + dc[dir] + W)%W;
+            for (int rel = 0; rel < 4; ++rel)
+                turn[dir][rel] = Dir((dir + rel)%4);
+        }
+    }
+};
+
+template<int W, int H>
+constexpr Torus<W, H> torus = Torus<W, H>();
+
+template<int W, int H, class Map>
+int get_wall(const Map &mm, int r, int c, int dir)
+{
+    switch (dir)
+    {
+    case NORTH: return mm.grid[r][c].wall_n;
+    case SOUTH: return mm.grid[torus<W, H>.step_r[SOUTH][r]][c].wall_n;
+    case WEST:  return mm.grid[r][c].wall_w;
+    default:    return mm.grid[r][torus<W, H>.step_c[EAST][c]].wall_w;
+    }
+}
+
+template<int W, int H>
+void journal_add(MazeJournal *journal, int kind, int r, int c, int val)
+{
+    if (W*H <= 1024 && journal->size < MAX_JOURNAL)
+    {
+        journal->entry[journal->size++] =
+            (unsigned short)(kind << 12 | (val + 1) << 10 | (r*W + c));
+    }
+    else
+    {
+        journal->incomplete = true;
+    }
+}
+
+/* Hash updates: amaze::MazeMap has no hash, while the hash of the C MazeMap
+   changes by the same keys as in MazeMap.c. */
+template<class Map>
+void rehash_cell(Map &, int, int, int, int, int)
+{
+}
+
+template<class Map>
+void rehash_border(Map &, int, int, int)
+{
+}
+
+inline void rehash_cell(::MazeMap &mm, int kind, int r, int c, int old_val,
+                        int val)
+{
+    mm.hash ^= mm_cell_key(kind, r, c, old_val) ^ mm_cell_key(kind, r, c, val);
+}
+
+inline void rehash_border(::MazeMap &mm, int side, int old_val, int val)
+{
+    mm.hash ^= mm_border_key(side, old_val) ^ mm_border_key(side, val);
+}
+
+template<int W, int H, class Map>
+void set_wall(Map &mm, int r, int c, int dir, int val)
+{
+    MazeCell *cell;
+    if ((dir&1) == 0)  /* north/south */
+    {
+        if (dir == SOUTH) r = torus<W, H>.step_r[SOUTH][r];
+        cell = &mm.grid[r][c];
+        if (cell->wall_n == val) return;
+        if (mm.journal != NULL)
+            journal_add<W, H>(mm.journal, JE_WALL_N, r, c, val);
+        rehash_cell(mm, JE_WALL_N, r, c, cell->wall_n, val);
+        cell->wall_n = val;
+    }
+    else  /* east/west */
+    {
+        if (dir == EAST) c = torus<W, H>.step_c[EAST][c];
+        cell = &mm.grid[r][c];
+        if (cell->wall_w == val) return;
+        if (mm.journal != NULL)
+            journal_add<W, H>(mm.journal, JE_WALL_W, r, c, val);
+        rehash_cell(mm, JE_WALL_W, r, c, cell->wall_w, val);
+        cell->wall_w = val;
+    }
+}
+
+template<int W, int H, class Map>
+void set_square(Map &mm, int r, int c, int val)
+{
+    if (mm.grid[r][c].square == val) return;
+    if (mm.journal != NULL)
+        journal_add<W, H>(mm.journal, JE_SQUARE, r, c, val);
+    rehash_cell(mm, JE_SQUARE, r, c, mm.grid[r][c].square, val);
+    mm.grid[r][c].square = val;
+}
+
+/* Moves the border on `side' (numbered as in Rect) to `val': */
+template<class Map>
+void set_border(Map &mm, int side, int &edge, int val)
+{
+    rehash_border(mm, side, edge, val);
+    edge = val;
+}
+
+template<int W, int H, class Map>
+void push_border(Map &mm, int r, int c, int dir)
+{
+    const Torus<W, H> &t = torus<W, H>;
+    switch (dir)
+    {
+    case NORTH:
+        if (r == mm.border.top)
+            set_border(mm, 0, mm.border.top, t.step_r[NORTH][mm.border.top]);
+        break;
+    case EAST:
+        if (t.step_c[EAST][c] == mm.border.right)
+            set_border(mm, 1, mm.border.right,
+                       t.step_c[EAST][mm.border.right]);
+        break;
+    case SOUTH:
+        if (t.step_r[SOUTH][r] == mm.border.bottom)
+            set_border(mm, 2, mm.border.bottom,
+                       t.step_r[SOUTH][mm.border.bottom]);
+        break;
+    case WEST:
+        if (c == mm.border.left)
+            set_border(mm, 3, mm.border.left, t.step_c[WEST][mm.border.left]);
+        break;
+    }
+}
+
+template<int W, int H, class Map>
+void look(Map &mm, const char *line, RelDir rel_dir)
+{
+    const Torus<W, H> &t = torus<W, H>;
+    const int front = t.turn[mm.dir][rel_dir],
+              left  = t.turn[front][LEFT],
+              right = t.turn[front][RIGHT],
+              back  = t.turn[front][BACK];
+    int r = mm.loc.r, c = mm.loc.c;
+
+    while (*line)
+    {
+        bool open_left = false, open_right = false;
+        switch (*line++)
+        {
+        case 'B': open_left = open_right = true; break;
+        case 'L': open_left = true; break;
+        case 'R': open_right = true; break;
+        case 'N': break;
+        case 'W':
+            set_wall<W, H>(mm, r, c, front, PRESENT);
+            assert(*line == '\0');
+            return;
+        default:
+            assert(0);
+        }
+
+        push_border<W, H>(mm, r, c, front);
+        r = t.step_r[front][r];
+        c = t.step_c[front][c];
+
+        set_square<W, H>(mm, r, c, PRESENT);
+        set_wall<W, H>(mm, r, c, back, ABSENT);
+        set_wall<W, H>(mm, r, c, left, open_left ? ABSENT : PRESENT);
+        set_wall<W, H>(mm, r, c, right, open_right ? ABSENT : PRESENT);
+
+        if (open_left)
+        {
+            set_square<W, H>(mm, t.step_r[left][r], t.step_c[left][c],
+                             PRESENT);
+            push_border<W, H>(mm, r, c, left);
+        }
+        if (open_right)
+        {
+            set_square<W, H>(mm, t.step_r[right][r], t.step_c[right][c],
+                             PRESENT);
+            push_border<W, H>(mm, r, c, right);
+        }
+    }
+    assert(0);  /* every line must end with W */
+}
+
+template<int W, int H, class Map>
+bool mark_dead_end(Map &mm, bool dead_end[H][W], int r, int c)
+{
+    const Torus<W, H> &t = torus<W, H>;
+    int num_walls = 0, num_dead_adjacent = 0;
+    bool changed = false;
+
+    if (dead_end[r][c]) return false;
+
+    for (int dir = 0; dir < 4; ++dir)
+    {
+        int w = get_wall<W, H>(mm, r, c, dir);
+        if (w == PRESENT)
+            ++num_walls;
+        else
+        if (w == ABSENT && dead_end[t.step_r[dir][r]][t.step_c[dir][c]])
+            ++num_dead_adjacent;
+    }
+    assert(num_walls + num_dead_adjacent < 4);
+
+    if (num_walls + num_dead_adjacent == 3)
+    {
+        dead_end[r][c] = true;
+        if (mm.grid[r][c].square == UNKNOWN)
+        {
+            set_square<W, H>(mm, r, c, PRESENT);
+            changed = true;
+        }
+        for (int dir = 0; dir < 4; ++dir)
+        {
+            if (get_wall<W, H>(mm, r, c, dir) == UNKNOWN)
+            {
+                set_wall<W, H>(mm, r, c, dir, ABSENT);
+                changed = true;
+            }
+        }
+        for (int dir = 0; dir < 4; ++dir)
+        {
+            if (get_wall<W, H>(mm, r, c, dir) == ABSENT &&
+                mark_dead_end<W, H>(mm, dead_end,
+                                    t.step_r[dir][r], t.step_c[dir][c]))
+                changed = true;
+        }
+    }
+    return changed;
+}
+
+/* See mm_infer() for a description of the rules. */
+template<int W, int H, class Map>
+void infer(Map &mm)
+{
+    const Torus<W, H> &t = torus<W, H>;
+    bool changed, dead_end[H][W];
+
+    do {
+        changed = false;
+
+        std::memset(dead_end, 0, sizeof(dead_end));
+        for (int r = 0; r < H; ++r)
+        {
+            for (int c = 0; c < W; ++c)
+            {
+                if (mark_dead_end<W, H>(mm, dead_end, r, c))
+                    changed = true;
+            }
+        }
+
+        for (int r = 0; r < H; ++r)
+        {
+            const int r1 = t.step_r[SOUTH][r];
+            for (int c = 0; c < W; ++c)
+            {
+                const int c1 = t.step_c[EAST][c];
+                const int n = mm.grid[r ][c1].wall_w,
+                          e = mm.grid[r1][c1].wall_n,
+                          s = mm.grid[r1][c1].wall_w,
+                          w = mm.grid[r1][c ].wall_n;
+                const int na = (n == ABSENT) + (e == ABSENT) +
+                               (s == ABSENT) + (w == ABSENT);
+                assert(na <= 3);
+                if (na != 3) continue;
+                if (n == UNKNOWN)
+                    set_wall<W, H>(mm, r , c1, WEST, PRESENT);
+                else
+                if (e == UNKNOWN)
+                    set_wall<W, H>(mm, r1, c1, NORTH, PRESENT);
+                else
+                if (s == UNKNOWN)
+                    set_wall<W, H>(mm, r1, c1, WEST, PRESENT);
+                else
+                if (w == UNKNOWN)
+                    set_wall<W, H>(mm, r1, c , NORTH, PRESENT);
+                else
+                    continue;
+                changed = true;
+            }
+        }
+
+        if (mm.border.left == mm.border.right)
+        {
+            for (int r = 0; r < H; ++r)
+            {
+                if (mm.grid[r][mm.border.left].wall_w != PRESENT)
+                {
+                    assert(mm.grid[r][mm.border.left].wall_w == UNKNOWN);
+                    set_wall<W, H>(mm, r, mm.border.left, WEST, PRESENT);
+                    changed = true;
+                }
+            }
+        }
+
+        if (mm.border.top == mm.border.bottom)
+        {
+            for (int c = 0; c < W; ++c)
+            {
+                if (mm.grid[mm.border.top][c].wall_n != PRESENT)
+                {
+                    assert(mm.grid[mm.border.top][c].wall_n == UNKNOWN);
+                    set_wall<W, H>(mm, mm.border.top, c, NORTH, PRESENT);
+                    changed = true;
+                }
+            }
+        }
+    } while (changed);
+}
+
+template<int W, int H, class Map>
+void find_distance(const Map &mm, int dist[H][W], int r, int c)
+{
+    const Torus<W, H> &t = torus<W, H>;
+    Point queue[H*W];
+    int pos = 0, end = 0;
+
+    std::memset(dist, -1, sizeof(int)*H*W);
+    dist[r][c] = 0;
+    for (;;)
+    {
+        for (int dir = 0; dir < 4; ++dir)
+        {
+            if (get_wall<W, H>(mm, r, c, dir) == ABSENT)
+            {
+                const int nr = t.step_r[dir][r], nc = t.step_c[dir][c];
+                if (dist[nr][nc] == -1)
+                {
+                    dist[nr][nc] = dist[r][c] + 1;
+                    queue[end].r = nr;
+                    queue[end].c = nc;
+                    ++end;
+                }
+            }
+        }
+        if (pos == end) break;
+        r = queue[pos].r;
+        c = queue[pos].c;
+        ++pos;
+    }
+}
+
+/* Writes the path and turn to the given buffers, like construct_turn_r() in
+   Analysis.c (so it keeps no state between calls). */
+template<int W, int H, class Map>
+char *construct_turn_r(const Map &mm, int dist[H][W], int r1, int c1,
+                       int dir1, int r2, int c2, Point loc[H*W],
+                       char turn_buf[H*W], int *len_out)
+{
+    const Torus<W, H> &t = torus<W, H>;
+    int pos, len, dir;
+
+    loc[0].r = r1, loc[0].c = c1;
+    len = dist[r2][c2];
+    if (len_out != NULL) *len_out = len;
+    for (pos = len; pos > 0; --pos)
+    {
+        loc[pos].r = r2, loc[pos].c = c2;
+        for (dir = 0; dir < 4; ++dir)
+        {
+            if (get_wall<W, H>(mm, r2, c2, dir) == ABSENT)
+            {
+                const int nr = t.step_r[dir][r2], nc = t.step_c[dir][c2];
+                if (dist[nr][nc] == pos - 1)
+                {
+                    r2 = nr, c2 = nc;
+                    break;
+                }
+            }
+        }
+        assert(dir < 4);
+    }
+    assert(r1 == r2 && c1 == c2);
+
+    dir = dir1;
+    for (pos = 0; pos < len; ++pos)
+    {
+        int rel_dir;
+        for (rel_dir = 0; rel_dir < 4; ++rel_dir)
+        {
+            const int ndir = t.turn[dir][rel_dir];
+            if (t.step_r[ndir][loc[pos].r] == loc[pos + 1].r &&
+                t.step_c[ndir][loc[pos].c] == loc[pos + 1].c)
+            {
+                dir = ndir;
+                break;
+            }
+        }
+        assert(rel_dir < 4);
+        turn_buf[pos] = "FRTL"[rel_dir];
+    }
+    turn_buf[pos] = '\0';
+    return turn_buf;
+}
+
+/* Writes the line of sight from square (r,c) in direction `front' of the
+   (fully known) maze `mm' to `buf', which must hold max(W, H) + 2 chars. */
+template<int W, int H, class Map>
+void line_of_sight(const Map &mm, int r, int c, int front, char *buf)
+{
+    const Torus<W, H> &t = torus<W, H>;
+    const int left = t.turn[front][LEFT], right = t.turn[front][RIGHT];
+    char *p = buf;
+
+    while (get_wall<W, H>(mm, r, c, front) == ABSENT)
+    {
+        r = t.step_r[front][r];
+        c = t.step_c[front][c];
+        const bool open_left  = get_wall<W, H>(mm, r, c, left)  == ABSENT,
+                   open_right = get_wall<W, H>(mm, r, c, right) == ABSENT;
+        if (open_left)
+            *p++ = open_right ? 'B' : 'L';
+        else
+            *p++ = open_right ? 'R' : 'N';
+        assert(p < buf + (W > H ? W : H) + 1);
+    }
+    *p++ = 'W';
+    *p   = '\0';
+}
+
+}  /* namespace amaze */
+
+#endif /* ndef MAZE_GRID_HPP_INCLUDED */
@@ -33,13 +33,35 @@ static int ver_walls_width(const char *line)
     return i/2;
 }
 
-bool mm_scan(MazeMap *mm, FILE *fp)
+/* Source of lines for scan(): a file, or (if `fp' is NULL) a string. */
+typedef struct LineSource
+{
+    FILE        *fp;
+    const char  *text;
+} LineSource;
+
+static char *next_line(LineSource *src, char line[512])
+{
+    size_t len;
+
+    if (src->fp != NULL) return fgets(line, 512, src->fp);
+    if (*src->text == '\0') return NULL;
+    len = strcspn(src->text, "\n");
+    if (src->text[len] == '\n') ++len;
+    if (len > 511) len = 511;
+    memcpy(line, src->text, len);
+    line[len] = '\0';
+    src->text += len;
+    return line;
+}
+
+static bool scan(MazeMap *mm, LineSource *src)
 {
     char line[512];
     int W, H, n;
 
     /* Read first line to determine grid width */
-    if (fgets(line, sizeof(line), fp) == NULL)
+    if (next_line(src, line) == NULL)
         return false;
     W = hor_walls_width(line);
     if (W < 1) return false;
@@ -66,7 +88,7 @@ bool mm_scan(MazeMap *mm, FILE *fp)
         }
 
         /* Read next line (unless we're at the end of input) */
-        if (H == HEIGHT || fgets(line, sizeof(line), fp) == NULL ||
+        if (H == HEIGHT || next_line(src, line) == NULL ||
             ver_walls_width(line) < W) break;
 
         /* Parse vertical walls and squares */
@@ -103,7 +125,7 @@ bool mm_scan(MazeMap *mm, FILE *fp)
         }
 
         /* Read next line */
-        if (fgets(line, sizeof(line), fp) == NULL)
+        if (next_line(src, line) == NULL)
             return false;
     }
     if (H < 1) return false;
@@ -113,11 +135,41 @@ bool mm_scan(MazeMap *mm, FILE *fp)
     mm->border.left   = 0;
     mm->border.bottom = H%HEIGHT;
     mm->border.right  = W%WIDTH;
+    return true;
+}
+
+bool mm_scan(MazeMap *mm, FILE *fp)
+{
+    LineSource src;
+    src.fp   = fp;
+    src.text = NULL;
+    if (!scan(mm, &src)) return false;
+    mm_rehash(mm);
+    return true;
+}
 
+bool mm_parse(MazeMap *mm, const char *text)
+{
+    if (!mm_parse_unhashed(mm, text)) return false;
+    mm_rehash(mm);
     return true;
 }
 
+bool mm_parse_unhashed(MazeMap *mm, const char *text)
+{
+    LineSource src;
+    src.fp   = NULL;
+    src.text = text;
+    return scan(mm, &src);
+}
+
 void mm_print(MazeMap *mm, FILE *fp, bool full)
+{
+    char buf[MM_PRINT_SIZE];
+    fputs(mm_print_r(mm, full, buf), fp);
+}
+
+char *mm_print_r(const MazeMap *mm, bool full, char buf[MM_PRINT_SIZE])
 {
     const int top    = full ? 0 : mm->border.top;
     const int left   = full ? 0 : mm->border.left;
@@ -126,6 +178,7 @@ void mm_print(MazeMap *mm, FILE *fp, bool full)
     const int h = (bottom == top) ? HEIGHT : (bottom - top + HEIGHT)%HEIGHT;
     const int w = (right == left) ? WIDTH : (right - left + WIDTH)%WIDTH;
 
+    char *p = buf;
     int r, c, i, j, v;
 
     for (i = 0; i < h; ++i)
@@ -134,39 +187,39 @@ void mm_print(MazeMap *mm, FILE *fp, bool full)
         for (j = 0; j < w; ++j)
         {
             c = (left + j)%WIDTH;
-            fputc('+', fp);
-            v = WALL(mm, r, c, NORTH);
-            fputc(v == PRESENT ? '-' : v == ABSENT ? ' ' : '?', fp);
+            *p++ = '+';
+            v = mm->grid[r][c].wall_n;
+            *p++ = v == PRESENT ? '-' : v == ABSENT ? ' ' : '?';
         }
-        fputc('+', fp);
-        fputc('\n', fp);
+        *p++ = '+';
+        *p++ = '\n';
         for (j = 0; j < w; ++j)
         {
             c = (left + j)%WIDTH;
-            v = WALL(mm, r, c, WEST);
-            fputc(v == PRESENT ? '|' : v == ABSENT ? ' ' : '?', fp);
+            v = mm->grid[r][c].wall_w;
+            *p++ = v == PRESENT ? '|' : v == ABSENT ? ' ' : '?';
             v = SQUARE(mm, r, c);
             if (r == mm->loc.r && c == mm->loc.c)
             {
                 switch (mm->dir)
                 {
-                case NORTH: fputc('^', fp); break;
-                case EAST:  fputc('>', fp); break;
-                case SOUTH: fputc('v', fp); break;
-                case WEST:  fputc('<', fp); break;
+                case NORTH: *p++ = '^'; break;
+                case EAST:  *p++ = '>'; break;
+                case SOUTH: *p++ = 'v'; break;
+                case WEST:  *p++ = '<'; break;
                 default: assert(0);
                 }
             }
             else
             {
                 assert(v != ABSENT);
-                fputc(v == PRESENT ? ' ' : '?', fp);
+                *p++ = v == PRESENT ? ' ' : '?';
             }
         }
         c = (left + j)%WIDTH;
-        v = WALL(mm, r, c, WEST);
-        fputc(v == PRESENT ? '|' : v == ABSENT ? ' ' : '?', fp);
-        fputc('\n', fp);
+        v = mm->grid[r][c].wall_w;
+        *p++ = v == PRESENT ? '|' : v == ABSENT ? ' ' : '?';
+        *p++ = '\n';
     }
 
     /* Line 2r */
@@ -174,106 +227,170 @@ void mm_print(MazeMap *mm, FILE *fp, bool full)
     for (j = 0; j < w; ++j)
     {
         c = (left + j)%WIDTH;
-        fputc('+', fp);
-        v = WALL(mm, r, c, NORTH);
-        fputc(v == PRESENT ? '-' : v == ABSENT ? ' ' : '?', fp);
+        *p++ = '+';
+        v = mm->grid[r][c].wall_n;
+        *p++ = v == PRESENT ? '-' : v == ABSENT ? ' ' : '?';
     }
-    fputc('+', fp);
-    fputc('\n', fp);
+    *p++ = '+';
+    *p++ = '\n';
+    *p   = '\0';
+    return buf;
 }
 
+/* Compact encoding (see doc/maze-encoding.txt). Walls are encoded as base-3
+   digits (trits), 15 to a group of four base-64 digits; each group is
+   converted through three blocks of five trits, which trit_block[] expands
+   for decoding. */
+
+#define TRITS_PER_GROUP 15
+#define MAX_WALLS ((HEIGHT + 1)*WIDTH + HEIGHT*(WIDTH + 1))
+
+static const char base64_digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdef"
+                                    "ghijklmnopqrstuvwxyz0123456789-_";
+
+/* Value plus one of each base-64 digit, indexed by character (0 for
+   characters that are not digits): */
+static const unsigned char base64_values[256] = {
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,
+    53, 54, 55, 56, 57, 58, 59, 60, 61, 62,  0,  0,  0,  0,  0,  0,
+     0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26,  0,  0,  0,  0, 64,
+     0, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41,
+    42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52,  0,  0,  0,  0,  0 };
+
+/* Trits of each block of five, least-significant first: */
+static const char trit_block[243][6] = {
+    "00000", "10000", "20000", "01000", "11000", "21000", "02000", "12000",
+    "22000", "00100", "10100", "20100", "01100", "11100", "21100", "02100",
+    "12100", "22100", "00200", "10200", "20200", "01200", "11200", "21200",
+    "02200", "12200", "22200", "00010", "10010", "20010", "01010", "11010",
+    "21010", "02010", "12010", "22010", "00110", "10110", "20110", "01110",
+    "11110", "21110", "02110", "12110", "22110", "00210", "10210", "20210",
+    "01210", "11210", "21210", "02210", "12210", "22210", "00020", "10020",
+    "20020", "01020", "11020", "21020", "02020", "12020", "22020", "00120",
+    "10120", "20120", "01120", "11120", "21120", "02120", "12120", "22120",
+    "00220", "10220", "20220", "01220", "11220", "21220", "02220", "12220",
+    "22220", "00001", "10001", "20001", "01001", "11001", "21001", "02001",
+    "12001", "22001", "00101", "10101", "20101", "01101", "11101", "21101",
+    "02101", "12101", "22101", "00201", "10201", "20201", "01201", "11201",
+    "21201", "02201", "12201", "22201", "00011", "10011", "20011", "01011",
+    "11011", "21011", "02011", "12011", "22011", "00111", "10111", "20111",
+    "01111", "11111", "21111", "02111", "12111", "22111", "00211", "10211",
+    "20211", "01211", "11211", "21211", "02211", "12211", "22211", "00021",
+    "10021", "20021", "01021", "11021", "21021", "02021", "12021", "22021",
+    "00121", "10121", "20121", "01121", "11121", "21121", "02121", "12121",
+    "22121", "00221", "10221", "20221", "01221", "11221", "21221", "02221",
+    "12221", "22221", "00002", "10002", "20002", "01002", "11002", "21002",
+    "02002", "12002", "22002", "00102", "10102", "20102", "01102", "11102",
+    "21102", "02102", "12102", "22102", "00202", "10202", "20202", "01202",
+    "11202", "21202", "02202", "12202", "22202", "00012", "10012", "20012",
+    "01012", "11012", "21012", "02012", "12012", "22012", "00112", "10112",
+    "20112", "01112", "11112", "21112", "02112", "12112", "22112", "00212",
+    "10212", "20212", "01212", "11212", "21212", "02212", "12212", "22212",
+    "00022", "10022", "20022", "01022", "11022", "21022", "02022", "12022",
+    "22022", "00122", "10122", "20122", "01122", "11122", "21122", "02122",
+    "12122", "22122", "00222", "10222", "20222", "01222", "11222", "21222",
+    "02222", "12222", "22222" };
+
 bool mm_decode(MazeMap *mm, const char *desc)
 {
-    char buf[512], *p;
-    int H, W, r, c, val, len, pass;
+    if (!mm_decode_unhashed(mm, desc)) return false;
+    mm_rehash(mm);
+    return true;
+}
 
-    /* decode base-64 chars (into integers in range [0,64)) */
-    strncpy(buf, desc, sizeof(buf) - 1);
-    buf[sizeof(buf) - 1] = '\0';
-    for (p = buf; *p; ++p)
+bool mm_decode_unhashed(MazeMap *mm, const char *desc)
+{
+    unsigned char digit[MM_ENCODE_SIZE];
+    char square[HEIGHT*WIDTH], trits[MAX_WALLS + TRITS_PER_GROUP];
+    const char *north, *west;
+    int H, W, r, c, i, n, len, val, rows, cols, rn, cw;
+
+    /* Look up the digits' values (as many as fit in a buffer); digits past
+       the end count as zeroes, since trailing zeroes may be omitted. */
+    for (len = 0; desc[len] != '\0' && len < MM_ENCODE_SIZE - 1; ++len)
     {
-        if (*p >= 'A' && *p <= 'Z') *p = *p - 'A' +  0;
-        else
-        if (*p >= 'a' && *p <= 'z') *p = *p - 'a' + 26;
-        else
-        if (*p >= '0' && *p <= '9') *p = *p - '0' + 52;
-        else
-        if (*p == '-')              *p =            62;
-        else
-        if (*p == '_')              *p =            63;
-        else
+        if ((val = base64_values[(unsigned char)desc[len]]) == 0)
             return false;  /* invalid char */
+        digit[len] = val - 1;
     }
+    memset(digit + len, 0, sizeof(digit) - len);
 
     /* Parse first five fields */
     mm_clear(mm);
-    H = buf[0];
-    W = buf[1];
+    H = digit[0];
+    W = digit[1];
     if (H > HEIGHT) return false;
     if (W > WIDTH)  return false;
     mm->border.top    = 0;
     mm->border.left   = 0;
     mm->border.bottom = H%HEIGHT;
     mm->border.right  = W%WIDTH;
-    if (buf[2] && buf[3]) {
-        mm->loc.r = buf[2] - 1;
-        mm->loc.c = buf[3] - 1;
+    if (digit[2] && digit[3]) {
+        mm->loc.r = digit[2] - 1;
+        mm->loc.c = digit[3] - 1;
     }
     if (mm->loc.r >= H) return false;
     if (mm->loc.c >= W) return false;
-    mm->dir = (Dir)(buf[4]&3);
-    p = &buf[5];
+    mm->dir = (Dir)(digit[4]&3);
+    i = 5;
 
-    /* Parse squares */
-    val = len = 0;
-    for (r = 0; r < H; ++r)
+    /* Expand the squares' bits, then the walls' trits (a group at a time) */
+    for (n = 0; n < H*W; n += 6, ++i)
     {
-        for (c = 0; c < W; ++c)
-        {
-            if (len == 0)
-            {
-                val = *p++;
-                len = 6;
-            }
-            mm->grid[r][c].square = (val%2) ? PRESENT : UNKNOWN;
-            val /= 2;
-            --len;
-        }
+        val = digit[i];
+        for (c = 0; c < 6 && n + c < H*W; ++c, val >>= 1)
+            square[n + c] = (val&1) ? PRESENT : UNKNOWN;
     }
-
-    /* Parse walls */
-    val = len = 0;
-    for (pass = 0; pass < 2; ++pass)
+    n = (H + 1)*W + H*(W + 1);
+    for (r = 0; r < n; r += TRITS_PER_GROUP, i += 4)
     {
-        for (r = 0; r < H + (pass == 0 ? 1 : 0); ++r)
+        val = digit[i] | digit[i + 1] << 6 | digit[i + 2] << 12 |
+              digit[i + 3] << 18;
+        memcpy(trits + r,      trit_block[val%243], 5);
+        memcpy(trits + r + 5,  trit_block[val/243%243], 5);
+        memcpy(trits + r + 10, trit_block[val/(243*243)%243], 5);
+    }
+    north = trits;
+    west  = trits + (H + 1)*W;
+
+    /* Store each cell once. Row H holds only north walls, and column W only
+       west walls; if they lie on the map's edge, they wrap around to row or
+       column 0 (and take precedence over its own walls). */
+    rows = (H < HEIGHT) ? H + 1 : H;
+    cols = (W < WIDTH)  ? W + 1 : W;
+    for (r = 0; r < rows; ++r)
+    {
+        rn = (r == 0 && H == HEIGHT) ? H : r;
+        for (c = 0; c < cols; ++c)
         {
-            for (c = 0; c < W + (pass == 0 ? 0 : 1); ++c)
-            {
-                if (len == 0)
-                {
-                    val = p[0] + 64*p[1] + 64*64*p[2] + 64*64*64*p[3];
-                    p += 4;
-                    len = 15;
-                }
-
-                if (pass == 0)
-                    mm->grid[r%HEIGHT][c].wall_n = val%3 - 1;
-                else /* pass == 1 */
-                    mm->grid[r][c%WIDTH].wall_w = val%3 - 1;
-
-                val /= 3;
-                --len;
-            }
+            MazeCell cell;
+            cw = (c == 0 && W == WIDTH) ? W : c;
+            cell.square = (r < H && c < W) ? square[r*W + c] : UNKNOWN;
+            cell.wall_n = (c < W) ? north[rn*W + c] - '1' : UNKNOWN;
+            cell.wall_w = (r < H) ? west[r*(W + 1) + cw] - '1' : UNKNOWN;
+            mm->grid[r][c] = cell;
         }
     }
-
     return true;
 }
 
 const char *mm_encode(MazeMap *mm, bool full)
 {
-    static char buf[512];
+    static char buf[MM_ENCODE_SIZE];
+    return mm_encode_r(mm, full, buf);
+}
 
+/* Returns the value of five trits, least-significant first: */
+static int block_value(const char *t)
+{
+    return t[0] + 3*(t[1] + 3*(t[2] + 3*(t[3] + 3*t[4])));
+}
+
+char *mm_encode_r(const MazeMap *mm, bool full, char buf[MM_ENCODE_SIZE])
+{
     const int top    = full ? 0 : mm->border.top;
     const int left   = full ? 0 : mm->border.left;
     const int bottom = full ? 0 : mm->border.bottom;
@@ -282,15 +399,13 @@ const char *mm_encode(MazeMap *mm, bool full)
     const int h = (bottom == top) ? HEIGHT : (bottom - top + HEIGHT)%HEIGHT;
     const int w = (right == left) ? WIDTH : (right - left + WIDTH)%WIDTH;
 
-    char *p = buf;
-    int val, len, r, c, i, j, pass, n;
-
-    static const char *base64_digits = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdef"
-                                       "ghijklmnopqrstuvwxyz0123456789-_";
-
-    static const int pow3[15] = { 1, 3, 9, 27, 81, 243, 729, 2187, 6561, 19683,
-                                  59049, 177147, 531441, 1594323, 4782969 };
+    char trits[MAX_WALLS + TRITS_PER_GROUP], *t, *p = buf;
+    int row[HEIGHT + 1], col[WIDTH + 1];
+    int val, len, i, j, n;
 
+    /* Rows and columns of the map, in order */
+    for (i = 0; i <= h; ++i) row[i] = (top + i)%HEIGHT;
+    for (j = 0; j <= w; ++j) col[j] = (left + j)%WIDTH;
 
     /* Encode first five fields: */
     *p++ = base64_digits[h];
@@ -303,11 +418,10 @@ const char *mm_encode(MazeMap *mm, bool full)
     val = len = 0;
     for (i = 0; i < h; ++i)
     {
+        const MazeCell *cells = mm->grid[row[i]];
         for (j = 0; j < w; ++j)
         {
-            r = (top  + i)%HEIGHT;
-            c = (left + j)%WIDTH;
-            val |= SQUARE(mm, r, c) << len++;
+            val |= cells[col[j]].square << len++;
             if (len == 6)
             {
                 *p++ = base64_digits[val];
@@ -319,37 +433,38 @@ const char *mm_encode(MazeMap *mm, bool full)
     if (len > 0)
         *p++ = base64_digits[val];
 
-    /* Encode walls */
-    val = len = 0;
-    for (pass = 0; pass < 2; ++pass)
+    /* Collect the walls' trits: horizontal walls, then vertical walls */
+    t = trits;
+    for (i = 0; i <= h; ++i)
     {
-        for (i = 0; i < h + (pass ? 0 : 1); ++i)
-        {
-            for (j = 0; j < w + (pass ? 1 : 0); ++j)
-            {
-                r = (top  + i)%HEIGHT;
-                c = (left + j)%WIDTH;
-                if (pass == 0)  /* horizontal walls */
-                    val += pow3[len++]*(mm->grid[r][c].wall_n + 1);
-                else  /* pass == 1: vertical walls */
-                    val += pow3[len++]*(mm->grid[r][c].wall_w + 1);
-                if (len == 15)
-                {
-                    for (n = 0; n < 4; ++n)
-                    {
-                        *p++ = base64_digits[val%64];
-                        val /= 64;
-                    }
-                    assert(val == 0);
-                    len = 0;
-                }
-            }
-        }
+        const MazeCell *cells = mm->grid[row[i]];
+        for (j = 0; j < w; ++j) *t++ = cells[col[j]].wall_n + 1;
     }
-    while (val > 0)
+    for (i = 0; i < h; ++i)
     {
-        *p++ = base64_digits[val%64];
-        val /= 64;
+        const MazeCell *cells = mm->grid[row[i]];
+        for (j = 0; j <= w; ++j) *t++ = cells[col[j]].wall_w + 1;
+    }
+    n = t - trits;
+    memset(t, 0, TRITS_PER_GROUP);
+
+    /* Encode walls; the last group (if incomplete) omits leading zeroes */
+    for (t = trits; t < trits + n; t += TRITS_PER_GROUP)
+    {
+        val = block_value(t) + 243*block_value(t + 5) +
+              243*243*block_value(t + 10);
+        if (t + TRITS_PER_GROUP <= trits + n)
+        {
+            p[0] = base64_digits[val&63];
+            p[1] = base64_digits[(val >> 6)&63];
+            p[2] = base64_digits[(val >> 12)&63];
+            p[3] = base64_digits[val >> 18];
+            p += 4;
+        }
+        else
+        {
+            for ( ; val > 0; val >>= 6) *p++ = base64_digits[val&63];
+        }
     }
 
     *p = '\0';
@@ -3,12 +3,32 @@
 
 #include "MazeMap.h"
 
-/* Read/write a map in a human-readable plain-text format: */
+/* Read/write a map in a human-readable plain-text format. mm_parse() reads
+   from a string; mm_print_r() writes to `buf' (which must hold MM_PRINT_SIZE
+   chars) and returns it.
+
+   The _unhashed variants of mm_parse() and mm_decode() don't compute the
+   map's hash, which takes longer than reading it; they suit callers that
+   only convert or print the map (mm_rehash() must be called before its hash
+   is used). */
+#define MM_PRINT_SIZE ((2*HEIGHT + 1)*(2*WIDTH + 2) + 1)
+
 extern bool mm_scan(MazeMap *mm, FILE *fp);
+extern bool mm_parse(MazeMap *mm, const char *text);
+extern bool mm_parse_unhashed(MazeMap *mm, const char *text);
 extern void mm_print(MazeMap *mm, FILE *fp, bool full);
+extern char *mm_print_r(const MazeMap *mm, bool full,
+                        char buf[MM_PRINT_SIZE]);
+
+/* Encode/decode map in a compact URL-safe non-human-readable format.
+   mm_encode() returns a static buffer; mm_encode_r() writes to `buf'
+   (which must hold MM_ENCODE_SIZE chars) and returns it. */
+#define MM_ENCODE_SIZE 512
 
-/* Encode/decode map in a compact URL-safe non-human-readable format: */
 extern bool mm_decode(MazeMap *mm, const char *desc);
+extern bool mm_decode_unhashed(MazeMap *mm, const char *desc);
 extern const char *mm_encode(MazeMap *mm, bool full);
+extern char *mm_encode_r(const MazeMap *mm, bool full,
+                         char buf[MM_ENCODE_SIZE]);
 
 #endif /* ndef MAZE_IO_INCLUDED */
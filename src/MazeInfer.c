@@ -0,0 +1,257 @@
+#include "MazeInfer.h"
+#include <assert.h>
+#include <string.h>
+
+static void push_square(MazeInference *mi, int r, int c)
+{
+    if (mi->square_queued[r][c]) return;
+    mi->square_queued[r][c] = true;
+    mi->square_queue[mi->num_squares++] = (short)(r*WIDTH + c);
+}
+
+static void push_corner(MazeInference *mi, int r, int c)
+{
+    if (mi->corner_queued[r][c]) return;
+    mi->corner_queued[r][c] = true;
+    mi->corner_queue[mi->num_corners++] = (short)(r*WIDTH + c);
+}
+
+/* Queues the squares and corners next to the northern wall of (r,c): */
+static void wall_n_changed(MazeInference *mi, int r, int c)
+{
+    const int up = (r + HEIGHT - 1)%HEIGHT, left = (c + WIDTH - 1)%WIDTH;
+    push_square(mi, r, c);
+    push_square(mi, up, c);
+    push_corner(mi, up, left);
+    push_corner(mi, up, c);
+}
+
+/* Queues the squares and corners next to the western wall of (r,c): */
+static void wall_w_changed(MazeInference *mi, int r, int c)
+{
+    const int up = (r + HEIGHT - 1)%HEIGHT, left = (c + WIDTH - 1)%WIDTH;
+    push_square(mi, r, c);
+    push_square(mi, r, left);
+    push_corner(mi, up, left);
+    push_corner(mi, r, left);
+}
+
+static void set_wall(MazeInference *mi, MazeMap *mm, int r, int c, Dir dir,
+                     int val)
+{
+    SET_WALL(mm, r, c, dir, val);
+    switch (dir)
+    {
+    case NORTH: wall_n_changed(mi, r, c); break;
+    case SOUTH: wall_n_changed(mi, (r + 1)%HEIGHT, c); break;
+    case WEST:  wall_w_changed(mi, r, c); break;
+    case EAST:  wall_w_changed(mi, r, (c + 1)%WIDTH); break;
+    }
+}
+
+void mi_reset(MazeInference *mi)
+{
+    mi->journal = NULL;
+    mi->valid   = false;
+}
+
+/* Forgets all dead-end squares and queues the entire map. */
+static void queue_all(MazeInference *mi)
+{
+    int r, c;
+
+    memset(mi->dead_end, 0, sizeof(mi->dead_end));
+    memset(mi->square_queued, 0, sizeof(mi->square_queued));
+    memset(mi->corner_queued, 0, sizeof(mi->corner_queued));
+    mi->num_squares = mi->num_corners = 0;
+    for (r = HEIGHT - 1; r >= 0; --r)
+    {
+        for (c = WIDTH - 1; c >= 0; --c)
+        {
+            push_square(mi, r, c);
+            push_corner(mi, r, c);
+        }
+    }
+}
+
+/* Dead-end rule; see mm_infer(). */
+static void examine_square(MazeInference *mi, MazeMap *mm, int r, int c)
+{
+    int num_walls = 0, num_dead_adjacent = 0, dir;
+
+    if (mi->dead_end[r][c]) return;
+
+    for (dir = 0; dir < 4; ++dir)
+    {
+        int w = WALL(mm, r, c, dir);
+        if (w == PRESENT)
+            ++num_walls;
+        else
+        if (w == ABSENT && mi->dead_end[RDR(r, dir)][CDC(c, dir)])
+            ++num_dead_adjacent;
+    }
+    assert(num_walls + num_dead_adjacent < 4);
+    if (num_walls + num_dead_adjacent != 3) return;
+
+    mi->dead_end[r][c] = true;
+    if (SQUARE(mm, r, c) == UNKNOWN)
+        SET_SQUARE(mm, r, c, PRESENT);
+    for (dir = 0; dir < 4; ++dir)
+    {
+        if (WALL(mm, r, c, dir) == UNKNOWN)
+            set_wall(mi, mm, r, c, (Dir)dir, ABSENT);
+    }
+    for (dir = 0; dir < 4; ++dir)
+    {
+        if (WALL(mm, r, c, dir) == ABSENT)
+            push_square(mi, RDR(r, dir), CDC(c, dir));
+    }
+}
+
+/* Corner rule; see mm_infer(). */
+static void examine_corner(MazeInference *mi, MazeMap *mm, int r, int c)
+{
+    const int r1 = (r + 1)%HEIGHT;
+    const int c1 = (c + 1)%WIDTH;
+    int n, e, s, w, na;
+
+    n = mm->grid[r ][c1].wall_w;
+    e = mm->grid[r1][c1].wall_n;
+    s = mm->grid[r1][c1].wall_w;
+    w = mm->grid[r1][c ].wall_n;
+    na = (n == ABSENT) + (e == ABSENT) + (s == ABSENT) + (w == ABSENT);
+    assert(na <= 3);
+    if (na != 3) return;
+
+    if (n == UNKNOWN)
+        set_wall(mi, mm, r , c1, WEST, PRESENT);
+    else
+    if (e == UNKNOWN)
+        set_wall(mi, mm, r1, c1, NORTH, PRESENT);
+    else
+    if (s == UNKNOWN)
+        set_wall(mi, mm, r1, c1, WEST, PRESENT);
+    else
+    if (w == UNKNOWN)
+        set_wall(mi, mm, r1, c , NORTH, PRESENT);
+}
+
+/* Border rules; see mm_infer(). The border does not change during inference,
+   so these need to be applied only once. */
+static void apply_borders(MazeInference *mi, MazeMap *mm)
+{
+    int r, c;
+
+    if (mm->border.left == mm->border.right)
+    {
+        for (r = 0; r < HEIGHT; ++r)
+        {
+            if (mm->grid[r][mm->border.left].wall_w != PRESENT)
+            {
+                assert(mm->grid[r][mm->border.left].wall_w == UNKNOWN);
+                set_wall(mi, mm, r, mm->border.left, WEST, PRESENT);
+            }
+        }
+    }
+
+    if (mm->border.top == mm->border.bottom)
+    {
+        for (c = 0; c < WIDTH; ++c)
+        {
+            if (mm->grid[mm->border.top][c].wall_n != PRESENT)
+            {
+                assert(mm->grid[mm->border.top][c].wall_n == UNKNOWN);
+                set_wall(mi, mm, mm->border.top, c, NORTH, PRESENT);
+            }
+        }
+    }
+}
+
+void mi_infer(MazeInference *mi, MazeMap *mm)
+{
+    MazeJournal *journal;
+    int i, e, r, c;
+
+    if (mm->journal == NULL) mm_set_journal(mm, &mi->own_journal);
+    journal = mm->journal;
+    if (journal != mi->journal || journal->generation != mi->generation)
+    {
+        mi->journal    = journal;
+        mi->generation = journal->generation;
+        mi->pos        = 0;
+    }
+
+    /* Queue everything next to walls discovered since the last call */
+    if (journal->incomplete) mi->valid = false;
+    for (i = mi->pos; mi->valid && i < journal->size; ++i)
+    {
+        e = journal->entry[i];
+        if (JE_KIND(e) == JE_SQUARE) continue;
+        if (JE_VALUE(e) == UNKNOWN) mi->valid = false;  /* forgotten */
+        else
+        if (JE_KIND(e) == JE_WALL_N) wall_n_changed(mi, JE_ROW(e), JE_COL(e));
+        else
+        if (JE_KIND(e) == JE_WALL_W) wall_w_changed(mi, JE_ROW(e), JE_COL(e));
+    }
+    if (!mi->valid)
+    {
+        queue_all(mi);
+        mi->valid = true;
+    }
+
+    apply_borders(mi, mm);
+    while (mi->num_squares > 0 || mi->num_corners > 0)
+    {
+        if (mi->num_squares > 0)
+        {
+            i = mi->square_queue[--mi->num_squares];
+            r = i/WIDTH;
+            c = i%WIDTH;
+            mi->square_queued[r][c] = false;
+            examine_square(mi, mm, r, c);
+        }
+        else
+        {
+            i = mi->corner_queue[--mi->num_corners];
+            r = i/WIDTH;
+            c = i%WIDTH;
+            mi->corner_queued[r][c] = false;
+            examine_corner(mi, mm, r, c);
+        }
+    }
+
+    /* Our own changes need not be examined again */
+    if (journal == &mi->own_journal) mm_journal_reset(journal);
+    mi->generation = journal->generation;
+    mi->pos        = journal->size;
+}
+
+void mi_restore(MazeInference *mi, MazeMap *mm, const unsigned char *dead_end)
+{
+    MazeJournal *journal;
+    int r, c, i;
+
+    if (mm->journal == NULL) mm_set_journal(mm, &mi->own_journal);
+    journal = mm->journal;
+    if (!mi->valid)
+    {
+        memset(mi->square_queued, 0, sizeof(mi->square_queued));
+        memset(mi->corner_queued, 0, sizeof(mi->corner_queued));
+        mi->num_squares = mi->num_corners = 0;
+        mi->valid = true;
+    }
+    for (r = 0; r < HEIGHT; ++r)
+    {
+        for (c = 0; c < WIDTH; ++c)
+        {
+            i = r*WIDTH + c;
+            mi->dead_end[r][c] = (dead_end[i/8] >> (i%8))&1;
+        }
+    }
+
+    /* As at the end of mi_infer() */
+    if (journal == &mi->own_journal) mm_journal_reset(journal);
+    mi->journal    = journal;
+    mi->generation = journal->generation;
+    mi->pos        = journal->size;
+}
@@ -0,0 +1,49 @@
+#ifndef MAZE_INFER_H_INCLUDED
+#define MAZE_INFER_H_INCLUDED
+
+#include "MazeMap.h"
+
+/* Incremental inference.
+
+   mi_infer() applies the same rules as mm_infer() and reaches the same map,
+   but instead of re-examining the entire map until nothing changes, it only
+   re-examines the squares and corners next to walls that were discovered since
+   the previous call (as recorded in the map's journal), using a worklist.
+   Squares found to be dead ends stay marked between calls, since learning more
+   walls can never undo that.
+
+   If the map has no journal, mi_infer() attaches one of its own, which it
+   resets after every call. A journal attached by someone else must not be
+   reset between changing the map and calling mi_infer(). Call mi_reset()
+   after replacing the map's contents other than through SET_SQUARE/SET_WALL
+   (e.g. with mm_initialize() or mm_decode()). */
+
+typedef struct MazeInference
+{
+    MazeJournal         own_journal;
+    const MazeJournal   *journal;       /* journal read on the last call */
+    unsigned            generation;     /* generation of `journal' */
+    int                 pos;            /* number of entries processed */
+    bool                valid;          /* dead_end reflects the map */
+    bool                dead_end[HEIGHT][WIDTH];
+
+    /* Worklists of squares and corners (indexed by r*WIDTH + c, where corner
+       (r,c) is the south-east corner of square (r,c)) to be examined: */
+    short               square_queue[HEIGHT*WIDTH], corner_queue[HEIGHT*WIDTH];
+    int                 num_squares, num_corners;
+    bool                square_queued[HEIGHT][WIDTH];
+    bool                corner_queued[HEIGHT][WIDTH];
+} MazeInference;
+
+extern void mi_reset(MazeInference *mi);
+extern void mi_infer(MazeInference *mi, MazeMap *mm);
+
+/* Brings the inference state up to date after the changes mi_infer() would
+   have made were applied to the map by other means (through SET_SQUARE and
+   SET_WALL), given the dead-end squares of the resulting map as a bitmap
+   (bit r*WIDTH + c set for each square (r,c) in `dead_end'). Used to replay
+   cached inference results; see mc_infer(). */
+extern void mi_restore(MazeInference *mi, MazeMap *mm,
+                       const unsigned char *dead_end);
+
+#endif /* ndef MAZE_INFER_H_INCLUDED */
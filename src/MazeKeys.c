@@ -0,0 +1,2245 @@
+#include "MazeKeys.h"
+
+/* Generated by tools/zobrist.pl; do not edit. */
+
+const unsigned long mm_zobrist_keys[MM_NUM_KEYS][2] = {
+    { 0x00000000, 0x31251ba7 }, { 0x66a79298, 0xdfb6d245 },
+    { 0xcd4f2531, 0x23531b52 }, { 0xc3c978e8, 0x08d5d6f3 },
+    { 0x9a9f4a63, 0x04c8214b }, { 0x46a636a4, 0x0a085b4c },
+    { 0x8bf19e8c, 0x7724986e }, { 0x11abade7, 0xf0ee80fd },
+    { 0x399d78ae, 0x027b9ccf }, { 0x0dede7ac, 0xd60349e2 },
+    { 0x8d4c6d48, 0xfb99657a }, { 0x186e59ad, 0x547d4631 },
+    { 0x17e23d18, 0xbcb93584 }, { 0xee4930dd, 0x13afcaad },
+    { 0x27b53066, 0xdac11e3d }, { 0xe1dc01fa, 0x44a17820 },
+    { 0x77985639, 0x2911cedf }, { 0x0954d5f7, 0xb2ae5641 },
+    { 0x1bdbcf59, 0x329798e2 }, { 0xb0646e99, 0x09185fd2 },
+    { 0x1a99da91, 0xb3348a4b }, { 0xf733caf5, 0x5c00b570 },
+    { 0x353a17fb, 0xe6e90700 }, { 0xa8fa8c62, 0xf8d2d915 },
+    { 0x3421c10e, 0xfc852565 }, { 0x7dd0cc65, 0x795eebe3 },
+    { 0xdc9361bb, 0xe3c2ce10 }, { 0x2bbd7a82, 0x6594ba04 },
+    { 0x4f6a60cc, 0xfca79e7e }, { 0xb5833c7b, 0x4bdf3291 },
+    { 0x675238d5, 0xb8defe25 }, { 0xea079305, 0xfaeb3f1e },
+    { 0x92c870b5, 0xf7783532 }, { 0xf5bc9b6b, 0xc23afcb1 },
+    { 0x736eca28, 0x98d42b60 }, { 0x08f661ef, 0xfc83cdad },
+    { 0x987c3178, 0x34daec81 }, { 0xc5f4911e, 0x0f3c3070 },
+    { 0x04625957, 0xb866dfab }, { 0x72f5df61, 0xa47cfc57 },
+    { 0xd8ccc787, 0x23a97455 }, { 0x0a011838, 0x615e6e07 },
+    { 0x4f2b34a7, 0x0cfcb60a }, { 0x5b9a2981, 0x66113ea5 },
+    { 0xcb398ebb, 0x4f74f601 }, { 0x716c1261, 0x3649ff83 },
+    { 0xf58c1de7, 0x32d6f4c9 }, { 0x526911e7, 0xe1a81051 },
+    { 0x0bdc8245, 0xd4d73f01 }, { 0x59d0ea10, 0x9c801c47 },
+    { 0x5c663f0c, 0xb1735dcb }, { 0x965552e0, 0xa6737c61 },
+    { 0x19ec63bc, 0x165193c6 }, { 0x6b1c91c3, 0xd9cf9897 },
+    { 0xfb13baaa, 0x0c529aa3 }, { 0x2bee94ce, 0x59d1b62e },
+    { 0x426cbceb, 0xb9513119 }, { 0x5a139fa1, 0x2aced63b },
+    { 0xcbccd83c, 0x31b218f8 }, { 0x9c1c0dcb, 0x645c9a24 },
+    { 0xcea471aa, 0x435d0bcc }, { 0x761a5b2b, 0x5e425814 },
+    { 0xd86c4953, 0xa7780b9b }, { 0xf5d77e3d, 0x61ec5210 },
+    { 0x29ef4dda, 0xc98e081c }, { 0xeef16a65, 0x01a2b8a1 },
+    { 0xeb7836d6, 0xa6646d88 }, { 0x88d29483, 0x8cbfefce },
+    { 0xe6dd9451, 0x6fce395d }, { 0x360730a4, 0xa04a1ffe },
+    { 0x164a6727, 0xe9746d61 }, { 0xf9069b5a, 0xe10109cb },
+    { 0x3556c415, 0xc7833867 }, { 0x69b5d903, 0x662abc3b },
+    { 0x8be8223c, 0x886d94c3 }, { 0x22d63f05, 0xc625cd52 },
+    { 0x08c4b2ae, 0x5740c96d }, { 0x752a1bff, 0xa0431351 },
+    { 0xea48102b, 0xa2e29a05 }, { 0x48f8f8ae, 0x7ef6c076 },
+    { 0xb5f56824, 0x5211af8f }, { 0x4752e8aa, 0x755669a9 },
+    { 0x14023070, 0xbd9770e7 }, { 0xc7197af4, 0x4b7927ec },
+    { 0x9e56694e, 0x2f872a88 }, { 0x1e570b70, 0x85b2c012 },
+    { 0xb7345302, 0x57aacc13 }, { 0xcc227d4a, 0xca165938 },
+    { 0x3a0b1034, 0x17e01d30 }, { 0xffae8d44, 0x9be9b544 },
+    { 0x8671e324, 0x60282eca }, { 0x102c22e3, 0xf77bbd00 },
+    { 0x4bde9b08, 0x6b5422dd }, { 0x0946223f, 0xd425d63b },
+    { 0x0597828b, 0x31c46caf }, { 0x2416c7e4, 0xe78cfd38 },
+    { 0xbb51093c, 0x8fcf8c15 }, { 0x0a74ddd8, 0x247d0666 },
+    { 0x573a5181, 0x6ae56201 }, { 0xdc997c50, 0xe845c97c },
+    { 0x1991df45, 0x9414633f }, { 0x06807e2b, 0xae41557d },
+    { 0x8d70041a, 0xd8ac0271 }, { 0xadac1988, 0x849c9cfe },
+    { 0xd77144aa, 0x60a01f47 }, { 0x8d688646, 0xbb85fa8c },
+    { 0x79d2ed2b, 0x7dbd097b }, { 0x573776dc, 0x5148fc17 },
+    { 0x56ebd599, 0x6b2ea166 }, { 0xbc3d7120, 0x57fc23a6 },
+    { 0xb8a2c6e2, 0x8fcc33c3 }, { 0x1468cb96, 0x279a17e2 },
+    { 0x2872b43b, 0xc6be7c5f }, { 0xd368c3f8, 0x5f0ae79d },
+    { 0x57c07d5f, 0xd27e29d6 }, { 0xf9366013, 0xc88c1bd1 },
+    { 0xf85ddfbd, 0x51487eaa }, { 0x06fcf733, 0x2ca92b61 },
+    { 0x38391b97, 0x5cded51f }, { 0xc8b93449, 0xc6bec7f8 },
+    { 0xa1a7bcf0, 0xe92352d0 }, { 0x86ba1798, 0x8c566333 },
+    { 0xf091090c, 0x1ed11c0b }, { 0xc0e16b06, 0x11efcf4c },
+    { 0xb0d992a7, 0x3ea8af4c }, { 0x534eaa4f, 0x7bb9ce9f },
+    { 0xebaffc7b, 0xf77af329 }, { 0xc836cf05, 0x23ebf387 },
+    { 0x583c3f99, 0xe12a3ef7 }, { 0x931d1039, 0xb89a6789 },
+    { 0xe2404a23, 0xa19d2ac1 }, { 0x03457143, 0x73fd7abc },
+    { 0xd6f16dad, 0xdde2327c }, { 0x51276634, 0x06040520 },
+    { 0x11a42906, 0x676de0c8 }, { 0x1ddc7bc1, 0x2a67313d },
+    { 0xd218564b, 0x668f3980 }, { 0xdf9c72ba, 0x45733c72 },
+    { 0x706bdcea, 0x0635cc4b }, { 0x40953ffd, 0x4aba795d },
+    { 0x2c94ce4e, 0x99066606 }, { 0xd7467023, 0xb65a1778 },
+    { 0xf20c36b4, 0xe8665d31 }, { 0xc661b6ae, 0x26993a69 },
+    { 0x6f0beeca, 0xeaa7084e }, { 0x8f0770cf, 0xf79d8652 },
+    { 0xd7c9d76e, 0x568ba96b }, { 0x2d1a9938, 0xb1ed10c8 },
+    { 0x78962b3e, 0xef959e4f }, { 0xb4726ce5, 0x6f56d89d },
+    { 0xa6719dd7, 0x1035b47c }, { 0x2fe299cb, 0x8570da8e },
+    { 0xb522a12d, 0xe2bb0fc0 }, { 0x0f46331c, 0xb2ed7d81 },
+    { 0x8dedf108, 0xf6fff58d }, { 0xa14cc768, 0x477ce697 },
+    { 0x3556c190, 0x5505f759 }, { 0xe95df854, 0x01c663af },
+    { 0xf2b6921a, 0x09c93212 }, { 0xa186bdbd, 0x30366c12 },
+    { 0x0f845559, 0x3b312b94 }, { 0x04e8ffd4, 0x0e31bc6b },
+    { 0x323dcd16, 0x0b43ad97 }, { 0x4b71728f, 0xf871c8b8 },
+    { 0x88c9c02d, 0x39c61c30 }, { 0x1ec824d3, 0x894b1fac },
+    { 0xeef89522, 0x65546f39 }, { 0x3a8b42ee, 0x600dcbff },
+    { 0x9d727342, 0xec8c52db }, { 0xbfd3b5cd, 0xa9cb6403 },
+    { 0xe04629cf, 0x9b2be3fd }, { 0x6c29e769, 0xfbc3810c },
+    { 0x120275a5, 0x1e802438 }, { 0x52ed8440, 0x30e8a2cd },
+    { 0xf90a9bda, 0x2ea20c9d }, { 0x37c5f252, 0x5454053c },
+    { 0x74162068, 0xb6b6b5c7 }, { 0x2fc03a60, 0x95a6bad0 },
+    { 0x03ba86b5, 0x4ce4d3fc }, { 0x37d26a88, 0x1aa1e74c },
+    { 0x114078a5, 0x7ea992db }, { 0xc4aef851, 0xf8e78fd4 },
+    { 0x205845c6, 0xa0587d89 }, { 0xf354c765, 0xbe46de10 },
+    { 0x97bd3611, 0x28f77294 }, { 0xd6a845ba, 0x83264a02 },
+    { 0x16e9e0c4, 0xda34a05e }, { 0xa84aac76, 0xd3f9f62a },
+    { 0x0f8ca2ff, 0xb34ab29e }, { 0x67e63df7, 0x2e72f983 },
+    { 0x482d8fc9, 0x67a217dc }, { 0xd37507d6, 0x14bb1ee7 },
+    { 0x76a31279, 0x9537d45a }, { 0x1f9e182a, 0x85e88d1a },
+    { 0x194757d4, 0xbe73ffb4 }, { 0x48fa0ccc, 0xfdb889e9 },
+    { 0xb2d11e60, 0xfca92907 }, { 0xda276b24, 0xffe97c26 },
+    { 0xb933f8a1, 0xb9d512a5 }, { 0xd4e7354a, 0x3614b5fe },
+    { 0x3323be8b, 0x2fc93ef6 }, { 0x2829c67f, 0x108fdf0f },
+    { 0x115e81cf, 0x29e18fa8 }, { 0x5c83aafb, 0x48912946 },
+    { 0x1f3ead31, 0x6afa390a }, { 0xb5b7e142, 0x1172ad9f },
+    { 0xbc1ed456, 0xfde5a827 }, { 0xacd0632f, 0x333b441b },
+    { 0x0fa8281e, 0x36dbef62 }, { 0x64d9fbd0, 0x6a374f19 },
+    { 0xbe680bff, 0xa0bbd130 }, { 0xd7cf55dd, 0xc8172ca2 },
+    { 0x973d5e10, 0xadf8ae92 }, { 0x5c3fb5b3, 0x22b1f04a },
+    { 0x0f334ce5, 0x4afbb22f }, { 0x4629bfd0, 0x036960e7 },
+    { 0x0e9c0878, 0x97a0d7cb }, { 0x79f64a3d, 0x950e4852 },
+    { 0x1c142561, 0x638a0737 }, { 0x10bdf809, 0x180d7216 },
+    { 0x14dd8f66, 0x35c41648 }, { 0x805ef840, 0x4271b048 },
+    { 0x8996366a, 0xb8ee4668 }, { 0xf2cdf2e6, 0x3e27d3b3 },
+    { 0xb1aa8938, 0x72e88fdd }, { 0x311625eb, 0xbf651b8f },
+    { 0x4a688a33, 0x7d08dd37 }, { 0x1eda6ff4, 0xa82fe936 },
+    { 0x5318a761, 0x16c0e786 }, { 0x05c2f292, 0x17fcf92b },
+    { 0x53326178, 0xf6922f2a }, { 0x34b27147, 0xb1092934 },
+    { 0x517f1ebf, 0xb89e6719 }, { 0x4628b8d7, 0x6bae0256 },
+    { 0xb192334b, 0xb5f7b316 }, { 0x595256c2, 0x96fb90fd },
+    { 0x74cf9258, 0x33efbec7 }, { 0xb9bdaa3f, 0xa033c986 },
+    { 0x91736893, 0x35a2d9c8 }, { 0x91d9301e, 0x33bfa06c },
+    { 0x434e79e0, 0xe5c74706 }, { 0xd6a5c184, 0x98d36d15 },
+    { 0x11d2d0ad, 0x62465d05 }, { 0x18adc667, 0x36ccd780 },
+    { 0xe58177f4, 0x5ead222f }, { 0x3da23816, 0x764c42ef },
+    { 0x81c3d60d, 0xd6b3366f }, { 0x283d74bc, 0x7e240945 },
+    { 0x61b2254e, 0xfb2454f7 }, { 0x81ae42ad, 0x79ba4f2e },
+    { 0xa69d549f, 0xe4db1eee }, { 0xf7739d3f, 0x6d1cb0f6 },
+    { 0xdbbb1558, 0xa6e8a6ec }, { 0xeef4e652, 0x2ba241e3 },
+    { 0x94c93968, 0xabe1cb8f }, { 0x4c350c26, 0x02de2159 },
+    { 0xb0787f32, 0x11c41cb9 }, { 0xc6b39846, 0xd0921890 },
+    { 0x263b2073, 0xc534ad03 }, { 0x7135cf13, 0x2d19f869 },
+    { 0xc8de38df, 0x994ef130 }, { 0x433b5583, 0xa8e46cdb },
+    { 0x0ae889af, 0x7f68d768 }, { 0xec575dea, 0x0c283e9d },
+    { 0x0ea87810, 0xfab25c9d }, { 0x5f5e2129, 0xc3f45684 },
+    { 0x03136d35, 0xa06633ff }, { 0x6ccd6a85, 0x19481da6 },
+    { 0xc6e1d69e, 0xe274d094 }, { 0x2fa020ea, 0x93d7822a },
+    { 0xdf51b424, 0xb8b43f86 }, { 0xf8662d89, 0x71955a5e },
+    { 0x04f60c50, 0xf690ff4c }, { 0x70b72dee, 0x3d15fdeb },
+    { 0x1ffe45b2, 0xff6a0b91 }, { 0xebab19a9, 0x6db2eb26 },
+    { 0x846f7c52, 0x9b43b076 }, { 0x6d30f9cc, 0xe06c2887 },
+    { 0x24c3bac8, 0x05068b62 }, { 0x390d3e04, 0xcc31bf28 },
+    { 0xb9ee7c5a, 0x109f5f09 }, { 0xd5a6489d, 0x3cc4ad88 },
+    { 0x0f524198, 0x21d98114 }, { 0xcd7a8f3e, 0x34f03642 },
+    { 0x87b2af19, 0x72ebd3dc }, { 0x31925b3c, 0x59e19ba8 },
+    { 0x305bb082, 0x90cda13b }, { 0xf0ca29d1, 0xe31ec821 },
+    { 0x3edc3d5e, 0xa9bb9493 }, { 0x78e81de5, 0x3bb84bc2 },
+    { 0x7ed48144, 0xc41f3b30 }, { 0x4fffac61, 0x82ab8b53 },
+    { 0x532af3a3, 0x6d817c90 }, { 0x0ddcf21c, 0x520c0bcb },
+    { 0x5e9359ec, 0xe81decd5 }, { 0x63db2191, 0xb6f27bbf },
+    { 0xf12c567c, 0x2a5a0468 }, { 0xe3886167, 0x7b46482e },
+    { 0x68e5d9cb, 0xca8ead7f }, { 0xe30bedda, 0x04320e44 },
+    { 0x514047c7, 0x7249339a }, { 0x206b68f9, 0x127d4938 },
+    { 0x64236fae, 0x3815f98f }, { 0x0ae0b51c, 0x93b43077 },
+    { 0x6a44425a, 0x3d9980fd }, { 0xc9d5b3e4, 0xcab493e2 },
+    { 0x1e8c6638, 0x14523761 }, { 0x6a39542a, 0x5cea81b6 },
+    { 0x2038b93d, 0xa3d3081e }, { 0xedfeeb1a, 0x6e55ea06 },
+    { 0x46f62d75, 0x8f2b1cc7 }, { 0x8ef9cd2f, 0x3b1aea6b },
+    { 0x6aad8321, 0xf20be475 }, { 0xae684d9b, 0x5ac25cfd },
+    { 0xd2baf0a8, 0x5e560893 }, { 0x07ea63e7, 0x4205e01f },
+    { 0xe9ca8959, 0xe3fccbd3 }, { 0x13926424, 0xc0030723 },
+    { 0x476990d8, 0x4a998cc7 }, { 0x606cd824, 0x7459ba2e },
+    { 0x1f08aab2, 0x98f30b03 }, { 0x7abfba3a, 0x25e695ab },
+    { 0x09d1ffa9, 0x95b14f56 }, { 0xbffcbc13, 0xfb70e4f0 },
+    { 0x08149585, 0x3c13eeda }, { 0x774c3ae4, 0x63c9d537 },
+    { 0x3a7b294c, 0x9cea9d7a }, { 0x51a73035, 0xb48536c0 },
+    { 0x7257e39f, 0x14895613 }, { 0x1724fc03, 0x4141b49a },
+    { 0x9e55ea63, 0x25b6889f }, { 0xb62f7b26, 0x5aaedf70 },
+    { 0x81891766, 0x687b5e70 }, { 0x2b6d3fb7, 0xea9310cf },
+    { 0x18af88aa, 0x28ba6758 }, { 0x20e07704, 0xe4c05dbb },
+    { 0xde7ea5e5, 0x62ef7e03 }, { 0x7cb2675b, 0xbfa6dbef },
+    { 0xe06bf457, 0xdba1ffca }, { 0xf730cdfb, 0xd2cd0be9 },
+    { 0x2152b240, 0x1dbac87f }, { 0x971b66b7, 0x4a83ed99 },
+    { 0x7bebce50, 0xa304a030 }, { 0x584badd5, 0x42acf705 },
+    { 0xc79da914, 0x08c59743 }, { 0xe099f432, 0xb192fee5 },
+    { 0x06a0abfa, 0x50ce6f13 }, { 0x0569c6ec, 0xd98945eb },
+    { 0x52d99779, 0x421073f7 }, { 0xbe09fa77, 0xe562340a },
+    { 0x1324394d, 0x6e8280e4 }, { 0x096dabbd, 0x3750e4ff },
+    { 0xec8aa4bd, 0x882b6293 }, { 0x71c9d7d4, 0x7243bb06 },
+    { 0x5f8074c0, 0xb392fc08 }, { 0x2fa9d18e, 0x688fa547 },
+    { 0x07750d6b, 0x80a20f43 }, { 0x99c9a7f9, 0x92099d0f },
+    { 0x74022ded, 0x0e674174 }, { 0x3543ce99, 0x5de3b8be },
+    { 0x26de55db, 0xd9707b92 }, { 0x01b179ae, 0xf428b67b },
+    { 0x895cf0a2, 0x16eeba12 }, { 0xf62c7b8d, 0x7740e0a6 },
+    { 0x40b08b8c, 0x1d117852 }, { 0x40b1fb13, 0xc5465962 },
+    { 0xeb06ec9b, 0xee7faaba }, { 0x7c8cbc20, 0x5b952866 },
+    { 0x33d8d14b, 0x04a29896 }, { 0x564c024d, 0x2d19cd78 },
+    { 0xad518b75, 0xa7aed7f0 }, { 0x0aab3b28, 0x06db09b7 },
+    { 0x2dd3c189, 0x4a9e5243 }, { 0xb46840bc, 0x22710d13 },
+    { 0x54f1f342, 0x73e3b014 }, { 0xa7f2ec54, 0xd9189f59 },
+    { 0x2376d957, 0xb563218d }, { 0x6694653c, 0x8490e63f },
+    { 0xcfcc7bee, 0xd88a176a }, { 0x61432e5e, 0x3d045c0e },
+    { 0x905b1f93, 0xcd6a6c35 }, { 0xd3a25395, 0x0f1023e0 },
+    { 0x4a840205, 0xcf5bf252 }, { 0x8a3b9e83, 0x3ad82b3f },
+    { 0x90dff830, 0x8a7d357d }, { 0x8b3309e9, 0x4905db58 },
+    { 0xa001af69, 0x44d7d945 }, { 0xaf681e77, 0x82369966 },
+    { 0x93530e75, 0x4b044b9d }, { 0x207f02b6, 0xcf81e1ef },
+    { 0x358d122a, 0xd1cff394 }, { 0x5c35b497, 0x440564d0 },
+    { 0x093bf1a6, 0xe9a2b528 }, { 0x5a18f144, 0x4397895c },
+    { 0x15147712, 0x96a32397 }, { 0xa36b05b2, 0x1403d98a },
+    { 0xd32b500f, 0xce5bea20 }, { 0x1743e158, 0x095ae936 },
+    { 0x4d682ffd, 0x904689cb }, { 0xcceecb3a, 0x8528b73a },
+    { 0x09dfb354, 0x80664bda }, { 0xc057e229, 0x7f585241 },
+    { 0xb1186db4, 0xa9a265b4 }, { 0xc4b8fa83, 0x88ac4843 },
+    { 0x8382a2a0, 0x09337e66 }, { 0xf75b1c96, 0x5131293b },
+    { 0x5ca0d08b, 0x372ea1d1 }, { 0xf1e73249, 0x6f35c8fd },
+    { 0xe216e14f, 0x22666090 }, { 0x36b99159, 0xfceea809 },
+    { 0xcc3365d9, 0xc2f07328 }, { 0x27433e56, 0xdd772a7a },
+    { 0x783ca8ac, 0xadc70490 }, { 0x00284a97, 0x7c264c5e },
+    { 0x5dff62c6, 0x352db53c }, { 0x66768836, 0x80573dc1 },
+    { 0x23adcd0a, 0x3adf5097 }, { 0x6db7dec5, 0x6f903445 },
+    { 0xce10135d, 0xd61c3d96 }, { 0xd8cb315c, 0x4d041f97 },
+    { 0x7cd117ff, 0xa6d347a2 }, { 0x45d4c785, 0xec39074f },
+    { 0xaf9fabbb, 0x3ec81b6b }, { 0x902f5945, 0x97575c6b },
+    { 0x32d9034c, 0x8cc29f90 }, { 0x5bf05d24, 0x3faacd69 },
+    { 0xbcddce8e, 0x5910461c }, { 0x49c10cf0, 0x07b12720 },
+    { 0x1e6699ca, 0x1dd44a67 }, { 0x9a550ab6, 0x54c66e72 },
+    { 0x8c537fa1, 0x212dcfd8 }, { 0x06d2c1ce, 0xb1779e7d },
+    { 0x21958c96, 0xfa98e25c }, { 0x2f40af96, 0x6929a1d8 },
+    { 0xf84afe9b, 0x04b7bf79 }, { 0x2e7b7788, 0x9c85acb2 },
+    { 0x38284ac2, 0xa862fd0f }, { 0xcb72a3c7, 0x21b4b566 },
+    { 0x217bf013, 0xd76ce36b }, { 0x301ae42c, 0x806cf5cc },
+    { 0xcd531be2, 0x6761a1f8 }, { 0xcc4d8b55, 0x9fd7a1c8 },
+    { 0xa4552b22, 0x03141e64 }, { 0x287cabd1, 0x13bfb8ca },
+    { 0x73f20c0a, 0x8b2bb1a1 }, { 0x15768931, 0x8bb0c530 },
+    { 0x465f4609, 0x096aae93 }, { 0xdd14063c, 0x0ea792e9 },
+    { 0x06ed16b2, 0xa22d90e6 }, { 0x4696bcfc, 0x9c9ad577 },
+    { 0x05c4ccf1, 0x6ed62114 }, { 0x2263cb6c, 0x17a62c3d },
+    { 0xf5967520, 0xcab50cb9 }, { 0x9da94210, 0x8ea8d576 },
+    { 0x9e797c25, 0x97628989 }, { 0xb1233311, 0x8da63212 },
+    { 0x49cac1e7, 0xa1816074 }, { 0x8e466cca, 0xc25fd6a4 },
+    { 0xaf1e22c5, 0xe5b9207d }, { 0x90be4d10, 0x9d04da7d },
+    { 0x072963bd, 0x909af43c }, { 0x90bec215, 0x1f853c79 },
+    { 0xca2941c3, 0xf4898e34 }, { 0x05abca1e, 0xf3c13083 },
+    { 0x4697782c, 0x46605167 }, { 0xd2026d0c, 0x62344e1d },
+    { 0x2feab2d3, 0xe7d0d556 }, { 0x3821ebd1, 0xb336bd49 },
+    { 0xc3eac658, 0x7eefc6a7 }, { 0x0f86a37b, 0x1d90f2aa },
+    { 0xb2a4ad84, 0x31858bca }, { 0x32539914, 0x2bf22aaa },
+    { 0xedfd8194, 0x89de3eff }, { 0x67df7d8f, 0x6e90c447 },
+    { 0x77d7b1e8, 0x10adf0c5 }, { 0x4066930c, 0xb85e5763 },
+    { 0x22e7d127, 0xaa6832aa }, { 0x6fa317ac, 0x15f241ba },
+    { 0x23b3603d, 0x998d780c }, { 0x6bdcad3d, 0xc4aac7ac },
+    { 0x8afa9e6d, 0x6e449057 }, { 0xcb8f8e0d, 0x7d201594 },
+    { 0xb1a77cda, 0x3d862c3c }, { 0x31a7da2b, 0x894419a7 },
+    { 0x23a5a15b, 0xbb233de7 }, { 0xc8ead52b, 0xb5a92308 },
+    { 0x315b8ccf, 0xdb89633a }, { 0x71f71024, 0x1c9493d8 },
+    { 0xcf600b45, 0x1ebbcd06 }, { 0xbd5a445e, 0xda8baec9 },
+    { 0x7fa1d502, 0xfe6457b8 }, { 0xec9885de, 0xe5663867 },
+    { 0x0386ac1a, 0xc2ca5794 }, { 0xb1c5d136, 0xf91e7e61 },
+    { 0x507ae978, 0xd16c3e89 }, { 0x00a68d5b, 0xb5425378 },
+    { 0xc7c2eef1, 0xd38d32c2 }, { 0xf649a9ef, 0x8e48c1d8 },
+    { 0x07bb22fa, 0xe400bebe }, { 0x54393911, 0xfbb55ff2 },
+    { 0xf0d473eb, 0xfdd68436 }, { 0x6d50fef5, 0x791c2921 },
+    { 0x4fab9b33, 0x1af02827 }, { 0x7dd226dd, 0x35ee8c9e },
+    { 0x183c85fa, 0xd4981f91 }, { 0xae95ae9d, 0x7c49a597 },
+    { 0x81803107, 0x236dc56d }, { 0xb8096c8b, 0xb71dd478 },
+    { 0xcd2b3756, 0x4bb4bf0e }, { 0xfb5b9b4c, 0x8be415ef },
+    { 0xf92f7909, 0xccd6b73f }, { 0xa9544f1d, 0xf26e1050 },
+    { 0xc1b65f22, 0xaf6dd2b6 }, { 0x844d9eb7, 0x8b88f9c4 },
+    { 0x30ff6dda, 0xeeec3fde }, { 0x01ea91ee, 0x7108a063 },
+    { 0xf00e5bc5, 0x5a523e8e }, { 0x2e0141a8, 0x3dce2347 },
+    { 0x43303f7c, 0xd219f762 }, { 0xfdccb7d7, 0xc538c47c },
+    { 0xf2821280, 0x5067b082 }, { 0x9361439d, 0x06da77e0 },
+    { 0x2a0ee6a5, 0xd4b404fb }, { 0xb28e3af0, 0x22dedeb7 },
+    { 0xb9691ca0, 0xd05a7dcc }, { 0xa2694d52, 0x9dbd56fa },
+    { 0x39745a0e, 0xe8979aff }, { 0xbbe9bf4c, 0x409d152f },
+    { 0x1d50f020, 0x7c8eb759 }, { 0xf565b93b, 0xd92f5f67 },
+    { 0xc31a5f33, 0x9576fd47 }, { 0x87e9ad09, 0x97a467ab },
+    { 0x0a847103, 0x5330b3e8 }, { 0x452a8347, 0x808a3cef },
+    { 0xd99ad50a, 0x666abd70 }, { 0x36ed9ffa, 0xa9f4065c },
+    { 0x8dc2ad3c, 0x28e45bf5 }, { 0xc4e8a128, 0x599e4488 },
+    { 0x639dde52, 0xf98d4f3e }, { 0x27ae0454, 0x32c4a069 },
+    { 0xc300b525, 0xf3122920 }, { 0x71697f0d, 0x0ed9364a },
+    { 0xf0cd5b13, 0x1e4f4663 }, { 0xe7871156, 0xf8a71cd1 },
+    { 0x09ec18a0, 0x1821c282 }, { 0xf17d438e, 0xf9c07384 },
+    { 0xe5ccbc21, 0x6bec6609 }, { 0x7a2bfbd7, 0x25cc06bf },
+    { 0x445a1789, 0x5c0c9c18 }, { 0xfed51723, 0x12c62557 },
+    { 0xd7573353, 0xc038fdc6 }, { 0xdfc273a1, 0xb07fcf23 },
+    { 0x08dff8a5, 0xcf0ee523 }, { 0x3ae3cf46, 0x0bb0ed02 },
+    { 0xdebe178d, 0x653f4818 }, { 0xc0d9510f, 0x3999bce8 },
+    { 0x4de496b5, 0x8d7aa4b4 }, { 0x0a0d16c5, 0xa5d376dc },
+    { 0xd2dfdccd, 0x2c852735 }, { 0x3bfbbe96, 0xbc17de3d },
+    { 0xd4a25fca, 0x4a2f84f0 }, { 0xc4d7fab0, 0x09423062 },
+    { 0x4ee59754, 0xc4ceed27 }, { 0xda4ef8d6, 0x78378d49 },
+    { 0xc23dfef2, 0x78e3c013 }, { 0xa478e5e2, 0x9762d2cf },
+    { 0xfbb97f31, 0x06a87e8a }, { 0x0d78a9e7, 0xe164fadf },
+    { 0x7029217f, 0x608569fc }, { 0x896f68c6, 0xdaf987b7 },
+    { 0x06bd722a, 0x33c6700d }, { 0x1488901a, 0x6f0c89e8 },
+    { 0x044fa4a2, 0x7b6e54c4 }, { 0x825fe1b3, 0xcf4b53d0 },
+    { 0x425af06c, 0xb3a2ccb6 }, { 0x69d49c6d, 0xe36a8903 },
+    { 0xde7dd979, 0x27a26a49 }, { 0xf70fee84, 0x2c7b7a27 },
+    { 0x9569fc3c, 0x4667a47a }, { 0xd83538c1, 0xcc24e886 },
+    { 0xa1423f19, 0x0b4c5da0 }, { 0xe904175a, 0x79236cda },
+    { 0x00c4c7f8, 0xf71d145b }, { 0xa8ee1bc5, 0x06198c16 },
+    { 0x071a4608, 0x20f889ed }, { 0x7e9abfc7, 0x5f783452 },
+    { 0x7c7e83fe, 0x670cbad3 }, { 0xa4181796, 0xe3ae2e06 },
+    { 0xc1836fba, 0xbfd1ba57 }, { 0xd03ad9aa, 0x05c4e793 },
+    { 0xcc14efdb, 0x85d973c1 }, { 0x72434b96, 0x8c4225df },
+    { 0xe259acf9, 0x63e9120e }, { 0x5911a28e, 0x1e297971 },
+    { 0xc711c2cf, 0xd54ad3eb }, { 0xf68c905c, 0x8d8f7c49 },
+    { 0xd629d7be, 0xb0f5ad9d }, { 0x951c5afe, 0xf97a84ef },
+    { 0xca7376ae, 0x291b94f1 }, { 0x0cc1b8e6, 0x0665ab16 },
+    { 0xa2808f8e, 0x3569f868 }, { 0xe8f0ca11, 0xf425c623 },
+    { 0x40d6d1f2, 0x4eb51e76 }, { 0x24fa9270, 0x2b30d29c },
+    { 0xcca37af6, 0x503e9923 }, { 0x702bf31f, 0x2679781a },
+    { 0x1a1f052c, 0xfa857d19 }, { 0x2bc6cd07, 0xadcb76ea },
+    { 0xd48884b4, 0x9c45fc2b }, { 0x7f916592, 0x03ee663a },
+    { 0x93aa67c8, 0xc5ff2fea }, { 0x956827c4, 0x3d8844e2 },
+    { 0x4176d1d5, 0xd60016df }, { 0x28a46ec2, 0x5b3623b7 },
+    { 0xd8d0c3b1, 0x2f6fef61 }, { 0xbe33e7c0, 0xa6b43913 },
+    { 0xa136933c, 0x7fca748a }, { 0xeb3f1dea, 0x54512933 },
+    { 0x3cc13109, 0x7109e4fe }, { 0x3d7035d6, 0x7850d660 },
+    { 0x318547c4, 0x23c218bb }, { 0x7f1c58c4, 0xd65b82c4 },
+    { 0xc18be76c, 0x60b32253 }, { 0x19ce5bd3, 0x2ab6bc23 },
+    { 0x3620e538, 0xf42fbac5 }, { 0x87ae4b99, 0xb4944364 },
+    { 0xbd967a70, 0x17bb5262 }, { 0x591cf2a5, 0xbe8a0604 },
+    { 0x490caa53, 0x3d36f10d }, { 0x1d71b0fb, 0xe15b5f06 },
+    { 0xb36dd438, 0xdddfd22d }, { 0xe4d0a0e4, 0x1ab88f33 },
+    { 0x3459f57f, 0x4ac47a58 }, { 0x6b908409, 0x53b89b06 },
+    { 0x87e96885, 0x13b66ded }, { 0x23a00edb, 0xbaa25676 },
+    { 0x326c7cf1, 0x1eee95fb }, { 0xf5f87944, 0xdf9473ff },
+    { 0x64726bb9, 0xf4ce0b4a }, { 0x4978d596, 0x508e49d7 },
+    { 0x9ed6f5a2, 0x23aed498 }, { 0xd57f1264, 0xd1ec3080 },
+    { 0x5644d74e, 0xd0ad3820 }, { 0xef6510b0, 0x1cb00bc2 },
+    { 0xb73c3b17, 0xdcfe8209 }, { 0x8c2839e6, 0xbd8ba133 },
+    { 0x8455234c, 0x5c3969ef }, { 0xf6e0c9e0, 0xa71f6480 },
+    { 0x10292b0b, 0xc04a2f22 }, { 0x7c853848, 0x24864b13 },
+    { 0xee9875c8, 0x1cb5d01a }, { 0xcbf1c6c6, 0x33b016a8 },
+    { 0x7953bcfa, 0x862ec71f }, { 0x39d43af4, 0xa41b67ad },
+    { 0xa7acc5f3, 0xf8e87b60 }, { 0x690b6d81, 0x616f7862 },
+    { 0xe4afc73f, 0xa5f32301 }, { 0x2d70091f, 0x40252046 },
+    { 0x2e49f807, 0x4fafe5be }, { 0x86e10c10, 0xefd23a84 },
+    { 0x4108c6af, 0xc74b6878 }, { 0x4b6d113f, 0x3af68522 },
+    { 0x70bd49f0, 0x7cb009ca }, { 0xb55dbee1, 0x4cc25781 },
+    { 0x03132ecd, 0xda3f14bb }, { 0xd554de05, 0x9a9a662b },
+    { 0x56da7f6e, 0x0e5d608e }, { 0xd9854a76, 0xbcceaad2 },
+    { 0x315f1155, 0x43f98474 }, { 0x5174ceb0, 0x3f8b65f9 },
+    { 0x461e091d, 0xd562006e }, { 0xc981bb77, 0x62764fe7 },
+    { 0xc15a572b, 0x74def020 }, { 0xca3b1328, 0xf45fa6c0 },
+    { 0xf964ceb6, 0x13156e10 }, { 0x22e54528, 0x5de21c18 },
+    { 0x219b09e3, 0xd31c2eb3 }, { 0x180750d1, 0xf8e546a5 },
+    { 0x91f98528, 0xaa90fe0e }, { 0x0660b428, 0xf1724545 },
+    { 0xe63d2362, 0xeb816931 }, { 0xdf0e95cb, 0x3ae3baee },
+    { 0x8efc6da4, 0x69eabeed }, { 0x389fd5f0, 0x7661aac1 },
+    { 0x589c33ea, 0x3c09c0e0 }, { 0xa6cda0a5, 0x70469438 },
+    { 0x5430de47, 0x81ea21e1 }, { 0xe61e8d4c, 0xd56bb1ee },
+    { 0x32d34e9e, 0x1907a77d }, { 0xb5236b64, 0x0e2d8896 },
+    { 0x21f708a1, 0x0e7b0fff }, { 0x06bd3894, 0x713e4920 },
+    { 0x6e0634b2, 0x22fead35 }, { 0x02617ddb, 0xe700881c },
+    { 0xae6c8829, 0x2bdbc9e6 }, { 0x13d82b1c, 0x07c41e5f },
+    { 0x494c6337, 0xf53e0b32 }, { 0x27b924b0, 0x2a6a4203 },
+    { 0xdcd7542b, 0xd0ecacca }, { 0x6e5e2c55, 0xdcfdeff9 },
+    { 0x870dd3df, 0x97c1dbc4 }, { 0x3dcae106, 0x7dbe1744 },
+    { 0xb67352a8, 0x86d2ec7d }, { 0xcf666838, 0x6a2ed6e7 },
+    { 0xdd72f2db, 0xb7862640 }, { 0x14b5601e, 0x2d04d033 },
+    { 0xe393afa9, 0x700d6585 }, { 0xe8e5d920, 0x86363db4 },
+    { 0xbf00e980, 0x99ce97c9 }, { 0x6b8255ed, 0x4977125f },
+    { 0x63b1f838, 0x76c16e60 }, { 0xd11f4a8f, 0xae9b75b4 },
+    { 0x1347a030, 0x40918609 }, { 0x01451e87, 0xf6a09925 },
+    { 0x33924ff2, 0xcf6e2014 }, { 0x286f9528, 0xfcf37efb },
+    { 0xe8045bda, 0x3f9104b0 }, { 0x212c1c4d, 0x321be75d },
+    { 0x6ee5f80a, 0xd9d38b20 }, { 0xbbc7717d, 0xcd095d34 },
+    { 0x521ad75f, 0x4b655967 }, { 0xb2e1f725, 0x7398d5eb },
+    { 0x0362f35c, 0xcd1ac7a6 }, { 0xecaecf4f, 0x0a2e63c8 },
+    { 0x12b8e144, 0xd2f9c53a }, { 0x323acb09, 0x3492c696 },
+    { 0xf0b64acb, 0x06b529b0 }, { 0xee81c14d, 0xaa86fd55 },
+    { 0x85bfb00c, 0x19d975ad }, { 0x3a22f0a4, 0x50d86179 },
+    { 0x8163f627, 0xb58e9f10 }, { 0x8eea5969, 0xe6f9f07e },
+    { 0xd60cd936, 0xd421d59c }, { 0x8097a852, 0xb619449b },
+    { 0x9cb2bc21, 0x73018fb6 }, { 0x17eff009, 0x9b2fb97f },
+    { 0x0b4a6f2b, 0x8b084386 }, { 0x6a0a5262, 0xa86b1c44 },
+    { 0x0d5da55f, 0x8f4afc8a }, { 0xfdcca231, 0x729c3419 },
+    { 0xbb67f72f, 0x9d2e3c11 }, { 0xf2f58d02, 0x92136323 },
+    { 0xb8efbaae, 0xbad5e63c }, { 0x6e7b70a3, 0x8f42b95c },
+    { 0xff4088af, 0x5e99e479 }, { 0xf601c7bb, 0xe4352508 },
+    { 0xc996203e, 0x16c2d0d0 }, { 0xe87a1585, 0xf525ea6e },
+    { 0x0aa845ce, 0xec8212db }, { 0x8b60ac49, 0x81f200fc },
+    { 0xb0a927e5, 0x8bb4008f }, { 0x12f59e77, 0x51705074 },
+    { 0xea8679fb, 0xb419dad3 }, { 0xcb8ce250, 0x06de74d5 },
+    { 0x70c0d64b, 0x3fb3f6c7 }, { 0xacb9c820, 0x9aaeddc7 },
+    { 0x005e681a, 0x46445a9f }, { 0x54ae6a55, 0x4b439b0f },
+    { 0x234bbd71, 0x926d8560 }, { 0xdacd18d9, 0xe7ed637f },
+    { 0xc44f7a84, 0x17b653ca }, { 0xfb9ab924, 0xc35e5987 },
+    { 0x4addd574, 0xf41e47a8 }, { 0x227ddb66, 0x97e5caca },
+    { 0x9508040a, 0x6878d74d }, { 0xa314ba59, 0x56616c2b },
+    { 0x14763d06, 0x9d87d418 }, { 0x75b0567e, 0x36ad96a5 },
+    { 0x261c5705, 0xb06762b1 }, { 0x14fb6afb, 0x3d6b302c },
+    { 0x1ac4be2b, 0x04d9a561 }, { 0x9668559d, 0x70796ef4 },
+    { 0x40025ed2, 0x3df638e4 }, { 0x8e0c5453, 0xcf8cdf14 },
+    { 0x5ed13cef, 0x65864fb7 }, { 0x046c32cc, 0xe258966e },
+    { 0x2b04f283, 0x97dc161f }, { 0x9608973a, 0x1aa0f715 },
+    { 0x455ba196, 0x346d75a7 }, { 0xa35f5f48, 0xa655b766 },
+    { 0x6b1a2454, 0x8e4cb438 }, { 0xa7fb440a, 0x20cdb19b },
+    { 0xb86b692f, 0x64193d7a }, { 0x880ac9a0, 0x0bc0b33c },
+    { 0x16d586a0, 0xd8554858 }, { 0xd3446a50, 0x6db5a4f6 },
+    { 0xb88e4d7d, 0x3452ef7e }, { 0x8b8dbf5c, 0x6546e0f7 },
+    { 0x2a28ee24, 0x413e47b0 }, { 0x31a53806, 0x06864072 },
+    { 0x46d70b65, 0x3fc5c250 }, { 0x2c651628, 0xf8699923 },
+    { 0x49efec6c, 0xff251dba }, { 0xfd7bb58d, 0x146aa4fb },
+    { 0xd2205951, 0xebd93477 }, { 0x737ab3a2, 0x82c53532 },
+    { 0xfb953ebf, 0x45fcc96c }, { 0xc4241671, 0xcdbad5e8 },
+    { 0xfaa1f509, 0xba2c0b0b }, { 0xade9aeb6, 0x314ad48a },
+    { 0xb758a309, 0x0057770e }, { 0x6192f6ea, 0xa2b98e06 },
+    { 0x2446c071, 0x26f93f49 }, { 0x5f750547, 0xd638da2d },
+    { 0xc2f67bae, 0x81ac5166 }, { 0xf6dec1b9, 0x59d798f7 },
+    { 0xea359643, 0xdf9aa963 }, { 0xb4f295eb, 0x1625240b },
+    { 0xaa9c4be3, 0x39a36f28 }, { 0x732b9d81, 0x5b75c4d8 },
+    { 0x9250e485, 0x5e9548b7 }, { 0x0327f333, 0xf30f51b4 },
+    { 0x1a060250, 0x78e20ace }, { 0x11f5dccc, 0x698ca355 },
+    { 0x4494c3c8, 0x21966fbd }, { 0x82036cc8, 0x4c6ef39a },
+    { 0x67c4c229, 0x79ff1d6a }, { 0xa591207d, 0xe232ce78 },
+    { 0x110bfff0, 0x80cc74a8 }, { 0x5aa1f36f, 0x5bd5a9ac },
+    { 0xf92caaf8, 0x1214e332 }, { 0x8a3f88d4, 0xb2a85c5f },
+    { 0x4e867cac, 0xa42cad31 }, { 0xbf4d3218, 0xb06cf5ce },
+    { 0xf4d7b48c, 0xc4035c24 }, { 0x5b8f0921, 0x92c9d051 },
+    { 0x04ae3017, 0x24a611e0 }, { 0xf84c98bc, 0x744b9614 },
+    { 0xbbfec58c, 0x420ff687 }, { 0x6eb8f1e5, 0x2377b862 },
+    { 0xcced106d, 0xf34c27c3 }, { 0x050d1f6a, 0xe8b96b41 },
+    { 0x475b9a15, 0x31520f73 }, { 0x75bea12e, 0x5c6e03c8 },
+    { 0xdfcdd9d2, 0x6063004b }, { 0xdf20688a, 0x1790f60d },
+    { 0xa07ff9aa, 0x20f88fda }, { 0xb097c6d8, 0x544dd30e },
+    { 0xb19762b9, 0x9a3e66ff }, { 0x9e66da07, 0xf404e4c2 },
+    { 0xf9a22ffe, 0x355930aa }, { 0x4da78f45, 0xde6f069b },
+    { 0x900633db, 0x1eb3b2e9 }, { 0xd8730e9f, 0x034b0468 },
+    { 0x639bc418, 0xe4112175 }, { 0x81ed6b6c, 0x1702a6a3 },
+    { 0x205fb28b, 0x72279934 }, { 0x330d06be, 0xdc3ef792 },
+    { 0x65b20698, 0xccb8e6a5 }, { 0x19843f20, 0x2f6719c5 },
+    { 0xbc3d10de, 0xfc5057cc }, { 0xe01a059c, 0xea9675d7 },
+    { 0x1d539eb2, 0x2b5ded43 }, { 0x55b888eb, 0xc2e491bb },
+    { 0xf4477e25, 0x71d2deb2 }, { 0xb2fa52a7, 0xc9d2d308 },
+    { 0x9d9292ca, 0xf47337fc }, { 0x9c6d330b, 0x473881e8 },
+    { 0xd8431942, 0x6fc30b3a }, { 0x0a517f39, 0x232e2389 },
+    { 0xbc403b5f, 0xb928a368 }, { 0xe5f498d1, 0x6ed92444 },
+    { 0x6e6ae052, 0x303fcbed }, { 0x0686fbc9, 0x48398d09 },
+    { 0xa3f0f9f6, 0x49bce055 }, { 0x55f5647d, 0x94938d0d },
+    { 0x0219a2fe, 0x1093f188 }, { 0x3318a2fa, 0x88e16804 },
+    { 0x942c38f1, 0x288abbd0 }, { 0xad08bbdf, 0x4f51bf1a },
+    { 0xbdbb0e5d, 0x01b371f7 }, { 0xdca2230b, 0x14b74589 },
+    { 0xd11534c1, 0x766e4655 }, { 0xb1891b53, 0x3c83de2f },
+    { 0x3a7d4ad8, 0x05e2d7cf }, { 0xa42e8d8a, 0xb50f8a24 },
+    { 0xe690a49b, 0xe8cbd257 }, { 0x0f9d6793, 0x94168c7f },
+    { 0xc0fa6896, 0x22dcad4a }, { 0xa4712e0a, 0x22d733f3 },
+    { 0x9aa737c5, 0xc7b22fd7 }, { 0xd321ff4c, 0x748a4d50 },
+    { 0x9cf8b193, 0x02a2a42d }, { 0x3fae4390, 0xe591b818 },
+    { 0x4d08f321, 0x46e15fd7 }, { 0x06283cc8, 0x7d75fed2 },
+    { 0x50f957a3, 0x74115a39 }, { 0x2bdcddf9, 0x7bf3b081 },
+    { 0xe7e41814, 0x1b5c1ecb }, { 0x1ab40efb, 0x02d8b4d0 },
+    { 0x2f4af883, 0x0ef24de3 }, { 0x17608a60, 0x5dc45b8b },
+    { 0x911b0efc, 0x3a533eeb }, { 0x12d55d27, 0xea809365 },
+    { 0xba290c79, 0xf00a3430 }, { 0x21acf67b, 0x09f0e8d3 },
+    { 0x0dda2d64, 0x8f295f18 }, { 0x48b84c69, 0xe7824b34 },
+    { 0x918b0584, 0x084f055c }, { 0x3934aaee, 0xb01954a5 },
+    { 0x0fe73e42, 0x7d33cec1 }, { 0xddac4228, 0xf199442a },
+    { 0x44c796d9, 0x647c8af0 }, { 0x33aa25db, 0xe47419e5 },
+    { 0xeb2dea41, 0xd9e82d0b }, { 0x99c9b29a, 0xedea4fce },
+    { 0x3fb1611c, 0xe78ff6ea }, { 0x1d50aaec, 0x7dcca776 },
+    { 0x415122a2, 0x2c822ad6 }, { 0x8f89b25f, 0x2442d8f3 },
+    { 0xc30cc768, 0x74bd1703 }, { 0xbee6a045, 0xf3325d65 },
+    { 0xf45ae400, 0x798a0c67 }, { 0xe69cc5b9, 0x75c3d1b1 },
+    { 0xc026a475, 0x049706d0 }, { 0xe583cc75, 0xe7f814d8 },
+    { 0x01d5bb24, 0x06f60258 }, { 0x2c38a7b0, 0xe416e959 },
+    { 0xc5169f81, 0xd8633c53 }, { 0xdda1f38c, 0xeea66c43 },
+    { 0x6f17a63f, 0xbacbe134 }, { 0xc4cdac4a, 0xd325d665 },
+    { 0x82412717, 0x26bbadb2 }, { 0x9fcfd837, 0x45c132ff },
+    { 0x37eb80e4, 0x4ac57c75 }, { 0x49d7bcad, 0xce13a77e },
+    { 0xaef09055, 0x9ef613b4 }, { 0x8b1caea3, 0x99c0d51b },
+    { 0xedf39085, 0xed9bbfe2 }, { 0x3058fd11, 0xcc24970a },
+    { 0x04ca7ad6, 0x2197c39c }, { 0x252d7d7f, 0x15ec3228 },
+    { 0x036ddac0, 0x38d39bf9 }, { 0x30655569, 0x68f2fb49 },
+    { 0x13dc54c7, 0x4699bd4d }, { 0x0a04b63d, 0xd931d6b8 },
+    { 0xe899e3fd, 0xb5158ff3 }, { 0xa178aeb3, 0x2bc011dc },
+    { 0x7fd22628, 0x508dc1b0 }, { 0x3b21e555, 0xa8e6c524 },
+    { 0x69a5b4de, 0x1a1ce15b }, { 0x630b1795, 0x20bd6744 },
+    { 0x69049ccd, 0x7b7af2fc }, { 0x5c41fdaa, 0x42b5cefa },
+    { 0xdbfa0328, 0xaf466c1e }, { 0x181b1566, 0x8da96103 },
+    { 0xcfbefb1e, 0x1b1109ee }, { 0xdd21888f, 0x132f9547 },
+    { 0xf40ddfb4, 0x45b299b3 }, { 0x215be18b, 0xad42b955 },
+    { 0x852bc324, 0x488c1fb4 }, { 0x751b08ae, 0x504dbcf0 },
+    { 0x45cfa24f, 0x555deb1f }, { 0x592e8991, 0xcc2fa457 },
+    { 0xdf462f58, 0x0640a7e1 }, { 0x2be48374, 0x6cb308b5 },
+    { 0x4bc46d93, 0xe68de46e }, { 0x331bf019, 0x068240f7 },
+    { 0xdc17f0ea, 0xd38467ae }, { 0x89548f58, 0x4b4447d7 },
+    { 0x15f43cda, 0x93d9190d }, { 0xe0e77b86, 0x915f1819 },
+    { 0x971e1c1a, 0xc5d0c753 }, { 0xfe9e8e3d, 0x440490c8 },
+    { 0x67ad5d98, 0x9dcdbdf0 }, { 0x7b0c5878, 0xd6a65e85 },
+    { 0x67ad11fe, 0x18894895 }, { 0x1289334f, 0xc2e569c4 },
+    { 0xa810adec, 0x648bfbc5 }, { 0x19dfb51c, 0xc3037f17 },
+    { 0xf299c91b, 0xe7b4f541 }, { 0x0eebc296, 0x0afeaf54 },
+    { 0x06501c33, 0xf4858d7a }, { 0x17d866be, 0x2d3e8c7f },
+    { 0x8787e566, 0x3c9e0f70 }, { 0x99ee8776, 0xecce0c49 },
+    { 0xff8677cc, 0x843e585e }, { 0xe110a7a5, 0x647b67c6 },
+    { 0xdb7a2972, 0x2b8cc43b }, { 0x58afdf10, 0x5a69d5d9 },
+    { 0xa2db565a, 0xe593e5ea }, { 0x5d8e0e36, 0x3e666ba8 },
+    { 0x7cc90d0e, 0x24a1a161 }, { 0x2b929190, 0xcb9768e2 },
+    { 0x67d238ea, 0xa8eeddc4 }, { 0x292de0da, 0x6501a06a },
+    { 0xc44f05a9, 0x3ce5f27c }, { 0x95d53bec, 0x42365a58 },
+    { 0x448e55b1, 0x4ee3a9f8 }, { 0x039edc54, 0x5c89bb45 },
+    { 0xa4e51fd0, 0x910bc2b9 }, { 0xcb4a073e, 0xbc372f7c },
+    { 0xf049a22f, 0x847e9d62 }, { 0x4ab42b6d, 0xd6f2530b },
+    { 0x4d57f21b, 0xf501ec3a }, { 0xc029fe72, 0x47afccbb },
+    { 0xb30e5ab3, 0xbb772082 }, { 0xc8007d7c, 0x6c9d5237 },
+    { 0xacd0d55b, 0xe933fed7 }, { 0xf76bbfe5, 0x42a41cbd },
+    { 0xe60643bf, 0xed742e62 }, { 0x000a92f1, 0x7479bdfe },
+    { 0xdaa1fdeb, 0x3672637f }, { 0xf696c923, 0x7f6bc059 },
+    { 0x9f573667, 0x080078b7 }, { 0x35e0504e, 0xdadd4405 },
+    { 0x0002555b, 0x41db8d6d }, { 0x6bdd193d, 0xaa1e1861 },
+    { 0x34d6ee11, 0x48ffd957 }, { 0xad8f98c2, 0x96aba2de },
+    { 0x5d2a5d3a, 0x595197be }, { 0xfcf1ae06, 0xba47f33f },
+    { 0x0301620f, 0xdf9cdf8d }, { 0x46db8adb, 0x497b3eed },
+    { 0x74713c4e, 0x7d3b0233 }, { 0x6e3aa8f0, 0x2604d189 },
+    { 0x9eb50a80, 0xfba7c115 }, { 0x9bc71368, 0x7125d706 },
+    { 0xf6b63698, 0x1513da22 }, { 0x1c26c777, 0x2b96cda0 },
+    { 0xf25ff213, 0x060edc1d }, { 0x99ac6e7e, 0x5bdcf9c8 },
+    { 0x57073cca, 0x3ca35cf6 }, { 0xe4dd20a1, 0x15e05e63 },
+    { 0x87ca5ba9, 0x80e58e01 }, { 0x6338f9c9, 0x7be5ec74 },
+    { 0x089a3d6e, 0xecd5d13b }, { 0xbaa9397a, 0xef577ccb },
+    { 0xc2c37889, 0x534f3742 }, { 0x3e9e9cfa, 0x89422f70 },
+    { 0xa76d182e, 0x89808b67 }, { 0x42d6e000, 0xc7899438 },
+    { 0x83b57564, 0xe1dde6e3 }, { 0x583d30ce, 0x9241d73e },
+    { 0xbcc76395, 0x604b9e9b }, { 0x1f34c379, 0x8ca88532 },
+    { 0xe7251fbd, 0xd84c67a3 }, { 0x04f74e01, 0xf5f93b59 },
+    { 0x9f31ac40, 0x3085b01c }, { 0xeb35e9bd, 0x3579148e },
+    { 0x889ed7a1, 0xe7f745c7 }, { 0x0194c05e, 0x403002bd },
+    { 0x87882670, 0x26cb74a9 }, { 0xb14d30e2, 0xf299d4d9 },
+    { 0xb4e22db4, 0x0bc459cd }, { 0x4d0272db, 0x43bb0705 },
+    { 0x08b5b882, 0x9e781833 }, { 0xa6825e50, 0x250dabc8 },
+    { 0x166bfca6, 0xc6faace0 }, { 0x017a5a56, 0x3cf372a8 },
+    { 0xa5987bee, 0x2d4348a7 }, { 0xdf14eadd, 0x7ab2da6c },
+    { 0xd3ad1559, 0x4fa6962d }, { 0x74c7f0cc, 0x77020b9e },
+    { 0x1b6ab3ef, 0x981feb42 }, { 0xe1ff4a9b, 0x3f73e6c8 },
+    { 0x3eff44e4, 0xf6c8fc64 }, { 0xf91d6eb3, 0x7ad15458 },
+    { 0xeaca7276, 0x885dee3b }, { 0xb6bc1d77, 0x78377493 },
+    { 0x8635be67, 0x5f86c5c3 }, { 0x2f4a40d7, 0xe5964f0c },
+    { 0x142fe0d4, 0x0f7d6d52 }, { 0x2f49cf57, 0xcdf5da8d },
+    { 0x19668f2f, 0x83900516 }, { 0xa66167d1, 0x7b61e196 },
+    { 0x8a55068f, 0x4f26922e }, { 0x05731d76, 0x6bfb9e26 },
+    { 0xb334aa14, 0x9cc3cee4 }, { 0xd133845c, 0xb51c4e74 },
+    { 0x72388351, 0x7eef8a0e }, { 0x53e90cb9, 0x31fc761a },
+    { 0x1fe1fed6, 0xfa337e0b }, { 0x51c8b7ea, 0x1bde561b },
+    { 0x89d04250, 0x67a9c8b3 }, { 0xb7996efe, 0x227a8cb9 },
+    { 0xc73bbca5, 0xf70b272a }, { 0xf779fbd8, 0x6bf2d5f4 },
+    { 0x53b9b496, 0x2000c953 }, { 0x658940d3, 0x139a2e76 },
+    { 0x8a5e01db, 0x1f777c55 }, { 0xe6255241, 0x61e1eb72 },
+    { 0xe72f5b2c, 0x7d5af4a6 }, { 0x22103271, 0x8ede87bf },
+    { 0xe19bb627, 0x9068a66b }, { 0xe037afa4, 0x1e973133 },
+    { 0x2fd4c276, 0xd12c9069 }, { 0x52149af8, 0x38872f1d },
+    { 0xb77076a3, 0x4f624c96 }, { 0x9108244e, 0x5ec1c860 },
+    { 0x869483b5, 0x72e981b7 }, { 0x971924da, 0xdb0f03e8 },
+    { 0x2c5d9f87, 0x57dfe0c2 }, { 0x7b70c075, 0x9bd9127b },
+    { 0x551c56e4, 0xed1b256c }, { 0xac5deabb, 0x7a52eec2 },
+    { 0x2c4d6aac, 0x2a6a6204 }, { 0x18de98f6, 0x80389057 },
+    { 0xa144d263, 0x7da6d0c6 }, { 0xc925c778, 0x73747fb1 },
+    { 0x0f74c77c, 0xcbf4a32b }, { 0x24093f3e, 0x3dcc237c },
+    { 0x204a788c, 0xb7e9daa0 }, { 0xc1c33f7b, 0xfdd3670d },
+    { 0xb5583577, 0x1cf0048b }, { 0xfee1aabb, 0xd574c1e9 },
+    { 0x196093e5, 0x1607bfd5 }, { 0xbafad665, 0x59600d6b },
+    { 0x1e428c24, 0xb793476f }, { 0x6e16979f, 0x09f5d51b },
+    { 0xe278c1d4, 0x6b62f3b9 }, { 0xd3f8d91a, 0xd3a5ad01 },
+    { 0x3f626abf, 0xa3964bd3 }, { 0x7bb92825, 0xa598f3d3 },
+    { 0xb7b26f79, 0xb1002df4 }, { 0x5005155c, 0x91c4b20d },
+    { 0xa5beb99a, 0x4f33c245 }, { 0x5d67ebfc, 0x124490e8 },
+    { 0x77f77d2d, 0xaa8f0142 }, { 0x782ebc7a, 0x5359770b },
+    { 0xada21ba9, 0xb5308a47 }, { 0x945f09e1, 0x70c6dbdf },
+    { 0x8e0c9205, 0x997efee8 }, { 0x128460c4, 0x499bf734 },
+    { 0x9dcb2ea9, 0x4cf1b2c9 }, { 0x8df97ef4, 0x3e349abe },
+    { 0xb49cf1ac, 0x99385407 }, { 0xf4cd7efa, 0x0e705ff8 },
+    { 0x88d89001, 0xcf351544 }, { 0xf1c78027, 0x4d5ed7f9 },
+    { 0x4d4e6f21, 0x91213539 }, { 0x2ec4a59e, 0xcf03ba4e },
+    { 0xf773fe63, 0x89530181 }, { 0x11ae9ed1, 0x0133f0cb },
+    { 0x1af153cf, 0x6f8eb69f }, { 0xc7251194, 0x705a744c },
+    { 0xe4b0a557, 0xe4c3d980 }, { 0xc10ad3f8, 0xb4343b61 },
+    { 0x173d75b0, 0xd626962c }, { 0xb5f20f6e, 0x9c08fcdb },
+    { 0x0d7ae454, 0x56078bf3 }, { 0x6bea4d3b, 0x00854933 },
+    { 0x29112035, 0xb54ed36d }, { 0xe2778f74, 0x1f64b9d8 },
+    { 0xac374d22, 0xfd80e54d }, { 0x57a108f5, 0x9a9ae5c8 },
+    { 0xa857cf44, 0x61c90a45 }, { 0xff5cc66a, 0x46916600 },
+    { 0xe57a8116, 0xabe5a18b }, { 0x0add97be, 0x5671e9de },
+    { 0x346edf1c, 0x212db998 }, { 0x6a6d1e60, 0x8b74b8fe },
+    { 0x6092cdd1, 0xa4683257 }, { 0xb0092bdf, 0x37aa4aaa },
+    { 0x91b643e7, 0x13522f5c }, { 0xb9bb1503, 0xa0e62051 },
+    { 0x8b97593d, 0x268c10dc }, { 0x3068531d, 0x72640c29 },
+    { 0x1130d0d8, 0x85728f75 }, { 0x3be0d39f, 0xe81d373d },
+    { 0xe61d3dec, 0x68fd9564 }, { 0x775dda85, 0xe1df8f31 },
+    { 0x75a2ee55, 0x2620db10 }, { 0x530b78f9, 0x427bdf4e },
+    { 0x624eec36, 0x8284158e }, { 0x91d4f413, 0xf816afed },
+    { 0xb2a2d4f4, 0x35274a9e }, { 0xafcb1c92, 0xbccace44 },
+    { 0x6ef9ecdd, 0x51c5ba8e }, { 0xa2b6f09c, 0xb1650ed9 },
+    { 0xa0ce813b, 0x2ccff28d }, { 0x1fb5c9e1, 0x264a40d1 },
+    { 0x9c9602ad, 0x589a7216 }, { 0xd277888e, 0x3403e91a },
+    { 0x48312f2d, 0xe221648a }, { 0xcbbbf130, 0x58ebb59f },
+    { 0x8307df75, 0x46bad90f }, { 0x7fa274ae, 0x9dfb8f71 },
+    { 0xa4d1168a, 0x78260422 }, { 0x0b89cf27, 0xb8baa983 },
+    { 0x9c857a5c, 0xcdf1e117 }, { 0x10119b7a, 0x128c353b },
+    { 0xe486972c, 0xdbb5c588 }, { 0x1ce2ee97, 0xcdbe0a7c },
+    { 0xc4b259f2, 0xe7104417 }, { 0xc7d2241c, 0xf92b66d3 },
+    { 0xb68120f8, 0xa0582699 }, { 0x3c52f2e2, 0x51178728 },
+    { 0x927f3888, 0xaf04230c }, { 0xaef1028c, 0x74057830 },
+    { 0xed1820b8, 0x8c5bf251 }, { 0x1f7d9dba, 0x08d11749 },
+    { 0xac52af7c, 0xf904cfe5 }, { 0x61ea5b3a, 0xc528fe4e },
+    { 0x2e971068, 0x8d377514 }, { 0xf2f409de, 0x491b8ba6 },
+    { 0x994581b0, 0x6e603522 }, { 0x56954d9a, 0x4945ac86 },
+    { 0x198371cd, 0x37cc7af0 }, { 0x1128eb09, 0x1091e797 },
+    { 0x45001f1c, 0x88a16d72 }, { 0x6ad3f0d1, 0x3fb5a1c1 },
+    { 0xd63d32c0, 0xed1a2faf }, { 0x490f2d03, 0x7ef7cb94 },
+    { 0x2545e4c6, 0xd9c5ccc1 }, { 0x410301c2, 0xd15fb13e },
+    { 0xaabac7ae, 0x669b37f5 }, { 0xf9fa6b69, 0x645ee392 },
+    { 0xfa0c96a6, 0x896cde51 }, { 0x44167563, 0xfefa1e38 },
+    { 0x83ef264c, 0x59444113 }, { 0xadb71171, 0xc0e3ae62 },
+    { 0xd7d60a77, 0x308db8d3 }, { 0x55d05ae8, 0xb2b6dd89 },
+    { 0xb85275d0, 0xb232d5b2 }, { 0xff30aa4d, 0xb5423ab8 },
+    { 0x09d5a9ad, 0x617224bd }, { 0xdc23bc34, 0x0c125c82 },
+    { 0xa2ba71fb, 0x6c2fb596 }, { 0x68a1a309, 0x02ef6128 },
+    { 0xcaee4d11, 0xf7e16d81 }, { 0xecc438ee, 0x318b9a36 },
+    { 0x8b96eece, 0x6a0d53df }, { 0x1ea98ca6, 0x0fceb27e },
+    { 0xe3b2c2f4, 0xbbba7873 }, { 0x4f9a6f63, 0xf2e39d3d },
+    { 0xf4e1d8e6, 0x8fe7cb1c }, { 0x1731e633, 0x352d4e59 },
+    { 0x553880c5, 0x500cca76 }, { 0xbfa43fb8, 0x19c91b42 },
+    { 0xdd2b6ecd, 0xe8d57cf1 }, { 0xf1012f88, 0x55eaa6d3 },
+    { 0x426c2678, 0x4927d67c }, { 0x03f1b64a, 0x94412a8d },
+    { 0xdadd5638, 0x1ddea633 }, { 0xa8a25266, 0x82abc4f9 },
+    { 0x7ddfc714, 0xf8477a5b }, { 0xe213c9fd, 0x8e3eea77 },
+    { 0x7ae06bac, 0x373b594d }, { 0xf4fe0f65, 0x57bde782 },
+    { 0x630a8f88, 0x1a5436f1 }, { 0x4be25dcf, 0xdc75128f },
+    { 0x0295ec7e, 0xad0b31c4 }, { 0xacb60588, 0x160965b1 },
+    { 0x87736a7a, 0x021f6609 }, { 0xc16644a6, 0xe860daa7 },
+    { 0x339cb7a6, 0x67cdcd25 }, { 0x59ca95af, 0xb2f75a9a },
+    { 0x6c41ca71, 0x3c24dbb3 }, { 0xecbcd1b3, 0x1985710d },
+    { 0x0f5d9733, 0xe60dbefc }, { 0x692986c9, 0xcad5c723 },
+    { 0x7f8b508c, 0xf112598a }, { 0x2f76a4c4, 0xbdf467d1 },
+    { 0xb696403b, 0x20464e5c }, { 0x81739124, 0x48335350 },
+    { 0x921954a7, 0x8daa95bb }, { 0x7ecb497a, 0xbd1e8888 },
+    { 0x3ae361f7, 0xc204e237 }, { 0xc2b7be0d, 0x77cbaab7 },
+    { 0x6b3806dd, 0x07548ae6 }, { 0x1c830367, 0x13579a04 },
+    { 0x6d394a9a, 0xa1e7968b }, { 0xd9091358, 0xdcf7cd86 },
+    { 0xc9784b34, 0x72f189d2 }, { 0x39213952, 0x71967392 },
+    { 0x37e6e8d4, 0x55e62043 }, { 0x0836994a, 0xa0b39a29 },
+    { 0xb36ccd7f, 0x752066ef }, { 0x88317487, 0xd2527ac3 },
+    { 0xead810e9, 0x3821331f }, { 0x18de603d, 0xc51d13ca },
+    { 0xc59d58a7, 0xc98c499c }, { 0xe1755410, 0x6db11f83 },
+    { 0x4cb655ce, 0x0d772990 }, { 0x1fee4738, 0xedf611f6 },
+    { 0x6c7cd2ad, 0x25d7441e }, { 0x4a62b56a, 0xae8db102 },
+    { 0x3689ef9e, 0x4f91a4e1 }, { 0x44b49559, 0x71aa368f },
+    { 0x9e714899, 0x0e673b7d }, { 0xeaf66751, 0xb2dc0f7c },
+    { 0x0bc485f2, 0x845a1eb3 }, { 0x049ec646, 0x2c32788c },
+    { 0x5021f16e, 0xaadec2b5 }, { 0x0220d33a, 0xfd94dfb9 },
+    { 0x82641c81, 0x830f6f6d }, { 0xdcf812e7, 0x60b734cc },
+    { 0xcf3ed768, 0xa60de661 }, { 0x5d9500bc, 0x3cc9afc7 },
+    { 0x7916128a, 0xf665d22e }, { 0x7f73a7d8, 0x97fa6d9e },
+    { 0x0d08e065, 0x7a1ae0bf }, { 0xb872d3de, 0xf6f4d56f },
+    { 0xf21eef25, 0x70435bd7 }, { 0x4e3fc901, 0xba54453d },
+    { 0x20525616, 0x336a310c }, { 0x84f3faf8, 0x6b783de4 },
+    { 0xf90a7090, 0x3c248d79 }, { 0x4d6a330f, 0x82d0c532 },
+    { 0xe18e3455, 0x3a5b7bbc }, { 0x396ba035, 0x64b00489 },
+    { 0x9c3f2596, 0xe2a16067 }, { 0x67602d50, 0x08d4aa5b },
+    { 0xf2a779f5, 0x244d85b5 }, { 0x10ba3127, 0xe8fbc011 },
+    { 0x73a875e8, 0x9167b9b8 }, { 0x4c956a32, 0x01147b3c },
+    { 0x53b6304f, 0x21eaa82b }, { 0xf1d1f6c1, 0x1737c6a0 },
+    { 0xd6737e3c, 0xe08df6d5 }, { 0xc2def0c4, 0xf4249cf9 },
+    { 0xc95e8e7e, 0x4b242846 }, { 0x5044fd5b, 0xa380d4d3 },
+    { 0x5ae0123e, 0x6be86609 }, { 0x84a8e4a9, 0x25a3fee5 },
+    { 0x60f12b26, 0xe1667445 }, { 0x9f5fcb7d, 0x9c219f45 },
+    { 0x1220a73d, 0x262f8505 }, { 0xdfa57509, 0x4e1c1e6f },
+    { 0xe2d6ed98, 0xa026c2b2 }, { 0x322fcf8e, 0x2bda419b },
+    { 0xf79f433b, 0x8d8b2b88 }, { 0x19860765, 0xdaac6b40 },
+    { 0x851394c6, 0xe6dc3681 }, { 0x5a25b0d1, 0x4ae4f406 },
+    { 0x0e52b8e1, 0x323ef562 }, { 0xfa49cccf, 0xe6ca41ab },
+    { 0x66eb3d57, 0x992876c6 }, { 0x5818645b, 0x5614679b },
+    { 0x0b6d1dcf, 0xe63ee3ab }, { 0xd8ce4053, 0x1be73f4d },
+    { 0x0e795d11, 0xe7564889 }, { 0x7d7fa0d9, 0x4fcd689d },
+    { 0x56a39182, 0x6fc5cd8b }, { 0xda61f659, 0x59089fef },
+    { 0x0656d919, 0xb617a597 }, { 0x2b8c05d9, 0xc68fc952 },
+    { 0x03ae3c26, 0xbd046273 }, { 0x22af76b0, 0xf5fd5b0d },
+    { 0xed017307, 0x5138f181 }, { 0x0b8aa192, 0x213a0954 },
+    { 0x369bb3bc, 0x34b227d2 }, { 0x25b17e93, 0xfedcecc9 },
+    { 0x264dea50, 0xb3d873f2 }, { 0x8d552462, 0x3294c37f },
+    { 0xf53c471a, 0x44daee83 }, { 0x8c57c82e, 0x339b2555 },
+    { 0x538d3c29, 0x735d5a26 }, { 0x262adc20, 0x725edab2 },
+    { 0x4a2824fd, 0xb397de65 }, { 0xbbc43830, 0xd301950a },
+    { 0x4793b7b8, 0xf754d308 }, { 0xaa97300e, 0xe62bc412 },
+    { 0x300ea1a2, 0x77629274 }, { 0xf629ed92, 0xd20ab75e },
+    { 0x23f20a50, 0xe00d3e98 }, { 0x5520fc1c, 0x3a1d2fb7 },
+    { 0x111f12d4, 0x456bd614 }, { 0xe2e58a8b, 0x46417b98 },
+    { 0xd0d9f920, 0x008e15f8 }, { 0xdb607ffb, 0x2ccc632b },
+    { 0xbe1c2b96, 0x249d40c5 }, { 0x7a24e571, 0x34040e76 },
+    { 0x1df9db49, 0xffeec199 }, { 0xd3d57ddb, 0x09c06f78 },
+    { 0x759d0f84, 0xafb74c26 }, { 0xecc35583, 0x653f9820 },
+    { 0xb596c3b1, 0x3f811869 }, { 0x7c71e57c, 0x3c14af01 },
+    { 0x4d9a414a, 0x879cceb6 }, { 0xe4eb8cdc, 0x2082db5a },
+    { 0xa861bc8f, 0xd6b10ac0 }, { 0x0832d763, 0x01cdfc3b },
+    { 0xd09aa545, 0x5b1f531c }, { 0xaad663dc, 0xa7757e38 },
+    { 0x6a04fdd1, 0xec2a70d8 }, { 0x320f4efb, 0xffc5d926 },
+    { 0x6a47d6c9, 0x0239c875 }, { 0xbff31342, 0xbb2116f7 },
+    { 0xa4b3f61f, 0x1a9e142d }, { 0xc08e62cd, 0x30a9d4fd },
+    { 0xb113aa9e, 0x6e2e2f5b }, { 0x4341337d, 0x3576c3f5 },
+    { 0x7fa52b06, 0xf476ff32 }, { 0xa6c2b954, 0x228af57b },
+    { 0x65879af3, 0x12f4aaba }, { 0x71990cea, 0x37b5cae9 },
+    { 0xbd9df117, 0xd7bf8872 }, { 0xfb5098e5, 0x63e71295 },
+    { 0xcb49db8a, 0xe1476880 }, { 0x704d437b, 0x6b42a4d3 },
+    { 0x3630c201, 0x7c35388b }, { 0x4b42b75a, 0xfcf108ee },
+    { 0xb037b625, 0xb194d084 }, { 0xf86d8860, 0xc1843c71 },
+    { 0x1a740b8c, 0xfa95d47a }, { 0x4571d2f6, 0xd8b079b0 },
+    { 0x8055a304, 0xc3a36bfa }, { 0x1abf7cb7, 0x820116cf },
+    { 0xb1b3f96c, 0x1751b8a1 }, { 0x9047084d, 0xcea9d6e4 },
+    { 0xdc5a65c2, 0x7d133151 }, { 0x9f15ea3a, 0xd137716c },
+    { 0xcdac041a, 0x435752be }, { 0xb13dc5a4, 0xf2727e4c },
+    { 0x4265af92, 0xcc8dcb06 }, { 0x35224cb0, 0x8af1eda5 },
+    { 0xbf4141cc, 0xf17b7a41 }, { 0x6f0d4c81, 0xf53cdcc7 },
+    { 0x296ac03c, 0x74c9aa8d }, { 0x5e67c7ce, 0xcc1337ca },
+    { 0xc7265f52, 0xd715385e }, { 0xe4772e3c, 0x3185e7d9 },
+    { 0xd1cab240, 0x1a37ea8a }, { 0x0c6d7b69, 0xf4d0d412 },
+    { 0x825ece65, 0x157d0cf1 }, { 0x339c2f92, 0x9255403c },
+    { 0xdb62c77b, 0x8a84e962 }, { 0x974cc2c7, 0x940f30f0 },
+    { 0xc763f071, 0xc22e2eab }, { 0xf1df21a2, 0xc857efed },
+    { 0xa23f951f, 0x24c7a328 }, { 0x5d37eb69, 0x4485695d },
+    { 0x2aed2cc4, 0x872de16b }, { 0x81230c13, 0x935d17ea },
+    { 0x06e7d858, 0xfca2be6a }, { 0xf19e8fdb, 0x4a5a8667 },
+    { 0x67249fe4, 0x0ec162c6 }, { 0xa33bdd14, 0xb8a63d0e },
+    { 0x50df2a51, 0xf1bca4dd }, { 0xf9e7fdf7, 0xf9b712d1 },
+    { 0xd467d290, 0x13074c5f }, { 0x7f220960, 0x84845081 },
+    { 0x46b65f4b, 0x2d0df937 }, { 0x68952152, 0x2d6e89ed },
+    { 0xddcbf015, 0xdf651a21 }, { 0x573f121e, 0x3c7b65bd },
+    { 0xd8544d20, 0xc9ae27dd }, { 0xfad8daa2, 0xb2f2a1fe },
+    { 0x47cdee08, 0x055998e4 }, { 0xf78fd38b, 0x738ed6fd },
+    { 0x095b2398, 0x236ba757 }, { 0x8ac966e8, 0x56735792 },
+    { 0x678a87f6, 0x3f7249cc }, { 0x3dcc897f, 0xb53fb9fb },
+    { 0x3a217de3, 0xa78cc189 }, { 0x7521a6ed, 0xe68dfe37 },
+    { 0xc90a4e39, 0x77b78358 }, { 0x06b72931, 0xc8d49cb5 },
+    { 0x080e99af, 0x7c857b9b }, { 0x0cbe8ffd, 0x4d51d356 },
+    { 0x423236c8, 0x6e27c387 }, { 0xb1024c47, 0xd0590a5b },
+    { 0x3dc7625f, 0xd4efe658 }, { 0xb5d11a77, 0xf5ffb72f },
+    { 0xaf17a5b6, 0xdffd8774 }, { 0x94774c9f, 0x5953fabc },
+    { 0x17de2399, 0x7f1c1b9c }, { 0x02756137, 0x2c77f5f2 },
+    { 0x638b8d03, 0x0b27861d }, { 0x0eb4fac3, 0x5bc667b6 },
+    { 0x7e9ad19c, 0x8efa5693 }, { 0x718abdc3, 0x7c451edb },
+    { 0x4fb0f21f, 0xc246e3dd }, { 0x09070a7d, 0x9ad8a365 },
+    { 0x058bf54e, 0x97951c47 }, { 0x6c338937, 0xddbc27f7 },
+    { 0x39647842, 0x5bfee8c2 }, { 0xea6172c8, 0xd289a347 },
+    { 0x2fdfe013, 0x038a0171 }, { 0x3abbd960, 0x99093acd },
+    { 0x1af27d0f, 0x0a83eb86 }, { 0x1611870d, 0xbf4d72c6 },
+    { 0xd872c879, 0x3cc79273 }, { 0x50d73889, 0x3fca1b23 },
+    { 0x1abb4abf, 0xed326da4 }, { 0x22f2a449, 0x29c536c2 },
+    { 0xfb984462, 0xd2c22b8f }, { 0xe996c5d3, 0x00cadf98 },
+    { 0x7b2c4ce7, 0xfc228d95 }, { 0x3a5d7823, 0x48cf3b67 },
+    { 0xea487561, 0xcc924ce4 }, { 0x2427c647, 0xa7ecb303 },
+    { 0x71de755c, 0x45b7f8ef }, { 0x7a082305, 0xe186c903 },
+    { 0xdcf6e146, 0x128def92 }, { 0x22e22995, 0xdbf908b1 },
+    { 0x02de8dc7, 0xcc5359c2 }, { 0xbd33c8f3, 0x86cad2dc },
+    { 0xf060f2cf, 0x6533900b }, { 0xc86b4a11, 0xd85a0597 },
+    { 0x932d407d, 0x1ae8623a }, { 0x31e31abc, 0xdb7aab69 },
+    { 0xd0f52b0b, 0xda5c5dad }, { 0xeea73376, 0x61abcd5d },
+    { 0xb8e986ee, 0xcdef446c }, { 0x39cac578, 0x15056fc1 },
+    { 0xba5857d5, 0xa82ec0e4 }, { 0x64aa66b6, 0x110585b6 },
+    { 0x04ebc938, 0x0a8d0939 }, { 0xbb010eb0, 0x85d25fc3 },
+    { 0x86b09fb4, 0x5b72ee91 }, { 0x4678e73b, 0xbe315e4d },
+    { 0x35d21328, 0xaf36d57b }, { 0xc8f71563, 0x40b564e7 },
+    { 0x3ab0c843, 0xc240282c }, { 0x6e818a97, 0x60ee539f },
+    { 0x85196948, 0x8e8809c6 }, { 0x23001123, 0x26e72308 },
+    { 0xba377305, 0x2b49b65c }, { 0xd8f5f6f8, 0xb09e0cd4 },
+    { 0x6181b109, 0xf0a746b8 }, { 0xed4dd4fb, 0x8b1a8cfa },
+    { 0x4cf551c4, 0x307e2350 }, { 0xf74c57d4, 0x3f665b11 },
+    { 0xea2f3180, 0xc101b511 }, { 0xc8720527, 0x74b2527f },
+    { 0x16609248, 0xe1e467c6 }, { 0x7373db2c, 0x7d4fa74f },
+    { 0xe96494f2, 0xf60a6dd3 }, { 0x903118c9, 0x7e6801a6 },
+    { 0x9acdbe7a, 0xfb41c3ea }, { 0xe782d230, 0x2c89a91c },
+    { 0x3953e7de, 0x90506b9a }, { 0xec9bea3c, 0x4fb77c6c },
+    { 0x44fbb6cd, 0x4c00cc74 }, { 0x34286db1, 0x4ac21d6c },
+    { 0x2a110815, 0x8e75cd7e }, { 0xd0f1ae9b, 0x9aa5fbd9 },
+    { 0x4a859b50, 0x1713a88e }, { 0xacc2d856, 0x88689513 },
+    { 0x2d49df52, 0x0f8076ec }, { 0x3f6c0d15, 0x2edd4184 },
+    { 0xeb60acfc, 0x567c945a }, { 0x71b8aef3, 0x2db9020d },
+    { 0x4c38ae0a, 0x23c0b7d5 }, { 0x60cfc563, 0x3fa084ea },
+    { 0x2e54b56f, 0xba15b50a }, { 0x7ad66058, 0x63193fa0 },
+    { 0x39e6d0ff, 0x0f022464 }, { 0x09b34ac3, 0x1c272750 },
+    { 0x2cd1ab3b, 0xcebc83a4 }, { 0xe54f391a, 0xfaf15613 },
+    { 0x8004bda4, 0x1174d293 }, { 0x80492916, 0x30e53a3d },
+    { 0x2077738e, 0x0d570456 }, { 0x9f18be28, 0x0960b8bf },
+    { 0xc200a1b7, 0xa88594cd }, { 0xcb0c9f6e, 0xd8e70472 },
+    { 0x08d86598, 0x16a31469 }, { 0xc90e4ea9, 0x8226cd5e },
+    { 0x5609e507, 0x935ce73d }, { 0x341696d7, 0xf03307d5 },
+    { 0xcfa86e37, 0x49147af7 }, { 0x96064d6c, 0xd2cfd392 },
+    { 0x2e504685, 0xef294e4b }, { 0xc99f4a0b, 0x1e133610 },
+    { 0xa7845faa, 0x570ba077 }, { 0xf04231e3, 0xfa11c690 },
+    { 0x36f9a865, 0x59ef449c }, { 0xc031d412, 0xacb48c00 },
+    { 0xf390948d, 0x9e16ad03 }, { 0xa26080cc, 0xca4a7400 },
+    { 0x147055b3, 0xc0e7f803 }, { 0x28f79a31, 0xf3e13c00 },
+    { 0x70d9f38d, 0x17a07b2e }, { 0xbb1aaa29, 0x890d4a2a },
+    { 0x8e70ae9a, 0x821e42c3 }, { 0x5443eb16, 0x5c901972 },
+    { 0x4a225b41, 0x06ac2e3b }, { 0x3c30aeb6, 0x4cd3dbc3 },
+    { 0x14b69f97, 0x34172689 }, { 0xc96a7f32, 0x293cf3e3 },
+    { 0x77df1e7d, 0x9224b244 }, { 0x6e25c4b8, 0x7af07965 },
+    { 0xb5163d0e, 0x3a84140b }, { 0x26148a43, 0x240e1e5e },
+    { 0x06e2b463, 0x484acf73 }, { 0x6dd1e039, 0x7dfd2cf3 },
+    { 0x31470bd8, 0xd92253a2 }, { 0xe0501b7a, 0xf85cf001 },
+    { 0xfc63efb6, 0xf5c003d2 }, { 0x946bf5a4, 0x5cc49bef },
+    { 0x93dfd8d9, 0x72aacfc3 }, { 0x02a966d0, 0xb0523e4c },
+    { 0xfaf66b1a, 0xed69b9f2 }, { 0x28d549f7, 0xd98e4b7a },
+    { 0xa89e1e83, 0x9089c253 }, { 0xd7b368ef, 0x7e04494f },
+    { 0xeb53cbb8, 0x70c5ea41 }, { 0x09e906c0, 0xf342b9fb },
+    { 0xf72b7d7f, 0x61fb1b80 }, { 0x9056280d, 0xe34f41a3 },
+    { 0x88492ce3, 0x74d788fa }, { 0x9b74abd0, 0x5a77f8e5 },
+    { 0xf99f4714, 0x8cabbaf7 }, { 0x74591617, 0x1073f19a },
+    { 0x602fc5d6, 0xb0c044d6 }, { 0x66f30c48, 0xa3df6c00 },
+    { 0x6eb04612, 0xf66e2c4b }, { 0x050c88e1, 0x1fa454fe },
+    { 0xc325edd5, 0x0298a717 }, { 0x45721c0c, 0xd8b2f2aa },
+    { 0x4ceb2b42, 0xc1f58f44 }, { 0x4df27e92, 0xf3de3039 },
+    { 0xc34890d7, 0xf06e07c6 }, { 0xb0cd07a8, 0x89443ee9 },
+    { 0x85edf75d, 0x74bb93a9 }, { 0x07b74778, 0x8adb6c13 },
+    { 0xedbc8372, 0x37e06171 }, { 0xb3af31ef, 0xc387b411 },
+    { 0xd8c840ef, 0x9dfff68c }, { 0x1ff9f20b, 0x5b4c6ae9 },
+    { 0x0d7cec11, 0x21b25bc8 }, { 0xcfe3cc74, 0x21452566 },
+    { 0xb5fe7700, 0x1e7ccdf8 }, { 0x16df5a8e, 0xb30169f7 },
+    { 0x471c9a48, 0xc379142a }, { 0x17b028ea, 0x59b43088 },
+    { 0xc83944dc, 0x4b9ad4b7 }, { 0x1def31ab, 0xfed157e2 },
+    { 0xa9e8d68b, 0xc3a5c8a9 }, { 0x46e40392, 0xd5a9aeb8 },
+    { 0x94d1a47d, 0x2c0eec90 }, { 0x955d16ce, 0xec7485d0 },
+    { 0x84b01ec2, 0xfa9419b1 }, { 0x76b2425f, 0x8c67d69d },
+    { 0x2cc18132, 0x4b80730f }, { 0xa3f13fa7, 0x2b864d77 },
+    { 0xa7a0db71, 0x68facd04 }, { 0xf9a2864a, 0x40dd9a4a },
+    { 0x304e7b94, 0x53d45704 }, { 0x9797fff2, 0x07eca89e },
+    { 0xabe8a030, 0xa6dad61d }, { 0x67fc9033, 0xfe0777a7 },
+    { 0xc5b0b881, 0x403e5f57 }, { 0x625e8a96, 0x4a47a388 },
+    { 0x58dbaa0c, 0x77d8f9a8 }, { 0x1870fc82, 0x96deec7b },
+    { 0x531df4b5, 0x81f8b082 }, { 0xc7c24645, 0xbe78f178 },
+    { 0x147e11a8, 0xe38c6ec5 }, { 0x69af1486, 0x1e488736 },
+    { 0xa16aa2e5, 0xca31a21a }, { 0x48585a62, 0x638b33b7 },
+    { 0x82f83b1d, 0xac1b8759 }, { 0x60d8eb9c, 0x21cd0996 },
+    { 0xe9ae6918, 0xf089d885 }, { 0x8c6443ed, 0xc0aa2b43 },
+    { 0xb71e1242, 0xde3850b3 }, { 0x29f00d9b, 0x93aceda8 },
+    { 0x0dba0517, 0x05c4a9e1 }, { 0x494c23c0, 0x241975e3 },
+    { 0xf4f695ed, 0xd47eb42a }, { 0xe8972c29, 0x3f937e5a },
+    { 0x77fc8b18, 0xa354ea72 }, { 0x887d8036, 0x83c7ba50 },
+    { 0xdd71e3cb, 0xaf8fad32 }, { 0x4b4c9e29, 0x556ce3ae },
+    { 0x9e39c602, 0xc85c199b }, { 0xe6994f87, 0x20f97ef1 },
+    { 0x0e77da7e, 0x0c375131 }, { 0xd173d683, 0xec50fc9f },
+    { 0x9315cac2, 0x706fb1f7 }, { 0x67027c7f, 0x61f26a57 },
+    { 0xeb7d425d, 0x55689457 }, { 0xbd3ae3bd, 0xfbda4d32 },
+    { 0xbf9ab3a4, 0x19d84e59 }, { 0xc0c60096, 0x16dfda79 },
+    { 0xc29fcc10, 0x7897f8af }, { 0x2f21ec1b, 0xd5828cbf },
+    { 0xe497b672, 0x943d2a7f }, { 0xe58918f6, 0x0e277514 },
+    { 0xc1f32d6d, 0x4550b231 }, { 0x4c33e1f2, 0x683e79b8 },
+    { 0xc3f465a8, 0x440ea36d }, { 0x95426cc0, 0x78cf8fcb },
+    { 0xe065c798, 0x3cf96913 }, { 0x48cd6941, 0x7feaa339 },
+    { 0x96dedd2d, 0xa99a62ce }, { 0x0e4aa56b, 0xa49bf09a },
+    { 0xfc1479d0, 0x6544c987 }, { 0x6078315b, 0x8a3b60f7 },
+    { 0x80d2c768, 0xf41e6da3 }, { 0x9e2cc698, 0x8fa69264 },
+    { 0x54801993, 0x5ef601e1 }, { 0x675b691d, 0x99d97338 },
+    { 0x6acf848e, 0xb953585d }, { 0x6bbc41bf, 0x56eba124 },
+    { 0x64a0b1a2, 0x344c4c8c }, { 0xd19ed3e3, 0xd9423428 },
+    { 0xa184842c, 0x0a771a48 }, { 0x45149332, 0xb408e818 },
+    { 0x09b30312, 0x62e04449 }, { 0x19414e19, 0x01373e30 },
+    { 0x6efd0b72, 0xd4a5a3c5 }, { 0x3d08ce7d, 0x8a9022ad },
+    { 0x93cdde85, 0xe5943566 }, { 0x02670e18, 0xedf5ca85 },
+    { 0xd9408086, 0x95229b1b }, { 0xf8a1af99, 0x09ab8a25 },
+    { 0xc493aed4, 0x2efd2c46 }, { 0xd52debaf, 0x5e0407b1 },
+    { 0x3f0499f9, 0x10bcce56 }, { 0x56bbda87, 0xc86415cf },
+    { 0xab7111d7, 0x259687c2 }, { 0x8a26cfdf, 0x33b7d859 },
+    { 0xe88ffc4b, 0x90af3b34 }, { 0xe80215f9, 0xe184b248 },
+    { 0x6a5335a6, 0xd1aa55c7 }, { 0x93a4a610, 0xa7ce2f85 },
+    { 0x3f81826a, 0x78cec812 }, { 0xe8e76ff9, 0xbaee0357 },
+    { 0x38db6617, 0xe3a69590 }, { 0x92cfbe14, 0xaf873013 },
+    { 0xb0873285, 0x8e000435 }, { 0xe3e48ac9, 0xca620408 },
+    { 0x1900930b, 0x558f2310 }, { 0x465c4712, 0x29a97f30 },
+    { 0x7cded1a7, 0x3218c48e }, { 0x725046d0, 0x4d1da11a },
+    { 0xcbe831a2, 0x638759bf }, { 0xe210d665, 0xeff32441 },
+    { 0xdcd5c0a5, 0x6894ac23 }, { 0x64ddf202, 0xf53a73a2 },
+    { 0x116b88b2, 0xab56bae7 }, { 0x90731a13, 0x7bbec708 },
+    { 0x4c3e1f79, 0xd6e320cb }, { 0x9379c0ab, 0x99963b23 },
+    { 0x0caf6fbf, 0xda2aedc0 }, { 0xccbe1ec9, 0x3b028931 },
+    { 0x64f82536, 0x5ed26643 }, { 0xc4c0a5b1, 0x4c5d774b },
+    { 0x09c9cb36, 0x7d670a64 }, { 0x7288b342, 0xbb86329a },
+    { 0xcbf13304, 0x18e624d4 }, { 0xb1da976e, 0xb8dcf1ff },
+    { 0xbad5977b, 0x8a3dac11 }, { 0x423c3ded, 0x9810dd21 },
+    { 0xdc3cbbf0, 0x522771f4 }, { 0xa6ffd93c, 0xa7fe316a },
+    { 0x5cdec253, 0x17e5e6b0 }, { 0x8a33284f, 0x93d0b4ba },
+    { 0x45c42f27, 0x92746c10 }, { 0x4da12dd7, 0xddbfa5ae },
+    { 0xc3d8966c, 0xf15dc833 }, { 0x1ca07833, 0xb0993a0e },
+    { 0xd5bf34f5, 0x07231f6e }, { 0xaf5eeccb, 0x45e31751 },
+    { 0xa921fa69, 0x305f28f8 }, { 0xcae3b4b5, 0xa611b3d1 },
+    { 0x70b953e8, 0x01eacd14 }, { 0x325b4763, 0xbca5879a },
+    { 0xc2d3ad84, 0xac6d5f3d }, { 0xcbc41bc9, 0xf4bf356a },
+    { 0xe2bab262, 0xd6a6e709 }, { 0xe9515736, 0xed2c6d0c },
+    { 0xa9a8bd5e, 0xab63167a }, { 0xa673843b, 0x71ca7424 },
+    { 0x39acc053, 0xcf1955e9 }, { 0x8f655faf, 0x45f45a39 },
+    { 0xaa9f528a, 0xb8feb0dc }, { 0xed72ff9d, 0x4d65725e },
+    { 0x39f06326, 0xf76406ad }, { 0x09a2e5fb, 0xb7387746 },
+    { 0x7f5c8720, 0xe030157b }, { 0xcb227030, 0x0f4e02da },
+    { 0x9e6f85e2, 0xc145ef10 }, { 0x8dc2bfae, 0xb07ac4a1 },
+    { 0x10ae0455, 0xdfb452d0 }, { 0xff4859c1, 0xab24b3bd },
+    { 0xa1f2af46, 0x29d00596 }, { 0xec7f17f4, 0xa8bd20e1 },
+    { 0x57b9bbf3, 0x35edd070 }, { 0xf7e76103, 0xcbebfd49 },
+    { 0xd4274b3c, 0xd6bfed18 }, { 0x36b83d96, 0xfcfc2ab5 },
+    { 0x39c5fe1c, 0xebd33ff5 }, { 0x0a0f0144, 0x8cdf8200 },
+    { 0x5e95f107, 0x5e5cb274 }, { 0x2242071f, 0x4a5c05c6 },
+    { 0x2ec114c1, 0xa61bcf74 }, { 0xbb88b716, 0x705f40a7 },
+    { 0x2694f99d, 0x4c337272 }, { 0x74a67dd6, 0x4de09397 },
+    { 0x2a081517, 0x956708af }, { 0xd95e4a5b, 0xf9eafcf7 },
+    { 0x745318f3, 0xc2d42df6 }, { 0x83aea401, 0x6d65c68d },
+    { 0xa41e0bb0, 0xb50249a3 }, { 0xb77ad6fb, 0x680f27a9 },
+    { 0xbf4c5ffb, 0x63a47dd7 }, { 0x7f18df7a, 0x263df478 },
+    { 0x35089dd5, 0x0129d133 }, { 0x2fca76a6, 0xdc253026 },
+    { 0x83dcabc2, 0x64603804 }, { 0xb4360d57, 0xe2781cfe },
+    { 0xd32ef49a, 0x8f3931aa }, { 0x03cc6b7f, 0xcd32e89e },
+    { 0xc367c1e2, 0xdaf5fc68 }, { 0x5b2c3cc8, 0x951cb64f },
+    { 0x5ef180b2, 0x6a5ddc21 }, { 0x43f8289e, 0x4a1c633d },
+    { 0xea544e68, 0x9c697697 }, { 0x6c9210c1, 0xbf6ed9ca },
+    { 0xc819e4fb, 0x7ac6bf03 }, { 0x6c82f6df, 0x0cbfe425 },
+    { 0x79f2dbe1, 0x1210207f }, { 0x1496fd50, 0x332d1a1d },
+    { 0xd72a22cb, 0xe3711caf }, { 0x3c9a78d2, 0xe552b875 },
+    { 0xe0275d7d, 0xe906fc46 }, { 0x72b6b0b3, 0x65deabc3 },
+    { 0x9b66f41e, 0xf75456a3 }, { 0x9f32cb9d, 0x329b778b },
+    { 0x263b411a, 0x2a9fc1b6 }, { 0xb9c9b561, 0x059f3be1 },
+    { 0x23703997, 0x5936cd56 }, { 0x4885b1e7, 0x7c2d2568 },
+    { 0x86188ed0, 0xa0327d28 }, { 0xedd88b6f, 0x53ea50c1 },
+    { 0x7dcc408a, 0xdb3096b9 }, { 0xeac2112b, 0x43f718a9 },
+    { 0xed1152fe, 0xddf2b649 }, { 0xf31418ce, 0xe8b6ba1a },
+    { 0xd1953410, 0x27a163b3 }, { 0xeb87a363, 0x90fc0377 },
+    { 0x804c48ea, 0xba4fb333 }, { 0x0d8bae42, 0x7c5013f9 },
+    { 0xcb0698ea, 0x0c4d2916 }, { 0xd44f5134, 0xe2494bed },
+    { 0x03ab7649, 0xf8682cad }, { 0x0dec04b0, 0x0ae7b77d },
+    { 0x5cceea85, 0x5aa49690 }, { 0xc82cd2b2, 0x2e399a30 },
+    { 0x8e8adae3, 0x0d841132 }, { 0xb525d2be, 0x1f8bdbac },
+    { 0xbb42e718, 0x4e48b2c5 }, { 0xe1aa44af, 0x51c5ba57 },
+    { 0xde2f4c7f, 0xefcb773c }, { 0x7596c268, 0x740bf1e3 },
+    { 0x8df8fdb1, 0x1fe514f3 }, { 0xa64aacca, 0x46afe540 },
+    { 0x08e0e107, 0x489049a8 }, { 0x51d4e499, 0x905ae01f },
+    { 0x3f9eb06e, 0xfdf43a8b }, { 0x8fe00257, 0x3be68d2e },
+    { 0xd09cbe82, 0x16e2c453 }, { 0xf64f9b2f, 0xeb90cfa6 },
+    { 0x3748bd67, 0x0ab64625 }, { 0xfceb2e31, 0x181cbd11 },
+    { 0x01791dfc, 0x5a83cf91 }, { 0xe185583a, 0x51da6169 },
+    { 0x76fd3d83, 0xc1b46578 }, { 0xd719efe8, 0x141ceb8a },
+    { 0x3cabc647, 0x04e45c67 }, { 0x3bfb9f09, 0xbbbeab1a },
+    { 0x044a3d87, 0x901a5bdf }, { 0xf90d4f51, 0xdc5e9f4d },
+    { 0xad2d365e, 0x84d7a1e3 }, { 0xe6c88599, 0xad544c65 },
+    { 0xab1f1bbb, 0xebaa57f4 }, { 0xcf7021b3, 0xb7782744 },
+    { 0x67a0d4fa, 0xed52e4df }, { 0xd26c9438, 0x604244d0 },
+    { 0x04636d30, 0x4bf987be }, { 0x32aa15dc, 0x8cb46da5 },
+    { 0xcb51e620, 0x299b9c75 }, { 0x30cca62f, 0x6233b2dc },
+    { 0x74ce0cbc, 0x92b0a8a0 }, { 0x55faebb7, 0x76d15edb },
+    { 0x31f7273f, 0x8b9d6fe2 }, { 0x0dc318c4, 0x47c4cd84 },
+    { 0xe6885859, 0xc02113a8 }, { 0xb845cc7d, 0x73521de5 },
+    { 0xa33df012, 0x35438393 }, { 0xa11b8361, 0x4500870d },
+    { 0x7643caab, 0x7cd17513 }, { 0x562a2c95, 0xaf3bc99b },
+    { 0xd34b69bd, 0x9c1b0a02 }, { 0x3897ad5e, 0x729c30f2 },
+    { 0xca744203, 0xda20258b }, { 0x417ace88, 0xd07dd188 },
+    { 0xd6675caa, 0x1068ebe2 }, { 0xf6f5e5f9, 0x326e3455 },
+    { 0xb883fb55, 0x022bdc1f }, { 0x89c83e11, 0x177d85b3 },
+    { 0xb7f50651, 0x2757b91c }, { 0x62eb4700, 0xae49e175 },
+    { 0x34938ea6, 0xadc5eab8 }, { 0x1b53c207, 0xf8f0adeb },
+    { 0xa3daaba1, 0xa495d099 }, { 0x362213dc, 0xd946bcdf },
+    { 0xba42111e, 0x58ca326c }, { 0x2abc86b7, 0x5c03f5ec },
+    { 0xe81abf68, 0xd6143061 }, { 0x8fc3d8fe, 0x3ee5a1ef },
+    { 0x471567ce, 0x98737d0c }, { 0x5a8472aa, 0x2f86474e },
+    { 0x0eb425ed, 0x90739d55 }, { 0x91183f68, 0xc0913d26 },
+    { 0xea36115c, 0xda6be993 }, { 0xa4f9dc4c, 0xd6b7614a },
+    { 0x8b9f449f, 0xd86b13ec }, { 0xaf19b4a6, 0x30c7efbf },
+    { 0x55f6154f, 0x960b3d4a }, { 0xf92329d3, 0x7a18153e },
+    { 0x62261d51, 0xe3d2e49a }, { 0x6d462e04, 0x4c78948d },
+    { 0xb88ee9ae, 0x95145f9e }, { 0x7cff1bb8, 0x291ea00d },
+    { 0xf84db4e3, 0xa44e3a6f }, { 0x70b2d5b3, 0x9ab0d916 },
+    { 0xc6fc40f8, 0x6fd1f0f2 }, { 0x6dc9e123, 0x01c78b4b },
+    { 0x5bc6a2f3, 0xc3455e07 }, { 0x07ce6f9a, 0x509cf51f },
+    { 0xb6401d13, 0xf446bafa }, { 0x3a208241, 0x8d1c83dd },
+    { 0x8caddef1, 0xad2effbd }, { 0xcb4b7fa8, 0x36cb797f },
+    { 0x22941456, 0xe192e4e7 }, { 0x83849108, 0xeb431d49 },
+    { 0xd1d56496, 0x1e72ed36 }, { 0xec65e963, 0x233bfe9a },
+    { 0xa0d52054, 0xce9ade74 }, { 0x2ba26371, 0x2b6e7669 },
+    { 0x301f4475, 0x0cfa8747 }, { 0xdf320087, 0x9e79abbb },
+    { 0x56dd1035, 0x4d94fd83 }, { 0x0e121e54, 0x13194b49 },
+    { 0x72f3f912, 0xfa36d2e8 }, { 0x91d731ef, 0x6f74748b },
+    { 0xc8aa2a6d, 0xa3979957 }, { 0x2963dc1e, 0x5aa7e152 },
+    { 0x50205bd8, 0x3fccd646 }, { 0xcd7410a3, 0x5f64ef74 },
+    { 0x33bf6a39, 0x02cde234 }, { 0x8607fe2f, 0x2622384c },
+    { 0xe990ffaf, 0x1f8fdb14 }, { 0xcf68ea82, 0x938ca4b1 },
+    { 0x22351a00, 0x9d474fd5 }, { 0x1a5af0d5, 0x5eeb9a40 },
+    { 0x0ca03866, 0x2e7f9bc3 }, { 0xed687e51, 0x5f13df4d },
+    { 0x2fb0cd7c, 0xb47305c8 }, { 0x5a7d18ff, 0x56a72e13 },
+    { 0x136c7791, 0xa3a8ebdd }, { 0x793c1ee0, 0xf3c6f4cd },
+    { 0x3839e452, 0x1ecb856f }, { 0xddfbbdb2, 0xe280c2f9 },
+    { 0xff0def99, 0x0d4bbd5d }, { 0x0cdb5b20, 0x554de981 },
+    { 0xc2204f4a, 0x82b734da }, { 0xcd536be6, 0x23b2f0a0 },
+    { 0xbb533818, 0x2158184f }, { 0x57198877, 0xf8e5c5ec },
+    { 0xb5bc1b05, 0x906f91d9 }, { 0xb4d3abb3, 0x4d8d9972 },
+    { 0x45b7acb5, 0x9a07df4f }, { 0xcf836fae, 0x256876d2 },
+    { 0xbb1c1c6c, 0x14e3a5ac }, { 0x812acbfd, 0x9e16d12e },
+    { 0xfdf07f39, 0x153496e5 }, { 0xaa08a188, 0x633e0c79 },
+    { 0xfabee981, 0xf59e4c76 }, { 0xf7f4b11e, 0x4b0b9ae6 },
+    { 0x30698e19, 0x5806a794 }, { 0xf5757cfa, 0x05260d6e },
+    { 0xb32020ce, 0x40ad631c }, { 0x6d9c478d, 0x155a606c },
+    { 0x2c380f3f, 0xb3d49f47 }, { 0xda9047a2, 0x90a4e3c1 },
+    { 0xcf4334ee, 0xafaaf030 }, { 0xe531d5ed, 0x50ec370f },
+    { 0xe9e1cb9f, 0xa21e2aba }, { 0x41602c11, 0x07ececbd },
+    { 0x6802d796, 0xc08d273e }, { 0x5cac327f, 0xa9563a2a },
+    { 0xed64f8c1, 0xed53703e }, { 0x82db25bf, 0x0ed48ec6 },
+    { 0x3a2e020d, 0xc4f4d3d8 }, { 0xd934ffa2, 0x8b061937 },
+    { 0x4157e59b, 0x87997ac7 }, { 0xac947de7, 0x475deaa2 },
+    { 0xf62d359f, 0x29eed90b }, { 0x517dfa50, 0x9ae59cff },
+    { 0x3e48239b, 0x6223226c }, { 0x4ac778b1, 0x70a142c1 },
+    { 0x23eb381a, 0x9e5c0c22 }, { 0xf024e60c, 0xd3cb7f5c },
+    { 0xc6e21598, 0x24496f59 }, { 0x1a87cda2, 0x0a705a9d },
+    { 0x9001faf9, 0x6f6e6ac9 }, { 0xdd98c117, 0xd7f1b431 },
+    { 0x5dfecfaf, 0xdf952b1c }, { 0xd266fdae, 0xcd7409aa },
+    { 0xf334c363, 0x16a5de95 }, { 0x8548397a, 0x3e5b923e },
+    { 0xd06a3ac7, 0x97cc6556 }, { 0xdf47fa20, 0x7fd70e8c },
+    { 0x001525e3, 0x54284e41 }, { 0xed51df18, 0x76de1020 },
+    { 0xb542fbd6, 0xfb28f803 }, { 0x6ce4c6fe, 0xf696d4ea },
+    { 0xf18aef2f, 0x0c92a6b0 }, { 0xfed780b3, 0xab50ba6b },
+    { 0x430cb297, 0x2838c014 }, { 0x145e94f7, 0xb9701279 },
+    { 0x6bc0a09c, 0x8436b77d }, { 0xba1866f3, 0x28b7e553 },
+    { 0x0004aab6, 0x75d5e830 }, { 0x83b71adb, 0xd51eb804 },
+    { 0xdc1858e3, 0x19dda9c9 }, { 0x543d30c3, 0x4b1199f8 },
+    { 0x6e0b3ac2, 0xa5a15407 }, { 0x965c54d7, 0x7d2a94bd },
+    { 0x5b1e3184, 0x5b63008b }, { 0x31b43991, 0xc03aa598 },
+    { 0xba54ba74, 0xd5644fc3 }, { 0xb2a32f7d, 0x86a04ce8 },
+    { 0xfe40bb69, 0x78093388 }, { 0x748ee67e, 0x0a70d3ff },
+    { 0xa99bc8cc, 0xe56c1014 }, { 0x62d0fd8d, 0x16772712 },
+    { 0xee7c767c, 0x8e9d3f07 }, { 0x368fb8e8, 0x7bf2cd5a },
+    { 0x49a7d9d9, 0x20747135 }, { 0x5b3ba52b, 0xe44caa6a },
+    { 0x800eacc1, 0x94a0faf3 }, { 0xacce43d4, 0xce2bd636 },
+    { 0xe10326a6, 0x20bfe19d }, { 0x9ae78e78, 0x62ef8afc },
+    { 0x9854890a, 0x4a86165a }, { 0x85e36e62, 0xa958139e },
+    { 0x4e32ce6e, 0x16170634 }, { 0x8aec148e, 0xfc7baa9f },
+    { 0xdbe68e3b, 0x5f813724 }, { 0xb7f27b9e, 0x2af1e902 },
+    { 0x88561785, 0xa8df07cb }, { 0x6ce2d8c4, 0xa6dff71e },
+    { 0x941e7bba, 0x50398447 }, { 0x5b51b832, 0x46d3517f },
+    { 0x0ed3d949, 0x74a44039 }, { 0x1cdf433a, 0xa5ab9109 },
+    { 0x6d544567, 0x1f648833 }, { 0x8c851b83, 0xd975de54 },
+    { 0xb32eeb2f, 0x619f38f1 }, { 0x628f7f47, 0xb0d04c5f },
+    { 0x273612d4, 0x7a8d1e2d }, { 0x9b63553e, 0xa6afc845 },
+    { 0x71f91a11, 0xe48771d8 }, { 0xde08c51f, 0xcaaba97b },
+    { 0x79b0df51, 0x03a430ed }, { 0xdeaff997, 0x4eec0fcb },
+    { 0x89e59a2a, 0x9e9170d1 }, { 0xa69e6e84, 0xc4fb13e6 },
+    { 0x7d3d39f5, 0xd618e52a }, { 0x16e2fd7d, 0x04d7d63c },
+    { 0x4edb305d, 0x02209259 }, { 0x175db254, 0x748cf362 },
+    { 0x8a0a6eed, 0x73be1225 }, { 0x8f122870, 0x8e7ce198 },
+    { 0x0bc98714, 0xe1289b42 }, { 0xc3bacdc6, 0xd2094e22 },
+    { 0xb07a619c, 0x4ae79cf3 }, { 0x28e002d9, 0x427578bc },
+    { 0x798fc72b, 0xbde22d59 }, { 0xc4f5582e, 0xe5dcc170 },
+    { 0x42c71512, 0xb0cd4660 }, { 0x19500a64, 0x3f4db9ff },
+    { 0xd2a942c2, 0x333e8622 }, { 0xb099cf47, 0xd02559dc },
+    { 0x09ee9c02, 0x52df2449 }, { 0xf051cc2a, 0xeb0a8885 },
+    { 0x3e625880, 0x536e097b }, { 0x6568c505, 0x9c27d7cd },
+    { 0xdac77e8c, 0x2549eef6 }, { 0x6af2291c, 0x73ea1742 },
+    { 0x159a4823, 0x81130425 }, { 0xcfef8b8f, 0x05537774 },
+    { 0xa6c2840d, 0xaca039b8 }, { 0x23f907ac, 0x62f647db },
+    { 0x6fd62c26, 0x43607997 }, { 0xf12fb2d0, 0x24006a38 },
+    { 0xc360c03e, 0x5c3e70af }, { 0x45f70977, 0x64260930 },
+    { 0x0d5ddcba, 0x587bda93 }, { 0x784ddc5f, 0x6502c397 },
+    { 0x3d9d2370, 0x5a256d4f }, { 0x2b0f03b8, 0x8439896a },
+    { 0x7230125e, 0x6a771ec6 }, { 0xe0894b58, 0x9128d59e },
+    { 0xadca5c6e, 0xae54c917 }, { 0xaae0b76a, 0xaab1a3ed },
+    { 0xd070a4a5, 0xb8f9ba8b }, { 0xeeb93a8d, 0x704d432e },
+    { 0xa68df31e, 0x7d3eccf2 }, { 0x1d7f268e, 0xdfd061c1 },
+    { 0xabf6171a, 0x3de0da8e }, { 0xfe1f951c, 0xcd29d27d },
+    { 0x1eed757f, 0x20a9331c }, { 0x562a1796, 0x387eac94 },
+    { 0x4af467d7, 0x63db4d64 }, { 0x0012b304, 0xe50c5d3d },
+    { 0x8d272a76, 0xde393837 }, { 0x919d09ee, 0xf03456e3 },
+    { 0x979ac690, 0xf9bf1e4f }, { 0xd3d75622, 0xd8eefc1c },
+    { 0x24c4720c, 0x6f2b816c }, { 0x7ee7cd91, 0x75b860d8 },
+    { 0x825c112d, 0xd40297bb }, { 0xed90f8c8, 0x64f0d76f },
+    { 0xf698380f, 0x2c5f644f }, { 0xf9ff05b2, 0xa2bcba89 },
+    { 0xd595e4ed, 0x1ae28288 }, { 0x1518791f, 0xce94d5d4 },
+    { 0x6d793aef, 0xcc5c3885 }, { 0xf06ee926, 0xa08f6d01 },
+    { 0x10c81f17, 0xf75cc137 }, { 0xbf0d8b87, 0xe4aee0a3 },
+    { 0x62f21c87, 0xd36416a6 }, { 0xcb2d9e19, 0x4a6feeb4 },
+    { 0x285fc1a9, 0x711027dc }, { 0x235840c1, 0x2b84867a },
+    { 0x5e939eaf, 0x935daa56 }, { 0xa0476e6c, 0xc5a0d3f4 },
+    { 0x372afce7, 0x37d57360 }, { 0x07210a2d, 0x26e3c6d8 },
+    { 0x512173ba, 0xeb33f5b7 }, { 0xf6c3c32d, 0x06af53f6 },
+    { 0x14ab0d1f, 0x26296daf }, { 0xa2abfbe0, 0x6785ef19 },
+    { 0x0ae63aec, 0x635aa867 }, { 0xdc5556a0, 0xb5efc1ad },
+    { 0x6ac5bbbe, 0x4196d4d1 }, { 0x39869dc8, 0x301aa9f3 },
+    { 0xa6c4ecdd, 0xa4e1ef47 }, { 0x6a399ce9, 0xf6192d26 },
+    { 0xe47106a3, 0xcfa0db48 }, { 0xa1782985, 0x67cbb631 },
+    { 0x0897b637, 0xb58eb3a1 }, { 0x07912896, 0x71d499cc },
+    { 0xe35c82f5, 0x2e1be41a }, { 0x552c5d5c, 0x9c660f60 },
+    { 0x472a2c55, 0x2b71a179 }, { 0x9881030b, 0x1151b9ec },
+    { 0x7466e366, 0x496221a0 }, { 0x72eb8f84, 0x268257e1 },
+    { 0xcff87d36, 0x6f7cc4dd }, { 0xe88d144c, 0xc0a5dd83 },
+    { 0x320fa478, 0xacd06203 }, { 0x4edcee9e, 0x87b6dee2 },
+    { 0x928a2af7, 0xa676880c }, { 0x38aa44a6, 0xf149978a },
+    { 0x0838c666, 0x186489e0 }, { 0xe39a927b, 0x13a58124 },
+    { 0x2bd76163, 0xa7f03e83 }, { 0xcacdd1de, 0xed662cea },
+    { 0xb8550e10, 0x6780b3bd }, { 0x9fb359f7, 0x6afda9bf },
+    { 0x6fe467e7, 0xfbc2ab7e }, { 0x248831ae, 0x83c23fe3 },
+    { 0x71f866b9, 0xa5e75b99 }, { 0x9e4d2d7e, 0xc8844abb },
+    { 0xa4e58427, 0xaa47d4c2 }, { 0xc15470a9, 0xbf1485ee },
+    { 0x23fb8c83, 0x2a32ed1d }, { 0x8195ed93, 0xcefb860b },
+    { 0xc4ccfaad, 0xe45dffc3 }, { 0x3d2e6266, 0x0e5d925a },
+    { 0x64071e78, 0x5e031723 }, { 0xa6b68773, 0xf21dd7a0 },
+    { 0xa42935f1, 0xbac14ef6 }, { 0x756bbb04, 0xb29f5dcf },
+    { 0x6ee1ed47, 0x11a51f6c }, { 0x9ec4992c, 0xacffc301 },
+    { 0x266f2fa8, 0xf72b2beb }, { 0xbd8390c1, 0x2c810284 },
+    { 0x1185b8f8, 0x5cdd03a7 }, { 0xea316fc6, 0xe9e0700b },
+    { 0x2e3349b5, 0xef8fc3e6 }, { 0xba7deb74, 0xe59de183 },
+    { 0x58bb3f0f, 0x185d82c6 }, { 0xafbfc185, 0x2a9f6813 },
+    { 0xfb3fee7a, 0xa948b785 }, { 0x37b324f7, 0xba92d759 },
+    { 0xae9509be, 0xc3d6046a }, { 0xde95eebc, 0xee7e3137 },
+    { 0x58bad576, 0x49f75801 }, { 0xf9023159, 0xc201a005 },
+    { 0x589ad558, 0x810aa08f }, { 0x54d4c408, 0x7721d4db },
+    { 0x361aa991, 0xf99eadb1 }, { 0x007020ae, 0xaa8d5764 },
+    { 0x46e6c36f, 0x264e6b58 }, { 0xffaa0651, 0x00d65fd1 },
+    { 0x924a8ef0, 0x3f3c6774 }, { 0x8a803245, 0x05228030 },
+    { 0x7faeefbe, 0x4e1ba12c }, { 0xf8ad2913, 0xf2690a41 },
+    { 0xebaa3e03, 0x2a4a77bb }, { 0xdc5de13d, 0x8385252a },
+    { 0xe42db4ea, 0x70082d90 }, { 0xd0970a05, 0x019d9898 },
+    { 0xe44c193c, 0x678c5056 }, { 0x9f3f4bc8, 0x5fb80230 },
+    { 0xcb76cb28, 0xaabb412a }, { 0xdd780d49, 0xee7b53ed },
+    { 0xa15be6b4, 0x9b90d0e3 }, { 0x0bad2297, 0xdfb1423c },
+    { 0xd659621c, 0xd6264eb4 }, { 0x8cd4df70, 0x8dbbcc68 },
+    { 0xd6b90f87, 0xd358c7b4 }, { 0x56591108, 0x1cd66be0 },
+    { 0x9d4ab986, 0xddf69cb5 }, { 0x12c093f3, 0x5b59ca5d },
+    { 0x7fc6ed8b, 0xf456f4d3 }, { 0x74b0cd6c, 0xa1c2c9f1 },
+    { 0x68888e1b, 0xb2b11745 }, { 0x378a063c, 0xc4d941c8 },
+    { 0x08b51d71, 0x4e79f7e7 }, { 0x4ae3d660, 0x6639e445 },
+    { 0xdf897433, 0x7d7abf77 }, { 0xeac68503, 0x5812aa00 },
+    { 0x9b0bdd78, 0xb0e6f781 }, { 0xabf50763, 0x3e1d2d9d },
+    { 0x12fe422f, 0x20f51d7b }, { 0x62015be9, 0x72ff3d50 },
+    { 0xa00a2ab8, 0x4e8c3b5c }, { 0x27e5c128, 0x0b748b71 },
+    { 0x4b7c7334, 0x3fa2263d }, { 0xa2c418e3, 0xcce50085 },
+    { 0xbf2db35c, 0x9716a97f }, { 0x248921d1, 0xf94a2b54 },
+    { 0xf44b40a4, 0x301d790d }, { 0x551f0285, 0x5eacd021 },
+    { 0xf05d78f5, 0x11f9481b }, { 0xab0f4cd0, 0x042672dd },
+    { 0x5b453753, 0x1c205c79 }, { 0x6ebe7097, 0xf3782d76 },
+    { 0x2d1cf7ab, 0xa1d259b9 }, { 0xe18db7bf, 0x03ea848e },
+    { 0x2075f738, 0x0f873bcd }, { 0x32fcfdd0, 0xe074e72f },
+    { 0x2966aadd, 0x59552d61 }, { 0x97958b0c, 0x49655e8c },
+    { 0x3b975d53, 0xfefdb176 }, { 0x9e4105ea, 0x7ebeebc2 },
+    { 0x1bf3fde9, 0xc9a12efc }, { 0x7c69357d, 0x29650607 },
+    { 0x6d96440d, 0x59f2d2de }, { 0x3271a80f, 0x54f3472a },
+    { 0xedf85e51, 0xa58075e6 }, { 0x213e6375, 0xdef4c65b },
+    { 0x11b02002, 0xcd34a0a1 }, { 0xa2c9f6d4, 0x570864c2 },
+    { 0x4453a793, 0x090f7b90 }, { 0xfb82cecc, 0xb99d2e55 },
+    { 0x3e34da2d, 0xcd5277f4 }, { 0x8308cb38, 0x2f1023e7 },
+    { 0x0121b4ce, 0x8b53c58b }, { 0x419fc84a, 0x4a0ef9d3 },
+    { 0x4fab5d8b, 0x492e4a89 }, { 0xb63f06e0, 0x30e4847c },
+    { 0x84229adc, 0xe754ead5 }, { 0x632c80dc, 0x0e8f7669 },
+    { 0xd97be8cc, 0x30b48bf7 }, { 0x3fe28dc0, 0x7852a447 },
+    { 0x31e47d79, 0x4110e25a }, { 0x844c232b, 0x6f55a566 },
+    { 0x2a25a9eb, 0x35c8c0fc }, { 0x6d1f74de, 0xca133635 },
+    { 0xe2d9c73d, 0x51cdd1ae }, { 0xc92ed784, 0x04c67daa },
+    { 0xd213b646, 0xc371032c }, { 0x0d118d05, 0x948f294c },
+    { 0x0f7e1b0d, 0x9014fe68 }, { 0xdba9bb48, 0x0470c571 },
+    { 0x7bbaa9e6, 0xddbc2812 }, { 0x4fa8148b, 0xab0d3979 },
+    { 0x3899753b, 0x076dd3f8 }, { 0x61cff2a3, 0x036689ac },
+    { 0xf5ba4439, 0x203b83a4 }, { 0xcb610727, 0xc657aef6 },
+    { 0x688711c6, 0x4dc68408 }, { 0x4326af95, 0x8d65e582 },
+    { 0x586f9a45, 0x47d8b7d8 }, { 0xff5d2f88, 0x066e73cc },
+    { 0xaf4211ea, 0xec4e7819 }, { 0x3992a44d, 0xdaa47cb4 },
+    { 0x550c386d, 0x09c1b798 }, { 0xc392148a, 0x60ec0f33 },
+    { 0x031612b1, 0x2bb7bd57 }, { 0x8d22cc00, 0xfcfe57eb },
+    { 0xcaf4022c, 0x4f3fc975 }, { 0x5c27e830, 0x31461c96 },
+    { 0x15bb2f7d, 0xec2a6ed3 }, { 0xb141afd8, 0x41d85296 },
+    { 0x6d3b1b24, 0x5e79c402 }, { 0x425b7331, 0x316e1b73 },
+    { 0xd9385e6d, 0x93a22e70 }, { 0x16e871fc, 0x62c2c629 },
+    { 0xc1259ba3, 0xec02c57e }, { 0x4d2e8697, 0x20daba44 },
+    { 0x601357bf, 0xea60d3fb }, { 0x73b2ea89, 0x84d87eec },
+    { 0x27cb6416, 0x7209c99c }, { 0x26a45eb8, 0x54fe4134 },
+    { 0x77d48f7f, 0x8f67a7a3 }, { 0x41cd40a3, 0x2f2cf455 },
+    { 0x172fb27b, 0x96ce0e38 }, { 0x51765aad, 0x5fd05037 },
+    { 0x60d0a63a, 0x9f4503e8 }, { 0xe92672f3, 0x02af98fd },
+    { 0x26bf05b4, 0xdbc8e69f }, { 0x6ba97fa7, 0x380b4733 },
+    { 0x1b5a6b63, 0x806748f1 }, { 0x31008f40, 0xaf844f5b },
+    { 0x2d009ae2, 0xfca5106d }, { 0x7594eff9, 0xd819920c },
+    { 0x4f801430, 0x8375957a }, { 0x67571a40, 0xcb6f1437 },
+    { 0x8edd59f4, 0xa19927e8 }, { 0xad065766, 0x77d9cdaf },
+    { 0x49aebeb1, 0x3b116439 }, { 0xe5bcdfd6, 0xc260464d },
+    { 0x25623992, 0x676621b4 }, { 0xa8a165ee, 0x8c87e744 },
+    { 0x846d4fe3, 0xe30d5e9c }, { 0x93c5dcf4, 0xd4f068e6 },
+    { 0xc6090aa5, 0xf5bde9ce }, { 0xcb133461, 0x329001a4 },
+    { 0x033006dd, 0x0a40a0fa }, { 0xda593f45, 0xb7d9d77a },
+    { 0x818b2208, 0x3315b4d1 }, { 0x472432f5, 0xcee33c12 },
+    { 0xa6310265, 0x4412d881 }, { 0x066418d7, 0x89f91b45 },
+    { 0xa261e18b, 0xc2201d8d }, { 0xba6406e0, 0x19dbd289 },
+    { 0xe304a8e7, 0xac02498e }, { 0xad59606f, 0x34be76af },
+    { 0xdcc50774, 0x1911f40f }, { 0x54cca09f, 0xa4fc1923 },
+    { 0xa4ee111c, 0xd19ca9f9 }, { 0x6c653508, 0x02d099ea },
+    { 0x90625e5a, 0x91a368ac }, { 0xc443c915, 0xb2597ed9 },
+    { 0x9bd48f85, 0xb3bf0346 }, { 0xb1d76b3f, 0xe0526485 },
+    { 0x0a6c5273, 0x3f579b07 }, { 0x91d24f77, 0xa02c4701 },
+    { 0xff44e95c, 0xcd1cae9e }, { 0x4053841c, 0x06c0d0e0 },
+    { 0x49a32d15, 0xb6b1bcd8 }, { 0xf04c0844, 0xf2c50a5b },
+    { 0x1b7133e6, 0xf2ec3107 }, { 0x71745306, 0xd8b33156 },
+    { 0x3d695184, 0xc7fe3644 }, { 0xa03f5938, 0x07f7ca8c },
+    { 0x202336f5, 0x16e00824 }, { 0x2975c7dc, 0x0e1a8424 },
+    { 0xc90c2e58, 0x60cf0fa4 }, { 0xb76a8b10, 0x5c6465d8 },
+    { 0x3e23ba06, 0x445b26a6 }, { 0x9b7d14f9, 0x8c7d27a6 },
+    { 0x8dc25479, 0x3e03c08f }, { 0xd27e3737, 0x08618688 },
+    { 0x8fa54839, 0xa283e8c5 }, { 0xf6b4299f, 0xd25cfa18 },
+    { 0x6d0341f1, 0x28e4c981 }, { 0x450ee9b3, 0x6bc621fc },
+    { 0x7d034198, 0x7fd86a57 }, { 0x02f4ae8a, 0x7a11e118 },
+    { 0xc8973dbe, 0x42dc0a3a }, { 0xbecea6de, 0xbcc6b911 },
+    { 0xbea8e652, 0xd3ea96c2 }, { 0x8ba23c07, 0x72d21190 },
+    { 0x3af6a1b6, 0x20070d40 }, { 0xbc4f2700, 0x82dc6b94 },
+    { 0xe293465a, 0x975cdc1d }, { 0x72674d57, 0xbd9da0d2 },
+    { 0xfc3c59ab, 0x48f6ab2e }, { 0x52cd3f0f, 0x7c148ef1 },
+    { 0x24995139, 0x284480fe }, { 0x2de93bee, 0x5aef2707 },
+    { 0xbdf3c00d, 0x9636b737 }, { 0xbe083189, 0xb0425d24 },
+    { 0x89821c0d, 0xf3c8463b }, { 0xf2fc7786, 0xd4485944 },
+    { 0xd6220707, 0x4c862244 }, { 0x3d858b01, 0xfe03e8b0 },
+    { 0x0def3bf1, 0xd1eb1637 }, { 0x36245ce5, 0x2c755bb4 },
+    { 0x93cb4357, 0xd1f39a10 }, { 0x13312a82, 0xede0b8a4 },
+    { 0xc5ea5697, 0xa7df75ba }, { 0x81e86fe4, 0xcc0ccd36 },
+    { 0x2d997eea, 0x6aa6a3f2 }, { 0x7208b9ae, 0xa8fc0c7d },
+    { 0x366c0268, 0xc30f1cb1 }, { 0x2303ff20, 0xf3bf2938 },
+    { 0x0d40c4ba, 0x5a777b4a }, { 0xde93fa36, 0x3f3ee97c },
+    { 0x967cf12f, 0xd84bbb9c }, { 0xfdef9729, 0xae88cef8 },
+    { 0x4ee96ca8, 0x0592d05c }, { 0xb38a9982, 0x4c9f50d0 },
+    { 0x82060384, 0x78fa2ffa }, { 0xa71cf8e1, 0x4fd8343d },
+    { 0x55748f5c, 0x2367e318 }, { 0xd1949383, 0x47d7d8c7 },
+    { 0xf3f5d6d3, 0xd1e877c1 }, { 0xc8bdc725, 0x6531650f },
+    { 0xf87680f9, 0xf364f684 }, { 0x12d8bca2, 0xe0e2c15f },
+    { 0x8c8a8eaf, 0x9c37d545 }, { 0x025362ec, 0xbb0c6067 },
+    { 0x07df4c99, 0x3317186e }, { 0xb6e5790c, 0x26e0fcae },
+    { 0x5b6f22e3, 0xafe3b218 }, { 0x81c65cc4, 0x92e704a3 },
+    { 0xb40bee76, 0x9155357f }, { 0x611b71a7, 0x3ece2325 },
+    { 0xaffd1256, 0x9c30a464 }, { 0x69ca1473, 0x587a09d3 },
+    { 0x70a5eba1, 0x45e5a97e }, { 0x68c206f9, 0x45042948 },
+    { 0xfe60549a, 0xbd2e9ec3 }, { 0x6a857571, 0xac4ca4be },
+    { 0x1808f823, 0xd4c7895b }, { 0xc2e4497a, 0x734167b8 },
+    { 0x5bdf04b6, 0x7a57a8a1 }, { 0xbbbdfbe6, 0x1d63962c },
+    { 0xa63a00b8, 0xd7794ea1 }, { 0x7bf82955, 0xad19d8b3 },
+    { 0x3208a558, 0x975bac44 }, { 0x66a3a12d, 0x02768d9e },
+    { 0x3975964c, 0x3dfd96ac }, { 0x50886448, 0x25882b8f },
+    { 0x7d223aad, 0x82454afd }, { 0x06aff01a, 0xda24f649 },
+    { 0x77f1bd41, 0x4cedd09f }, { 0x77b3656c, 0x3fd37c8b },
+    { 0x9e18ba06, 0x6affe80e }, { 0x8062fb02, 0x92f54d83 },
+    { 0x6afc8b3b, 0x882801cb }, { 0xd83a5fa8, 0x0450d4a5 },
+    { 0x42cca3e1, 0x05fa60d0 }, { 0x895ff7a8, 0xa301d2b2 },
+    { 0x4a871289, 0xdac14195 }, { 0xc367ea56, 0xf5f74a61 },
+    { 0x8f286d2c, 0x5a3365f0 }, { 0x0df39bd0, 0x21fc3120 },
+    { 0x4e0a053f, 0x307a3297 }, { 0x00de342a, 0x1ab63315 },
+    { 0x22e1bd92, 0x9313e1ff }, { 0x94579141, 0xaf81c7f0 },
+    { 0x1b1c7cd0, 0x4dfb5235 }, { 0x7543b2c0, 0xd51d2e09 },
+    { 0x42c8ffda, 0x036993bc }, { 0xb033359e, 0x7686b82c },
+    { 0x8936ee55, 0x99db95c4 }, { 0x924facf9, 0x68deabcf },
+    { 0x0c4106f0, 0x9520a1ce }, { 0x2883551b, 0x6759640e },
+    { 0xb5bbac71, 0x33531623 }, { 0x401b570e, 0xdf9dabaf },
+    { 0x5145a4cd, 0x7234f5d3 }, { 0x09b4226b, 0xc04792c7 },
+    { 0x001d14cc, 0x9d33544a }, { 0xf08ff4b7, 0xab1ee2e1 },
+    { 0xc8833f94, 0xc82daffd }, { 0x1c7cd4ee, 0xf3497a1c },
+    { 0xf5c0d758, 0x4be295c8 }, { 0x72d40ef3, 0xe1b3f168 },
+    { 0xe9fd1ecb, 0x20573b4e }, { 0xb3d84c61, 0x48c7b8a9 },
+    { 0xca73b24c, 0xe6a35048 }, { 0x34a86de2, 0x1bcbf217 },
+    { 0x9c2157b4, 0x540734e5 }, { 0xb8eb251f, 0xf2b180ca },
+    { 0x052bd8fd, 0x9739ecd5 }, { 0x5e7486ad, 0x33ccb135 },
+    { 0x596d0b11, 0xbd06d5cd }, { 0x3070b6db, 0xe94bfb5f },
+    { 0x13456a08, 0xe183a856 }, { 0x043ecc12, 0xc6c5b16f },
+    { 0x872a2d91, 0x6bf2d216 }, { 0xd0c0b54e, 0x434b14d2 },
+    { 0x67396f4d, 0xe7f08236 }, { 0x73338638, 0x2c6e4c39 },
+    { 0x145a8c90, 0x6da748fa }, { 0x0988799d, 0x98af69cd },
+    { 0x39487528, 0xfb38a9df }, { 0xd90e1620, 0x7de520bd },
+    { 0x7d116448, 0x7cc081a6 }, { 0x93cf42df, 0x8411444e },
+    { 0xc2531244, 0x5cc05468 }, { 0x6fb33eae, 0x4639b06c },
+    { 0x3318ecd8, 0xb7b5b41a }, { 0x39428265, 0xbb012379 },
+    { 0x5fdb01d5, 0x7dbd89fc }, { 0x42ea13da, 0x7fe27ea4 },
+    { 0x0285b41a, 0x6983070b }, { 0xdcae68e4, 0x5eb90a64 },
+    { 0x10c69c53, 0x5f842066 }, { 0xe4259f4a, 0xc3d0ddf3 },
+    { 0x63ab4305, 0xf5457c24 }, { 0x33fee5ff, 0xc9f21314 },
+    { 0x84f80984, 0x682c71df }, { 0x7c194c3b, 0x368a979e },
+    { 0xa12fafb2, 0xcf51d8cb }, { 0xdb01b02d, 0x0af539b6 },
+    { 0x195f4c3c, 0xc4e19e05 }, { 0x27a0f801, 0xe41a3cdb },
+    { 0xe6331f47, 0x1ec04d4e }, { 0x9330c903, 0xa14d5721 },
+    { 0x3735ecff, 0x832d9d70 }, { 0x6f6e740a, 0x3061d803 },
+    { 0x3d63e260, 0x906538d2 }, { 0x26af3409, 0x228fd76e },
+    { 0xdecf304e, 0x014c9172 }, { 0x482c463f, 0x9240311f },
+    { 0xb21326b1, 0xe2190039 }, { 0xbe4b7c56, 0xd237ea2d },
+    { 0x92f19669, 0x9e7e2ad1 }, { 0xe5e313a5, 0x83764086 },
+    { 0x769fd6be, 0x13f6deef }, { 0xe32ce724, 0xbaed000a },
+    { 0x742b29b4, 0xf1dc93dc }, { 0xb02a3aaf, 0x4583405e },
+    { 0x106d3295, 0xa7190fab }, { 0x45c451ab, 0xf0ce24de },
+    { 0x66d89afe, 0xd71209bb }, { 0xee9d2844, 0x5ed28f6c },
+    { 0x14c18c66, 0xc13a3621 }, { 0xa4a5f587, 0x71e00c25 },
+    { 0xda0f4992, 0x30ef8075 }, { 0x7042663e, 0xa015027e },
+    { 0x31bcc07a, 0x54b1f435 }, { 0x8e99c270, 0x399713c9 },
+    { 0x8b3bb14f, 0x1b5c9227 }, { 0x9776082d, 0x6809e365 },
+    { 0xc749cd4c, 0xf3399834 }, { 0xdb623f06, 0xd2a17faa },
+    { 0x9dc94fe2, 0xb195a1e9 }, { 0x1aee5320, 0xcb4a1863 },
+    { 0x3fdc8e70, 0x06ab39bd }, { 0x7f86e8bd, 0x128ec1aa },
+    { 0x39be441c, 0xdb150a50 }, { 0xef478d8a, 0x2527803d },
+    { 0x385ea515, 0x2ed9bb76 }, { 0xbddf82c1, 0x45be6977 },
+    { 0x10ac41c5, 0x6b0fc0f9 }, { 0xffe82908, 0xcf1a1efd },
+    { 0xea2e49f4, 0x7d3141b9 }, { 0x86edab68, 0xbe3ff4b2 },
+    { 0x9da83078, 0x431dbb6a }, { 0xc067c908, 0xc472e49a },
+    { 0x7985c30c, 0xadf51024 }, { 0xc67ebd3e, 0x3826c4b0 },
+    { 0xbb210086, 0xbd96092e }, { 0x697a5ca8, 0x1c98805d },
+    { 0x6a02efb2, 0x0b76020c }, { 0xfbfdb34a, 0x4aadcfee },
+    { 0x01084396, 0xf52edd5f }, { 0xf9558944, 0x83ad3bdb },
+    { 0xa7dae6b5, 0x49c6eb95 }, { 0x5bed1fb7, 0x5b9ae386 },
+    { 0xa8617564, 0x3177e5a5 }, { 0x66e4be20, 0x0ffa65c9 },
+    { 0x1ab68688, 0x1c7173bd }, { 0x65072d36, 0x3a5ec80f },
+    { 0xff41cfed, 0xdbc59906 }, { 0xefb3cfa0, 0x20bd9699 },
+    { 0x5ec3074e, 0x31056940 }, { 0xda58fc44, 0x8c090cf3 },
+    { 0x95c5e3b6, 0x8c1a036e }, { 0xeccaa45c, 0xaa7cb18d },
+    { 0x034553d4, 0xc880e75e }, { 0x3453a050, 0x124e41b9 },
+    { 0x1a11c0cb, 0xed78b335 }, { 0xf8922c17, 0xc511b143 },
+    { 0x70e4a7bc, 0x2d2716e0 }, { 0xede8aade, 0x06635403 },
+    { 0xe8993128, 0x95f2e49c }, { 0xe086b7ae, 0x4dc156ee },
+    { 0xa0dc0d6b, 0x2c1d298d }, { 0x7907e70a, 0x7cde2f1b },
+    { 0x40a4ac2c, 0xe93c2003 }, { 0x6b31cf36, 0xc2acb32c },
+    { 0x09e6f5f0, 0xdd30a279 }, { 0xd6f07bc8, 0x709ff4c1 },
+    { 0xf672441d, 0x04ea8fba }, { 0x78491af3, 0x5adf5812 },
+    { 0x9f320337, 0x641066d2 }, { 0x09fe2701, 0xe58482df },
+    { 0xc31d68ab, 0x0a923c5e }, { 0x79145a1d, 0x20b54d5b },
+    { 0x72d7406b, 0x3c2b09c0 }, { 0xc9600912, 0x878cbb08 },
+    { 0x3cdd2e50, 0x914b9e0e }, { 0xc543c0cf, 0x557ab081 },
+    { 0xd31ee085, 0x688e78fa }, { 0x1606f25f, 0x2aaf9866 },
+    { 0xe54ff3eb, 0x14870d81 }, { 0x4cf8afd3, 0xcbae3012 },
+    { 0x8239c103, 0x1e73e08e }, { 0x32bb636f, 0x421c485e },
+    { 0x8ae82153, 0x23f7d930 }, { 0x8393d22d, 0x8a728aeb },
+    { 0x3cc2d04b, 0x4d07e1e1 }, { 0xa5c1364a, 0xa0b1289e },
+    { 0x0831cfc3, 0xc06fee77 }, { 0xe76d55d0, 0x64fb2771 },
+    { 0x44674a47, 0x99f385cc }, { 0x8f342c1a, 0x5caf24a7 },
+    { 0x507fbfa6, 0x7f181539 }, { 0x21df0d6f, 0xb36c005b },
+    { 0x29552a3a, 0x7b55bb2d }, { 0x490d98b7, 0x747c0b01 },
+    { 0xf3817dc1, 0xc5ae5e6c }, { 0x39e15c1e, 0x14f47c0c },
+    { 0x014e5b70, 0x0c7e9a3f }, { 0xea996778, 0xcf1a7e7c },
+    { 0x595969ae, 0xf119b9da }, { 0x38952357, 0xb4335906 },
+    { 0xace9f3d4, 0x81f1cdfb }, { 0xac0c1a80, 0x96ebb038 },
+    { 0x22a7b509, 0xa5c634b2 }, { 0x6665afe4, 0xb1e7d781 },
+    { 0x9f8337c7, 0x30f0c253 }, { 0xdbda7dd9, 0xb5b88ab4 },
+    { 0xc7daceaf, 0x9d6e7293 }, { 0xad24eb70, 0x1d3aa879 },
+    { 0x62e39670, 0x2be2a5de }, { 0x9c383cde, 0xec3039f1 },
+    { 0xc5acdb30, 0xcd7b7175 }, { 0x44aa20c9, 0xc93d6012 },
+    { 0x645f9f1d, 0xe8d58760 }, { 0x5c122faf, 0x4015a29f },
+    { 0xf39dfb1e, 0x6ab7e188 }, { 0x1b175711, 0xa5b7e287 },
+    { 0x3769ea68, 0x9e407b2e }, { 0xb559d681, 0xa7cc814b },
+    { 0x0a26298c, 0x44e31143 }, { 0xd217ede2, 0x56ee6293 },
+    { 0xb44b61a3, 0x1481f556 }, { 0x9a2786d8, 0x5664ffb4 },
+    { 0x21032da2, 0xab67cc7e }, { 0x647deac5, 0xaead2623 },
+    { 0xf8f0f4b7, 0x2157b057 }, { 0xcd958357, 0xd1102d25 },
+    { 0xcdd67aae, 0xec8ddf87 }, { 0x36af49b8, 0x6cb5f0fe },
+    { 0xb030c8b6, 0xf70bd432 }, { 0xb086b2df, 0x8afb9215 },
+    { 0x1b37d748, 0x1111890a }, { 0xcc7cc756, 0x15fde3f1 },
+    { 0xb5fa658f, 0xeaa54277 }, { 0x37ce7e9a, 0xeb6d7706 },
+    { 0x2150675b, 0x7922641e }, { 0xd30a2df3, 0x0becc975 },
+    { 0xfaff41b3, 0xf323a8d8 }, { 0xa3f74e2c, 0x5992bf66 },
+    { 0xad472305, 0xf704a5b1 }, { 0x405004cc, 0x9eb5ff3f },
+    { 0x585aaff1, 0xe8d40f70 }, { 0x12d69f18, 0x791e5ea7 },
+    { 0xb046ed9f, 0xeff8436e }, { 0x0fc6c9fd, 0x43d65a51 },
+    { 0xb7ddeb77, 0xa01dc2f0 }, { 0x30b68e43, 0x39a450f6 },
+    { 0x68211731, 0x03fb892c }, { 0xdace6420, 0xf35decc5 },
+    { 0xe8f7af8e, 0x9ab11f47 }, { 0x4cc01120, 0xed02923d },
+    { 0x7d9ba6dc, 0xc5b00238 }, { 0x4609a6a4, 0xa7d338e6 },
+    { 0x77da23ea, 0xf664ec6e }, { 0xe60c161b, 0x7c57866f },
+    { 0xcdfcc7b2, 0x4fa97df8 }, { 0xca29ece9, 0x04656c73 },
+    { 0xeefbbb84, 0x96b50216 }, { 0x5e7d7a57, 0x79d117bc },
+    { 0xf034c741, 0xf77b5ea9 }, { 0x0b4a14c5, 0x12808dc3 },
+    { 0x7b70291e, 0x07d9fef5 }, { 0x08c28bd3, 0x78bdf5cb },
+    { 0x4b3e2f72, 0xa811c6c2 }, { 0xea7abec8, 0xd88d0f79 },
+    { 0xbc47946a, 0xd7585e8d }, { 0xc7fbea67, 0x163d1a5e },
+    { 0x4ab33430, 0x477421d0 }, { 0x8a527863, 0xf7c87119 },
+    { 0x4c55b841, 0xd7fbd495 }, { 0xe91a1809, 0x691d6de1 },
+    { 0x945049fa, 0xa9f4e019 }, { 0x672ebcca, 0x8c945ac6 },
+    { 0x7be6dcc5, 0x91e5b1c2 }, { 0xa6022a14, 0x29227353 },
+    { 0x9385ec14, 0x3134b0ea }, { 0xeea8a610, 0x3144f17b },
+    { 0x552f601d, 0xe454aee4 }, { 0xd0b3331e, 0x4791bd8b },
+    { 0x601d4345, 0xf187c048 }, { 0xf3239a44, 0xecc417a4 },
+    { 0xf0af261e, 0xd1c3a8ba }, { 0xa4146ebc, 0x188cf8db },
+    { 0x4c41be3e, 0x1cd4c244 }, { 0xc01b7d31, 0x98542d39 },
+    { 0xaa41f839, 0x193e9a1c }, { 0x7897b218, 0xfafeb97e },
+    { 0x223e25a8, 0xb21e50d7 }, { 0x8f34490d, 0x9a694f37 },
+    { 0xca28ba3f, 0x36f30758 }, { 0x8c82f730, 0x23eae14f },
+    { 0xa60f5522, 0x289d3307 }, { 0x011c2bf0, 0x6cdaf101 },
+    { 0xb6c1fff7, 0x905b69ff }, { 0x5df662ff, 0xd15757e9 },
+    { 0x7c39572d, 0x258bdd60 }, { 0x4d982a73, 0xd66a7996 },
+    { 0xf8a62543, 0xe831372c }, { 0xc8cdbc29, 0x10282b8a },
+    { 0xdf8cf317, 0x7d0154ed }, { 0x60a11c4f, 0x55e66eaf },
+    { 0x0870546c, 0xc7ad14ab }, { 0xb719dbb2, 0xa3c2fb5d },
+    { 0x4bffbfcd, 0x154a5d6f }, { 0x03086555, 0x1b55984f },
+    { 0x7d206c9b, 0xf10719c8 }, { 0x2b44d17a, 0x96036a3b },
+    { 0x0ec5854c, 0xa2a223c4 }, { 0xdfc79017, 0x84812dd6 },
+    { 0x59a86bb2, 0xf4d0d3b8 }, { 0x1bc1dea4, 0x21049399 },
+    { 0xfbf9e259, 0x9ae50e02 }, { 0xb2d1835e, 0x8c51de59 },
+    { 0x6d6f02c6, 0xde610d60 }, { 0xa1ca567a, 0x6e4df4cb },
+    { 0xf45a3d4d, 0x7629bed1 }, { 0x0e28b6ca, 0x988f1b2a },
+    { 0xb3feee23, 0xf3b05f2a }, { 0xa7343c13, 0x3e9704f4 },
+    { 0x01f9ea47, 0xacc57f84 }, { 0x59d6f697, 0x406be58d },
+    { 0xb6722466, 0x90488c5b }, { 0xafb01d2a, 0x1d7ef552 },
+    { 0x77a1b944, 0x95968b74 }, { 0x391a00fe, 0xc4fadaa9 },
+    { 0x07b79e94, 0x4a864c1a }, { 0xa3224e23, 0x3ec0bd41 },
+    { 0x35544c48, 0x7def594c }, { 0x08d13b02, 0xa1e42b80 },
+    { 0x7fe72685, 0x4f531636 }, { 0x76432def, 0xbeb632ac },
+    { 0x4dc40957, 0x1c8d9c19 }, { 0x353c285a, 0x15fb333a },
+    { 0x857a66bb, 0x1427f819 }, { 0x65b10252, 0xf0b61a11 },
+    { 0x6226553c, 0x2e895cd4 }, { 0xe0bac29f, 0xaa027060 },
+    { 0x868266fa, 0xd637b3a0 }, { 0x6aed87eb, 0x763a2f0a },
+    { 0x03a84b29, 0x662c9e05 }, { 0xe8ecfe64, 0xc838bd37 },
+    { 0x51e18f86, 0xef94f7b4 }, { 0x4973066e, 0xcd0eaceb },
+    { 0xcb0f35e7, 0x2f42dad8 }, { 0x2a472590, 0xd3646334 },
+    { 0xe33219d4, 0xca91af98 }, { 0x6f6b95d3, 0x8d8a7534 },
+    { 0x7f9847d7, 0x5424871f }, { 0xaf7e10e4, 0xb1f5e928 },
+    { 0xfafe9c5b, 0xcbcb9c79 }, { 0xcc2c4e33, 0x9ff41edf },
+    { 0x9692b714, 0x906eeff2 }, { 0xc6ec7425, 0x9025c14b },
+    { 0xe09a86f6, 0x2357394c }, { 0xd68549a7, 0x75a866cc },
+    { 0x70bff722, 0x7985cbe0 }, { 0xf86a7116, 0x7badb0c6 },
+    { 0x3a1ead75, 0x4c70fbe4 }, { 0x5aa8b296, 0xbd4971c0 },
+    { 0xc133cd17, 0x7f24f892 }, { 0x06c1679a, 0x1d9579f9 },
+    { 0x519fb185, 0xb51b44b6 }, { 0x26a2bd87, 0xc2db79e9 },
+    { 0xd8801bab, 0xf46da2fa }, { 0x55ef0831, 0x6fade614 },
+    { 0x2e7be032, 0xb088b69e }, { 0x12265026, 0x4ce408eb },
+    { 0x616f27cd, 0x69c91331 }, { 0x2adfc532, 0xdc905f3a },
+    { 0x96435a53, 0xbd67e298 }, { 0xa79b6f4c, 0x00289100 },
+    { 0x06ff3606, 0x8d15b724 }, { 0x8f68d088, 0xc0915176 },
+    { 0xc4270b68, 0x64dffe07 }, { 0xfe17ce8d, 0x3e8632ab },
+    { 0x197a6a4a, 0x2c1122a3 }, { 0x9dbfaa00, 0xf69211aa },
+    { 0x9eef74b1, 0xa2614f70 }, { 0x460799f6, 0xa77119e7 },
+    { 0x3ef20c55, 0x54322a91 }, { 0xe773c4a1, 0xa88accee },
+    { 0x06138e7e, 0xa915593f }, { 0x45aa5dd6, 0x222e08bd },
+    { 0xe5903e7e, 0xee7830ec }, { 0x3cb292e3, 0x1c56c1e7 },
+    { 0xcb09382d, 0x6992ee91 }, { 0x1a4077a3, 0x4e914b8d },
+    { 0x82e11eb4, 0xf805a8a8 }, { 0xe2f7f483, 0xa6a6f494 },
+    { 0xe2770424, 0x5e7f28b3 }, { 0xea78b98e, 0x9f701be1 },
+    { 0x52d58079, 0x582096ce }, { 0xedf1b632, 0x65693266 },
+    { 0xbccf8f9d, 0xfaaf385a }, { 0x9c850a68, 0xd208b2a2 },
+    { 0x92aa4289, 0x01a9a156 }, { 0xae2b70bd, 0x32e0c9a0 },
+    { 0xcd4dfe9c, 0x89707ebe }, { 0x630bcfb3, 0x0a918406 },
+    { 0xa7f2c1bd, 0x4889bd39 }, { 0x38cdb878, 0xd1e0d6cd },
+    { 0x18daf6d2, 0xc3fd193a }, { 0xedfd0d42, 0x0ae03080 },
+    { 0x04bc9cca, 0xcb65819c }, { 0x2afa19e2, 0x2aa445ca },
+    { 0x6b95bcc2, 0x5f7cbfec }, { 0x24ab8079, 0x9b51cd24 },
+    { 0xbb216c4c, 0x456d7c47 }, { 0x19667e61, 0x2973a0c8 },
+    { 0x2e98858e, 0xfafb1ca2 }, { 0x2c7cc545, 0x25baaaf4 },
+    { 0x8ec6e0e2, 0x11b90f92 }, { 0x845d5d57, 0x069e6882 },
+    { 0xe81da828, 0xa750e792 }, { 0x90aedfda, 0x246c8d37 },
+    { 0xe817e56c, 0x3af2cd3e }, { 0xed27423e, 0x4a52c02b },
+    { 0x1b347788, 0xfb5b03d0 }, { 0x2ca2d649, 0xbfab897f },
+    { 0xb69fbacd, 0xc2c4fb31 }, { 0x6f1fa393, 0xd488e522 },
+    { 0xa5df1c44, 0x5a981b67 }, { 0x87808eee, 0x20ef1c36 },
+    { 0xb168edd1, 0x132c6b2a }, { 0x9cddb816, 0xefb5e822 },
+    { 0x4401b88b, 0xbe3030c8 }, { 0x384e0ffb, 0xeef705b5 },
+    { 0x2f0ede8e, 0x8362daa5 }, { 0x7e47a649, 0x279d2aa5 },
+    { 0xea0f7196, 0x4bd911f8 }, { 0xd212d942, 0x928ff9f0 },
+    { 0x4557d100, 0x8c404d28 }, { 0x8711ceec, 0xf2e7e792 },
+    { 0x54935cb3, 0x69a1378b }, { 0x9708e10f, 0xd6b75bef },
+    { 0x0993047d, 0xa023c3a2 }, { 0x86d33863, 0x1d431ec5 },
+    { 0xa1dd2a62, 0xd9ad80ae }, { 0x69cec1c4, 0x91e052dd },
+    { 0x3104e231, 0xf48f3b4d }, { 0xfdb4ba1b, 0x5f9e627d },
+    { 0x31efa261, 0x109d2181 }, { 0xfe751634, 0x5cf45e92 },
+    { 0x1c5b47e7, 0x0783e890 }, { 0x62644ba7, 0x660b3fdf },
+    { 0xb2dc9ba1, 0x3469d49c }, { 0x78f6cb7a, 0x11a49327 },
+    { 0xb5067f25, 0xf99b525f }, { 0x935d4fbb, 0x1adf48de },
+    { 0xf5b0b544, 0x4030911e }, { 0x6a41af12, 0x92cf67c3 },
+    { 0x8f9bdc11, 0xd80838b5 }, { 0x0f10d5a5, 0xfd263364 },
+    { 0xf37b1438, 0x4de8519f }, { 0xe71dadfb, 0xe5cc17ad },
+    { 0x1713e3d2, 0xe7bd8a03 }, { 0x46d74eaf, 0x9c66ce19 },
+    { 0x1593cdd1, 0x572097e0 }, { 0xb14313be, 0x979bcaa1 },
+    { 0xcf150fed, 0xcdecda03 }, { 0x83420ff5, 0xfdca6dfa },
+    { 0x7ff77756, 0x079ff3c6 }, { 0x6a7e73f6, 0x042cf482 },
+    { 0x78a0561f, 0x60e56c45 }, { 0x4f188312, 0xd7c9ebf4 },
+    { 0xea434ddb, 0x1b828df0 }, { 0xd17701d8, 0x04c5bfce },
+    { 0x92159c73, 0xa6c32fca }, { 0xf3cd7ad4, 0x11e204dc },
+    { 0x11cbef8c, 0x0bca3ff1 }, { 0x91a8396a, 0x7a4bbc1f },
+    { 0x147ad607, 0xbd68b5d2 }, { 0xf90af736, 0x7f1216b9 },
+    { 0x197d1ffb, 0x6c19283d }, { 0x3e3be572, 0x6dafef76 },
+    { 0xe5290cdd, 0x35c372d8 }, { 0x7fe7859c, 0xce62f06e },
+    { 0x059e9c5b, 0xc969f364 }, { 0x0178b57c, 0xe5080dfa },
+    { 0x1f27414c, 0xe13c9500 }, { 0x0aa36fcd, 0x96a3172a },
+    { 0xcc689324, 0xb0322904 }, { 0x8f97ab4c, 0x22b87bc7 },
+    { 0xbef3abb1, 0x9e5ce6d9 }, { 0x639333de, 0x56ff8ac5 },
+    { 0x89b43864, 0xb90d7de2 }, { 0x136c54b2, 0xe3e6d55e },
+    { 0xd355d49c, 0x438d0d1b }, { 0x5efd97fd, 0xaec8714f },
+    { 0xa883cd3c, 0x3dbc48b4 }, { 0xfc88aecd, 0x45a4f029 },
+    { 0x27dcfacc, 0x14ff62c8 }, { 0xb9e70048, 0xc2100eb8 },
+    { 0x7e2e96c0, 0xf5c979f8 }, { 0x185160b1, 0x0209cabf },
+    { 0xa0cd5d8a, 0xd36ba6b3 }, { 0x7ebace68, 0x34ceb3cb },
+    { 0x86aeb163, 0xde12a648 }, { 0x9c23f854, 0x2fa8af2b },
+    { 0x00267b78, 0x7464f875 }, { 0x2824ca55, 0xed056813 },
+    { 0x72d37427, 0xff109ce3 }, { 0x9675e50f, 0xdd159989 },
+    { 0x0f758fb0, 0xa5dc1ed1 }, { 0x2f2b388f, 0x67d52146 },
+    { 0xdcc5b586, 0xe073e85f }, { 0xbfd72c06, 0x38cbdc7a },
+    { 0x72c8f084, 0x12c94d77 }, { 0xbc5bb9e8, 0xb60c0748 },
+    { 0xd4c3e591, 0xc9e77a62 }, { 0xa512468e, 0x45a1d67b },
+    { 0x641d5ace, 0x4b0e96e1 }, { 0x071402e2, 0xff4eccdf },
+    { 0x79d51f24, 0xe68d4593 }, { 0x3670d0b3, 0xbcb7f680 },
+    { 0x35e4fa1e, 0x1d4f517f }, { 0x19657820, 0x8e39c16b },
+    { 0x2c230e1b, 0x8c59a27e }, { 0x7e9be58d, 0x5e3e70fe },
+    { 0xb5410a10, 0x4142e64b }, { 0x798f24e7, 0x65bd6152 },
+    { 0xa60cc9fb, 0xf9a67ef6 }, { 0x83f16afc, 0x1a3f4c3a },
+    { 0x3576957e, 0x5a0e1554 }, { 0xdec27ea5, 0x8c72b112 },
+    { 0x45e54893, 0x3c58fab1 }, { 0x57e78aae, 0xc9189886 },
+    { 0xfb8fe4a0, 0xbb55379e }, { 0xa585571f, 0x2cca0787 },
+    { 0xd789204c, 0x16644346 }, { 0x0195bf31, 0x74cbf770 },
+    { 0xf65899ce, 0x2db2ba9e }, { 0xfca27e0b, 0x46d4ae9a },
+    { 0xd57f5183, 0xb4ecab47 }, { 0x3537b3bc, 0xd3918875 },
+    { 0x7829a5a4, 0x3b8d6108 }, { 0xf9eaf906, 0x29bda566 },
+    { 0xebe88813, 0xfd0e39fa }, { 0xb09d9943, 0x37c111a8 },
+    { 0x44814d85, 0x9d158d53 }, { 0x2f0836e3, 0xc6884b74 },
+    { 0x54d5e6cf, 0x865f1242 }, { 0x66a496e1, 0x884928eb },
+    { 0x5d85471e, 0xeaf847df }, { 0x85e07fde, 0xea6a10c2 },
+    { 0xe95c5f75, 0xce7840de }, { 0x18b8be28, 0x151a60f5 },
+    { 0x668278b0, 0x7768a510 }, { 0x3c3ff662, 0x4e7ac77f },
+    { 0xdb2b30ab, 0x24cec3d1 }, { 0xb12df64a, 0x2e9a8e12 },
+    { 0x845820c1, 0x8e943f35 }, { 0x2b2cc15c, 0x81457783 },
+    { 0x346f9040, 0xcd287330 }, { 0x117aaae0, 0x06cc6651 },
+    { 0x87202180, 0xbb6b2d49 }, { 0xd96949b6, 0x2262a2f1 },
+    { 0xc48b9235, 0x608c728d }, { 0x5a8d25ec, 0xa9ac8e8a },
+    { 0x4584d2b3, 0xf7b5b536 }, { 0x157e1a9c, 0x10c9cc2d },
+    { 0x80e8da35, 0xeeef20a5 }, { 0xc3579abb, 0x6987fc34 },
+    { 0x71d20ddc, 0x38a13555 }, { 0xa03c127d, 0x19311a10 },
+    { 0x73958af1, 0xc57b9498 }, { 0x2e68baab, 0x3c4584e9 },
+    { 0x74b1afab, 0x03b44ea9 }, { 0x505c81c8, 0x5c0d75af },
+    { 0xcdb16ec2, 0x2e26a5da }, { 0x220b0b6d, 0x463cc3bd },
+    { 0x0e3534d4, 0x13b2ee9c }, { 0x1977bfd4, 0xb87bc694 },
+    { 0x76031d61, 0x96d150c4 }, { 0x1003435e, 0x5ca39469 },
+    { 0x0d603f68, 0x08997686 }, { 0xb6e5dd23, 0x6ef21942 },
+    { 0x914e708f, 0xf5fe3470 }, { 0x7c63bc9b, 0x903d119a },
+    { 0x70019d2e, 0x69a02ae0 }, { 0x62caf11f, 0x98cde150 },
+    { 0x91ef2ac7, 0x613826af }, { 0x85c76218, 0x6b6112f1 },
+    { 0x75619087, 0xee141ccd }, { 0x84815059, 0x3ca5510b },
+    { 0xe1618606, 0x704804a8 }, { 0xc1dca73e, 0x2bc46c51 },
+    { 0x0e91794c, 0x29291c63 }, { 0x216e8cb9, 0x7a952c1e },
+    { 0x46002246, 0x386f229b }, { 0x522bf932, 0xfd16ce18 },
+    { 0xd5344750, 0xe97b0c40 }, { 0xb7588d72, 0xcf9f7c33 },
+    { 0x5582aed7, 0xbe33bffe }, { 0xc202ba96, 0x51280f03 },
+    { 0x669c26d7, 0xe33439c8 }, { 0x84e88f91, 0xdacffc96 },
+    { 0x3b5f4833, 0x28007856 }, { 0xb9cc1737, 0x40038477 },
+    { 0xfaafc0cd, 0xd8629b77 }, { 0xc1c1e79d, 0x86884d42 },
+    { 0x9231725a, 0xb71e4aa1 }, { 0xdf91177f, 0xc186fdbf },
+    { 0x77f82161, 0xea3d128b }, { 0x259ba2c0, 0x454b95ec },
+    { 0xf1aa6b00, 0x74afa4b7 }, { 0x8cfc6029, 0xdb23bc31 },
+    { 0x8d8685d6, 0xfbe9a37e }, { 0x6761cc1e, 0xaeb8c400 },
+    { 0x8a7f6586, 0xa22bb67a }, { 0x5b64ef64, 0xc9c4019b },
+    { 0x7661ec06, 0xfb124f1a }, { 0x4cda7b68, 0xdb2163b4 },
+    { 0x812890d8, 0xab23eb69 }, { 0xa0693ebe, 0xc5719069 },
+    { 0x965fdf31, 0x33f2d4c3 }, { 0x9a1b8a8a, 0xde4f9c79 },
+    { 0x729d7802, 0x55a46a47 }, { 0xb9d8b2f2, 0x1120f60d },
+    { 0x16404a15, 0xb1ffb26d }, { 0x816676f2, 0x899bd898 },
+    { 0xd936d478, 0xd196cbda }, { 0xa3cca53d, 0x055c95ca },
+    { 0x89f76d9b, 0xfcf62705 }, { 0x9c5e3c7d, 0xb4a831dc },
+    { 0x6cae3ec3, 0x57de736b }, { 0x95843ad8, 0x8d913332 },
+    { 0x587fbb3c, 0xbc98f91c }, { 0x1cea9afc, 0x65952a24 },
+    { 0xa1e25d36, 0xdf489cc6 }, { 0x39a85b9b, 0x5574ec03 },
+    { 0x950b36a1, 0xe823c68e }, { 0x32852cf0, 0x2b623b70 },
+    { 0x5de2d581, 0xc516fc51 }, { 0x10d02a26, 0xfd71ea91 },
+    { 0x5ef1dd80, 0xc2acb332 }, { 0x1f00edd8, 0x05571408 },
+    { 0x7ed81a2a, 0x9a89c9b9 }, { 0x62181ff5, 0x14833ab6 },
+    { 0xd6c059f8, 0xddb245bd }, { 0xb15792d0, 0x5792fdd2 },
+    { 0xe7cfba1e, 0x175cdee5 }, { 0x5b72041a, 0x4724f22a },
+    { 0x9ccfff50, 0xa709aad9 }, { 0x47816fab, 0x7166ef4b },
+    { 0xc19f8ac7, 0x8e3b3939 }, { 0x839f9650, 0x4d37c2ec },
+    { 0x5ca96adf, 0x1e626d8b }, { 0x7887c5fe, 0xb9bc6ca2 },
+    { 0xf5acc0b0, 0x37adc006 }, { 0x26f79f85, 0x294d6f39 },
+    { 0x1766660b, 0x77b4ddce }, { 0x7ec92805, 0xb19b4d20 },
+    { 0xb6ff90e4, 0xbc18409c }, { 0xdbe7cdce, 0x630f7936 },
+    { 0xba68b5bc, 0x727c2d57 }, { 0x4111787a, 0x17854eb9 },
+    { 0x2b6493ce, 0xb078ad85 }, { 0x56a80f6c, 0x2c04f786 },
+    { 0xa3a1b9da, 0x51132a1f }, { 0x83ae0460, 0x159997f0 },
+    { 0xa42b55d2, 0xe2a8346e }, { 0x0562b189, 0xaf7a4545 },
+    { 0xa1b30641, 0xb6d24677 }, { 0xbe460f7b, 0xd7ec7816 },
+    { 0x9ef5dc95, 0x269a0d95 }, { 0x73861038, 0x5ff02ce8 },
+    { 0x27994130, 0x32ae0b08 }, { 0xb1cfc95f, 0x47a1e236 },
+    { 0x39b17e4e, 0xb81676be }, { 0x55680d0d, 0xe699cbe4 },
+    { 0x7275a8f5, 0xfa307a32 }, { 0xd0de7411, 0x3e078d8f },
+    { 0xf2e2fdac, 0xcbf9bb38 }, { 0x6511fbe1, 0xd109934f },
+    { 0x4fac4afb, 0x7506c1d5 }, { 0x877d6fbf, 0xa9640441 },
+    { 0x0bc5ef78, 0x41224258 }, { 0x84000b07, 0x3518e5bb },
+    { 0x9f51dc6f, 0xebfcd878 }, { 0x96869187, 0xd6754453 },
+    { 0x2c0d9ad9, 0xd961af92 }, { 0xa59ea724, 0xdb82970e },
+    { 0x60fe101b, 0x8b92376f }, { 0xde539c97, 0x028b10b8 },
+    { 0x979c31ff, 0x670a2516 }, { 0x4083afc2, 0xebee78af },
+    { 0x4f09bf55, 0x3fcf0851 }, { 0xb2753c46, 0x97974d93 },
+    { 0xe08563c7, 0x22c79b62 }, { 0xf880e0bd, 0xc30e9ff4 },
+    { 0x7250ae23, 0x4c277e28 }, { 0xb3de8938, 0x36e13fe0 },
+    { 0x84bf433e, 0xe344b33a }, { 0x59681800, 0x5e83ed04 },
+    { 0xe720291a, 0x47c69fe6 }, { 0x408a45ef, 0xf31cc65e },
+    { 0x44c00198, 0x9376bd61 }, { 0x98f3833c, 0x40f55645 },
+    { 0x2d3e0fff, 0x81ff6cb6 }, { 0x81cef006, 0xaa21aaee },
+    { 0x564d528a, 0x0e2c28ec }, { 0xe7c37801, 0x0ca9728c },
+    { 0xe1b3e71b, 0xa8be78c4 }, { 0x339e4bc9, 0x952b5fbb },
+    { 0x76345452, 0x4cc6ae6f }, { 0x167933f0, 0x986b0095 },
+    { 0x213dc032, 0x356f5b74 }, { 0x043d8587, 0xdf6b3656 },
+    { 0x4c2051c5, 0xb5311143 }, { 0x19e59221, 0x63311e9a },
+    { 0xf509d7cf, 0x2c1fb303 }, { 0xb0f04099, 0xa64dad84 },
+    { 0xd926fc2a, 0xab77dd4c }, { 0x3d3ff064, 0x2241ff45 },
+    { 0xcd057878, 0x5e5a5cff }, { 0xc8f3edcf, 0x42090ff3 },
+    { 0x366e3d85, 0xd0cd8d19 }, { 0xb33e0680, 0x6133ff1a },
+    { 0x508383c7, 0x5d79ee2f }, { 0xc7e0181b, 0x01e4bd63 },
+    { 0x3d10682a, 0xc7663a0b }, { 0x99783f1d, 0x94e37711 },
+    { 0x0dc5a2ae, 0x68df87c8 }, { 0xd5cd88d3, 0xeb8c1204 },
+    { 0xefc11828, 0x54378301 }, { 0xa8e1dc41, 0xc87d54b2 },
+    { 0x6e8a0b88, 0x0383c41b }, { 0x342d9980, 0xcd661243 },
+    { 0x3c6827b8, 0x98bde922 }, { 0x9f93dec4, 0xdf4cdc24 },
+    { 0x0627125e, 0xb02b5ffa }, { 0x130a060a, 0xac78dfae },
+    { 0x643af1b5, 0xa9a05018 }, { 0x517d41c7, 0x11c07a2d },
+    { 0x9c5e5abb, 0xf81bfb69 }, { 0x8f1a0445, 0x1e5e228d },
+    { 0x899b4a05, 0xbe5b336a }, { 0xbde79076, 0xf0a8e91e },
+    { 0x27beb1b2, 0x90e14682 }, { 0xe5559f87, 0xa6ed0ae9 },
+    { 0x09b0619d, 0xb1447d2e }, { 0x60a57c99, 0x98b40e87 },
+    { 0xfa4a3959, 0xb4974043 }, { 0xdf309741, 0x04b4e7e5 },
+    { 0x51aa93ee, 0x8d81a382 }, { 0xb77a7259, 0xa72675ba },
+    { 0x513d3d07, 0x5f18ab75 }, { 0x211284a6, 0xe07dda8f },
+    { 0xb3c5ae36, 0x0c7bc157 }, { 0xfc08929e, 0x118b8f3a },
+    { 0xdb033a12, 0x9401740f }, { 0xe5e831ab, 0xc0f4533b },
+    { 0x13d20d80, 0x5aabaedb }, { 0xeae2de4f, 0x90d0f03a },
+    { 0xee57faff, 0x4accec53 }, { 0xc3f63700, 0xe5781d98 },
+    { 0x250b2afa, 0x75216588 }, { 0xc69f8347, 0x7d4ae4dd },
+    { 0x14f0fc7f, 0x4db04080 }, { 0xee0d7998, 0x5effa412 },
+    { 0x36e857a0, 0x235c383e }, { 0xb94c5d13, 0xc78a7b4a },
+    { 0xf33f8e29, 0x7a129dab }, { 0x195675ee, 0x7832bebc },
+    { 0xed108ec7, 0x074d0cc6 }, { 0x20e7e335, 0xe0125547 },
+    { 0x63f788da, 0x12e37789 }, { 0x051a827d, 0xc460c93b },
+    { 0x2eabfbdd, 0x5af84d2c }, { 0xeb58d5a1, 0xb2468ea8 },
+    { 0x3e256f61, 0x6464694f }, { 0x4da2f9e8, 0x4a87911b },
+    { 0xadb116a4, 0x0986f9db }, { 0xa00d36b9, 0x6f1889a3 },
+    { 0x29e2d4f9, 0xc489f2a5 }, { 0x65f62ee8, 0xf7a7b29e },
+    { 0xeba95955, 0x00915e97 }, { 0x54fca797, 0x8bb5a021 },
+    { 0xfa9b35c9, 0xa40e70db }, { 0x27831b1e, 0xf26e0b84 },
+    { 0x3f7d3a86, 0x9b0bd494 }, { 0x4882cf4c, 0x7f3fec26 },
+    { 0x2a296c50, 0xa491b6d7 }, { 0x41a2aef2, 0x6e6a14fd },
+    { 0xc260acaa, 0xbcc4909c }, { 0xb622b8b7, 0x7e3f799d },
+    { 0x6c9f89ff, 0x5e9b35bc }, { 0x8d10e04f, 0x86ce7956 },
+    { 0xb30793de, 0x945efabf }, { 0x767cbbec, 0x7e09f556 },
+    { 0x7f1103c6, 0x5cc901e1 }, { 0xd0857da7, 0x9f77ab22 },
+    { 0xc824cca4, 0xeb1b01b1 }, { 0x2aa7a4c0, 0xc10e053d },
+    { 0x12562218, 0xe71572d4 }, { 0xdf97a9b6, 0x6ce54123 },
+    { 0x44513f4e, 0x004dc44e }, { 0xb698d5d2, 0x1a33fadf },
+    { 0x1f577d42, 0x0f003722 }, { 0x4364b790, 0x2ba8190b },
+    { 0x9fc698e8, 0xc0ca9a16 }, { 0x46e7e166, 0x580d606c },
+    { 0x6bfdee01, 0x985d75ae }, { 0x41570714, 0xebfa096e },
+    { 0x321c05c1, 0x070648d3 }, { 0x6603d3ef, 0x919596bf },
+    { 0x9297cb74, 0xb93b245f }, { 0x86f32855, 0xf1523d13 },
+    { 0x2f6051d4, 0xa69c7fd2 }, { 0xb7c6c675, 0x5574f693 },
+    { 0x907389b9, 0xcc46825b }, { 0x9b924607, 0x750fb3ad },
+    { 0x403bb7f8, 0x374e5e79 }, { 0xfda3afc5, 0x7d7fff0f },
+    { 0x582ec62f, 0x0ce7fa99 }, { 0x874a9152, 0x18ba84e5 },
+    { 0x9226b801, 0xb3665dc6 }, { 0xafb03aed, 0x7639a16c },
+    { 0x29a248fa, 0xdd41692e }, { 0x5c7b7c0c, 0xb8305180 },
+    { 0x2abb2d9d, 0x65f02f69 }, { 0xd8e80ba0, 0xf41cf8d2 },
+    { 0x0dbed9a1, 0x6df6edb6 }, { 0xf5293363, 0x58888f15 },
+    { 0xf1c2f8d7, 0x9e4cc47e }, { 0xbc67e948, 0x29f06a3b },
+    { 0xba48e1ae, 0xdb9a01b3 }, { 0x3a992ac0, 0x19fd8203 },
+    { 0xa8a89004, 0xd70f5a14 }, { 0xb7d17a33, 0xc56f8cfb },
+    { 0xf2d96a04, 0x328bd511 }, { 0x32ba7946, 0x77099522 },
+    { 0x96dd09d6, 0xdf8d9fc9 }, { 0x2554713d, 0x72df37c6 },
+    { 0xc16156d5, 0x97dc61aa }, { 0x4b40e39b, 0x6f4c9ae0 },
+    { 0x8ff35f39, 0x4f588d95 }, { 0x709e2e7a, 0x47c4d776 },
+    { 0xfb684d83, 0x2e1f0628 }, { 0xae794ff7, 0x5c07faae },
+    { 0x7392fd4b, 0x6705f593 }, { 0x9fa72ddc, 0xee24b37b },
+    { 0xec251647, 0x12fe89d6 }, { 0x2414fa19, 0x95c392d9 },
+    { 0x2582f412, 0xb1058c6a }, { 0xf55426ca, 0xfce04038 },
+    { 0x5550d1b9, 0xa5cd0d3c }, { 0x50764c96, 0x90095fae },
+    { 0xd47abd65, 0xdf3badf3 }, { 0xd15545d0, 0x0a579e1a },
+    { 0x07004850, 0x96c3c7f1 }, { 0xa789a5a6, 0x89c24caa },
+    { 0xf04af344, 0x9521f470 }, { 0xddb543b5, 0xcd62ba74 },
+    { 0x2d5987be, 0x5b9b4468 }, { 0xc719dd8b, 0x28778632 },
+    { 0xd7bc4e31, 0x99505a6a }, { 0x3c910e6d, 0xe88fa58c },
+    { 0x42d445ca, 0xddb5c8f1 }, { 0x98c0f751, 0x3d92cba4 },
+    { 0x90b0b4c4, 0x8fe037f3 }, { 0xcb74f4c7, 0x08175e4b },
+    { 0x0a4f194a, 0x05bff672 }, { 0x58360eb2, 0x93afda1c },
+    { 0xc60e73cd, 0xcc0ae446 }, { 0x439a132c, 0x9ab9df68 },
+    { 0xd35dd231, 0x85a99017 }, { 0xe56f0a3c, 0x9e8729a3 },
+    { 0x18c987db, 0xa18dc548 }, { 0x85b3f2be, 0x9f0fcdb5 },
+    { 0x729a9b69, 0xdb374d58 }, { 0xbc71a167, 0x3caeed1f },
+    { 0x583db02c, 0x93bb2165 }, { 0x2758db50, 0xd095e8e2 },
+    { 0x1b740a2e, 0x4e4fdfbf }, { 0x0fe6f863, 0xe0c7ded5 },
+    { 0x92984780, 0x53166651 }, { 0x4c900fbf, 0x85990f79 },
+    { 0xee4a8f3b, 0xfdf629df }, { 0xa8fc6854, 0x3c76aa48 },
+    { 0xd58dfd3a, 0x39419ad1 }, { 0x7f26fcb4, 0xc029656c },
+    { 0xeff91631, 0x3b58d162 }, { 0x4b067a81, 0xe166191d },
+    { 0x71bf6129, 0x14e9abe0 }, { 0xab27b94e, 0xc106de58 },
+    { 0x5e7b42d4, 0x5fc010cb }, { 0xbfe3ba99, 0x14ed43b1 },
+    { 0x3a327037, 0x36b5c7f7 }, { 0x0b9e661a, 0xecbeca65 },
+    { 0x9d372d41, 0x6c6c7b20 }, { 0x3452769b, 0x75b3dd1a },
+    { 0x2df87fc4, 0x56884b23 }, { 0xe58bbec0, 0x91ce510a },
+    { 0xc08887c5, 0x69a1b264 }, { 0x7933c33f, 0xfdae2c14 },
+    { 0x467ee965, 0x6fe4bfd0 }, { 0x396518fb, 0xed4405cd },
+    { 0xc9c39b2a, 0x0176f170 }, { 0x8478a613, 0x268499f3 },
+    { 0x2ec91833, 0x3d1f0ae2 }, { 0x677cd1f9, 0x883f42fd },
+    { 0x37c06580, 0xbdb2a1f5 }, { 0x0b9689e8, 0x4ea661ce },
+    { 0x1e0d4244, 0x64524174 }, { 0x587a35aa, 0x3bbadb55 },
+    { 0x22cc957b, 0x8ec6459e }, { 0xd7499974, 0x6c8790c2 },
+    { 0xe25262f2, 0xd15fd4a0 }, { 0xd158e9df, 0x8a120dda },
+    { 0xe603fb1d, 0x4904fce5 }, { 0x51f45184, 0xc54ca1ca },
+    { 0x01dc2473, 0x1c4050b8 }, { 0xab04197e, 0xac2cb851 },
+    { 0xcd8c8889, 0xc7101552 }, { 0x2cd93766, 0x94567be5 },
+    { 0xcb1331ed, 0x5448da89 }, { 0x20acb50d, 0x9ecbae6d },
+    { 0x83e75adb, 0x48e0ec63 }, { 0x8aa16463, 0xe067d1a3 },
+    { 0x9cc46679, 0x1eb03475 }, { 0xd07cf370, 0xebb38320 },
+    { 0x8c4667b5, 0xdbd942ed }, { 0x8c7be27a, 0x54747715 },
+    { 0x2a85d981, 0x1f8cbb52 }, { 0xf5fd78be, 0x56a29d2e },
+    { 0xc0ca8f30, 0xcac89e35 }, { 0x79f2d226, 0x4aa32961 },
+    { 0x95f777a4, 0x597bcf8c }, { 0xffd54673, 0x455afb1b },
+    { 0x321a053b, 0x3835d27b }, { 0x57936270, 0x65ed5c02 },
+    { 0x1c954ad7, 0x8bb57135 }, { 0x4d940aa9, 0x790b7d01 },
+    { 0xf829f3a1, 0xe58cf973 }, { 0xca89930f, 0xe62098d0 },
+    { 0xc54e84cf, 0x35280e01 }, { 0x1477c1ef, 0x7bb7da30 },
+    { 0x060228ad, 0xf8d4f2f4 }, { 0xe83ddb47, 0x46dd63a0 },
+    { 0x3c588d30, 0x89be07ec }, { 0x23a9f916, 0xe123a873 },
+    { 0x09c593e3, 0x9412038b }, { 0x61853cec, 0xed83304d },
+    { 0x724ec989, 0x9680717b }, { 0x947841ba, 0x31c261b7 },
+    { 0x79380285, 0x06cd1c47 }, { 0xd36c1170, 0xdd3d75f6 },
+    { 0x383d6c3b, 0xe709853d }, { 0x5170dfa9, 0x23358e5b },
+    { 0x2a068002, 0x70262f3d }, { 0x0c319c8a, 0x8f3575b9 },
+    { 0x46d4e2e1, 0x284f4202 }, { 0x134ac99e, 0x0736bc9d },
+    { 0xe6a00c2b, 0x2e92702e }, { 0x75b355cd, 0x721eed07 },
+    { 0xeaee46a2, 0x6cdec3a8 }, { 0x0ba95cf2, 0x40b49f00 },
+    { 0x742b6169, 0x0fce583b }, { 0x695885d5, 0x82e169eb },
+    { 0xd61b9bf0, 0xe033076c }, { 0x63331d3d, 0x3beff227 },
+    { 0x8193ebca, 0x391bbe0d }, { 0x0a0fe4cf, 0xa2ea426d },
+    { 0xdad63c3c, 0x7c06c6fe }, { 0xb8b9570c, 0xf67bf8b6 },
+    { 0x885f12cf, 0x42d1a2c6 }, { 0x6ec22fdd, 0x01f79e2f },
+    { 0xa866105f, 0x2460b591 }, { 0x3caf724f, 0x9d0117f7 },
+    { 0x561904de, 0xf76b2423 }, { 0x8b09977b, 0x93607a15 },
+    { 0xf1425f32, 0x49b6303c }, { 0x17b4b1e3, 0x1498256b },
+    { 0x89265da8, 0x412b44fa }, { 0x6257c6e6, 0x0d1eb988 },
+    { 0xaeb8b287, 0xc10f1eac }, { 0xbc080f62, 0x8a1eb722 },
+    { 0x82666f53, 0xa59e258c }, { 0x21799cad, 0xbc2472a7 },
+    { 0xb1d40667, 0x99f9c095 }, { 0x9527cfb6, 0xaf232152 },
+    { 0x56e323af, 0x5a8c1b9f }, { 0x4f8aac69, 0xf8c2b076 },
+    { 0x144c9fbe, 0x4939316c }, { 0x676fb0b3, 0xbd1bef11 },
+    { 0xd57b1db8, 0x12c32de7 }, { 0x215f7669, 0xae9104c0 },
+    { 0xd4634f52, 0x863a5fd4 }, { 0xc76681b5, 0xe59322a4 },
+    { 0xd4a66b4c, 0x8ca1cacc }, { 0xa7b20fa7, 0xaf8ecf1c },
+    { 0x27484c20, 0x994fac28 }, { 0x4f9d5f0b, 0xc47bb17b },
+    { 0x83619870, 0x470950d7 }, { 0xf19d9025, 0x03f45a8b },
+    { 0xd62c7b5b, 0xebabe1db }, { 0x7a3b6896, 0xc41cd5c9 },
+    { 0x71b6cc2e, 0xee6a2f25 }, { 0xcbaa400d, 0xd9c8fe28 },
+    { 0x259e7c28, 0x4268c451 }, { 0xbfd480fc, 0x82fc9992 },
+    { 0x04a7a798, 0x5be1772a }, { 0x7cc668ac, 0xa10ea0e3 },
+    { 0x6b611af4, 0x59943cf6 }, { 0x385e0451, 0x42d7cb2c },
+    { 0x92c686d0, 0x620db261 }, { 0x4eb7c2ce, 0xf97e6520 },
+    { 0xed7defe1, 0xcab80353 }, { 0xb4171925, 0x8d75a8c1 },
+    { 0x9d556778, 0xdb3a4a6f }, { 0xc4f629da, 0x640d2b56 },
+    { 0x88398002, 0x94bdde99 }, { 0x3dd44a9d, 0x5b06c9bf },
+    { 0xf8960c02, 0x4a58433e }, { 0x6aa7790c, 0x9d4eabb2 },
+    { 0x24e54c0f, 0xc4ea96b7 }, { 0x40acd7c8, 0xb59bac79 },
+    { 0x5d428559, 0xe7e74180 }, { 0x31eeb880, 0x2b6e68e7 },
+    { 0x6d53a1aa, 0x3ca10da7 }, { 0x8e0d2266, 0x249eed81 },
+    { 0x839cb02e, 0x040fe547 }, { 0xfa4438d9, 0xa33b10a1 },
+    { 0x81ac956c, 0x87c2778d }, { 0x9b1683b1, 0x459cf124 },
+    { 0x3c1579dc, 0xb17c141d }, { 0x0e8ce2dc, 0x152169b6 },
+    { 0xca8b8c54, 0x0374511c }, { 0x93f2d698, 0xc650238d },
+    { 0x195edf7e, 0xac847ee6 }, { 0xb8b2b7bd, 0x4aa1abe9 },
+    { 0x997d3d93, 0x05d05c51 }, { 0x7a6379c2, 0x85a13827 },
+    { 0xce4eec99, 0x2e9ee92d }, { 0xbda4cc86, 0xfc2c6049 },
+    { 0x8ddeefc3, 0xe20c5916 }, { 0x98baee96, 0x64865765 },
+    { 0x1393966d, 0x0662f746 }, { 0xff2c726d, 0x102f6a89 },
+    { 0xe5116685, 0xc66ebf3d }, { 0x7b6aca19, 0x72200ccc },
+    { 0x9c410d64, 0xb30baa56 }, { 0x31cc49a8, 0xde27e4c5 },
+    { 0x681184b2, 0x17377ceb }, { 0x71b8e3fe, 0x6d5f185e },
+    { 0x75aa2ef6, 0x911708c9 }, { 0x18d7f344, 0x2e759e6a },
+    { 0x84787bda, 0x86e568c0 }, { 0x347e1de3, 0x8a05ee9f },
+    { 0xbcd6d205, 0x6d33d27c }, { 0xa44ee3e8, 0xf78b5a1b },
+    { 0x525ccc9d, 0xa083b87d }, { 0x4ffd62d5, 0x10d8153f },
+    { 0xb9bd84a7, 0x2326b7a6 }, { 0x3429b5cc, 0x5fa94b74 },
+    { 0x1467509f, 0xad18e2cf }, { 0x2bfdc5f2, 0xf122b152 },
+    { 0x8fe6fae7, 0x4029bc80 }, { 0x24e9d821, 0xd871362f },
+    { 0x3edb5efc, 0xfe241384 }, { 0x1c43ec61, 0xbce0ee45 },
+    { 0xe875431d, 0x1d9f1985 }, { 0x86539444, 0x717c0077 },
+    { 0x9a055323, 0x29c3058a }, { 0x04cbb0a2, 0xf3d926a7 },
+    { 0x0c44ced0, 0x4b3acf41 }, { 0x6f0b5f91, 0xe56cb880 },
+    { 0x02552430, 0x17ed5bdf }, { 0xec8b49ef, 0x3b11147a },
+    { 0xf5dbb010, 0x8bdca700 }, { 0x0456d4df, 0x2ce41ccd },
+    { 0xf68b0a27, 0x698e5995 }, { 0xefba2501, 0x038c7468 },
+    { 0x42370495, 0x3a9b61be }, { 0x649afd66, 0xda44d7de },
+    { 0x084f81e4, 0x66b0f9a4 }, { 0xda0fac71, 0xcebc7575 },
+    { 0x293f54d6, 0x202c345a }, { 0xfc7479af, 0x69c6cf21 },
+    { 0xf84e5854, 0x32d2afff }, { 0x8d18affd, 0x50c04f72 },
+    { 0x26398789, 0x27bb636c }, { 0x0e116d4f, 0x3e41ad09 },
+    { 0x763c6a35, 0x9c376fe6 }, { 0x3b1e3b5e, 0xc357ec58 },
+    { 0xf6e83fcf, 0xf1d6a7ae }, { 0xfa60e30d, 0x28d53370 },
+    { 0xadabe93b, 0xdc213adb }, { 0xe7f14ce6, 0x99e22b4a },
+    { 0x735980a7, 0x36b95fc8 }, { 0x9e33abd3, 0xc6a5f653 },
+    { 0x232963e6, 0x67f730a4 }, { 0x8be8b472, 0xac350598 },
+    { 0x599dd6f8, 0x93e9b0db }, { 0x7659d926, 0x5a3f17cc },
+    { 0xdae4ff3a, 0x1d7fd033 }, { 0x9f288299, 0x36d586c3 },
+    { 0x73e0c64c, 0xf988a52b }, { 0xeec90d5b, 0x4f2581c1 },
+    { 0x17a3604e, 0xf1027d27 }, { 0x6e71ee8d, 0x3c8b2ed8 },
+    { 0x03179324, 0x391b7f0f }, { 0xc4bf4d6e, 0x2971f980 },
+    { 0x9645e061, 0xc4858e7b }, { 0x22f9989a, 0x81b8c9e4 },
+    { 0x3cde0bc4, 0xd4da10f7 }, { 0x86e77d02, 0xb10567b7 },
+    { 0x1fe21bf1, 0x1b4c6acb }, { 0x60f48942, 0xc84b8ada },
+    { 0x25b9ec88, 0xacf2179c }, { 0xbf69a5a1, 0x95c143ce },
+    { 0xfe91b383, 0x8186de76 }, { 0x5aa58ac8, 0xf09669fc },
+    { 0x43e45e8c, 0x090069bf }, { 0x57fda03a, 0xe3ef75ef },
+    { 0xdd5d4b0c, 0xf756791f }, { 0x517b41c3, 0x076b743c },
+    { 0x530c24c3, 0xd977c787 }, { 0xcca0079a, 0x30e1484c },
+    { 0x50947d5c, 0xbfb46936 }, { 0x3b6f3710, 0x39ccb82c },
+    { 0x09143722, 0x146b3152 }, { 0x5117479e, 0x44e4120a },
+    { 0x1108a49f, 0x268c9347 }, { 0x5abef62c, 0x8b86d502 },
+    { 0x172439c9, 0x353f1cd5 }, { 0x386c9020, 0x728ccbf7 },
+    { 0x74e36275, 0xff897a9d }, { 0xbd5601af, 0x5a8df744 },
+    { 0x1df042d4, 0x825ea8b5 }, { 0x605217d9, 0x98e4e1b8 },
+    { 0xe81c01e9, 0x10facb87 }, { 0xf57d6a49, 0x88087a0a },
+    { 0x011b1220, 0xa14bde07 }, { 0xacfb7e25, 0xe0f07149 },
+    { 0xd7d5cee9, 0x0d183b5e }, { 0x8457857c, 0x0d65bc6a },
+    { 0xadee13fc, 0x54f6bb43 }, { 0x3bff2042, 0xc45ae630 },
+    { 0x8ce43eff, 0x9b01e2be }, { 0xfc864068, 0x03ff5357 },
+    { 0xf7a9ead0, 0xd4111f17 }, { 0x8b94b004, 0xf88bacdc },
+    { 0x13823588, 0x3c0dd975 }, { 0x976c3e19, 0x59fb3e06 },
+    { 0x496b902b, 0xfc9aa2dd }, { 0x8a07f778, 0xd15eede6 },
+    { 0x075c4802, 0x8c2fb04e }, { 0xdacb8d1b, 0x15889c4e },
+    { 0x4c9ab20d, 0xd41edb76 }, { 0x6a059347, 0x981f6b2a },
+    { 0x7352116f, 0xa9e34309 }, { 0xd47ceafb, 0xb3af17fc },
+    { 0x7e99bff7, 0x82f789f6 }, { 0xcba51784, 0x434511c3 },
+    { 0xfe31bef5, 0x6eb8137b }, { 0x4c7be8f1, 0x0ba281ae },
+    { 0x6e6e9e9b, 0xdbbba8f9 }, { 0x0253a267, 0xed824fe1 },
+    { 0x63f231e1, 0xd00c71d0 }, { 0xbca9cbe8, 0x29f84919 },
+    { 0x07b85784, 0x4c456e96 }, { 0xcd1e951d, 0xf3dc9b08 },
+    { 0x686d1aaf, 0x3a6784d2 }, { 0xc4f139fd, 0x3efd2997 },
+    { 0xaab9441a, 0x977de4f9 }, { 0x1e736355, 0x7130bab1 },
+    { 0x0bf67b57, 0xeb5ed370 }, { 0x9ec17452, 0x62a37564 },
+    { 0x86ce83c4, 0xaf7aafda }, { 0xba475632, 0x953a22f8 },
+    { 0xb6587990, 0x7cadc45a }, { 0x2a386c9e, 0x32219a51 },
+    { 0xc2419980, 0xec545b6d }, { 0xd4bbb843, 0x8388c8b7 },
+    { 0x8c4efa49, 0x13de7e5e }, { 0x37d0c6ad, 0xc803e236 },
+    { 0x356e7d16, 0x48ecbf06 }, { 0xdc6ca95b, 0x20d74f27 },
+    { 0x39e9c14f, 0x5af2092b }, { 0xdfa112e9, 0x5493df3d },
+    { 0x33cacb35, 0x56c4299f }, { 0x5652ddd8, 0xcf22579f },
+    { 0x7c9daf68, 0xf858f1aa }, { 0xbd18cd77, 0x91037688 },
+    { 0x54aa108c, 0xa6cfe213 }, { 0xc7b9c3a0, 0xebe82f96 },
+    { 0x89f25a7e, 0xce5fa7a4 }, { 0x09f2f869, 0xe655cd81 },
+    { 0x51eedb13, 0x9907a4b2 }, { 0x27a8d814, 0x07159d7e },
+    { 0x1ccd3b06, 0x9374e650 }, { 0x2b699127, 0x8c9430cd },
+    { 0x21145ba0, 0x1158c00e }, { 0x75a4bc1f, 0x5f1f4e93 },
+    { 0x4632c238, 0x387b5c36 }, { 0x6f565423, 0xe2392c4b },
+    { 0xda65a44e, 0x9b3064c7 }, { 0x4f6e0c80, 0x533ad073 },
+    { 0xe1fda964, 0x9bbf78c9 }, { 0xc5fb4fdb, 0x87aed391 },
+    { 0xad3b6379, 0x559884f0 }, { 0xf8d88d55, 0x6cb71d4d },
+    { 0xd457cd07, 0x88d1117e }, { 0xaed7b2e0, 0xadc87a70 },
+    { 0x4b3d9e34, 0x89ddd48c }, { 0xb26d9aad, 0x9d5e73d9 },
+    { 0x95690496, 0xf8e7c7af }, { 0xf85a4ad0, 0x4ce85325 },
+    { 0x0c301da0, 0x900a90f8 }, { 0x44c31dac, 0xc81d307e },
+    { 0xdbb016de, 0x53682399 }, { 0xac3109a0, 0x7cf1d307 },
+    { 0xfff6e631, 0x85ffc52c }, { 0xb6602d72, 0x469aa44e },
+    { 0xd9e34eee, 0xf9d1150b }, { 0x87ee3152, 0xddb8dcfb },
+    { 0xda23a5fd, 0xb3502d74 }, { 0xc042b6f3, 0x6f674ab6 },
+    { 0xe629319d, 0x8ce1fe12 }, { 0xd5ca9159, 0x8de95335 },
+    { 0xa789cdcc, 0x38494904 }, { 0x4f42c766, 0xd90a5478 },
+    { 0xdb6cea6f, 0x139a58f6 }, { 0x21f906ef, 0x5bd89fa9 },
+    { 0x009991d5, 0x41bf1041 }, { 0x78fbcac8, 0xe4f415cb },
+    { 0x1b175c85, 0x89604665 }, { 0xfcfe8273, 0x7ebd1ee7 },
+    { 0x960c31d4, 0xf06e96c1 }, { 0x189a522c, 0x09d6c736 },
+    { 0xacfc06cd, 0xd06bdaf5 }, { 0xc49397db, 0xa54f8078 },
+    { 0x0bb4814b, 0xa9bd67cd }, { 0x946adcaf, 0x9fd81315 },
+    { 0x7c9d6e25, 0xccafdcc8 }, { 0xb968a307, 0x0db9eab9 },
+    { 0x1a6276f4, 0x5e77a3be }, { 0x160e8e66, 0x16f4a08a },
+    { 0x33f0e787, 0x7eda8d0a }, { 0xbd38d52a, 0x909e7b1b },
+    { 0xc0ad88a0, 0xca96914c }, { 0xbea06607, 0xf01e5405 },
+    { 0xcb0f0439, 0x2c479bae }, { 0xe2b0c539, 0x45765e68 },
+    { 0xd7496ffd, 0x6934deff }, { 0xfd56044c, 0x0ce4c338 },
+    { 0x66ed8fa8, 0xeeeb9989 }, { 0x0450d374, 0x5901eefa },
+    { 0x5ff79c2c, 0xab4ce920 }, { 0x832f5206, 0x9d499800 },
+    { 0x4bf2240e, 0x475e3e78 }, { 0x8baf20a4, 0x6d24bf40 },
+    { 0x7cb59c27, 0x647b0a7e }, { 0xa08fb6a3, 0x7734206e },
+    { 0xf02c4417, 0xee9f08f0 }, { 0xee24a9fa, 0x1d59fa30 },
+    { 0xb55ac653, 0xd4b19b77 }, { 0x34b89513, 0xf28e46b9 },
+    { 0x046e6ef4, 0x389fa9d7 }, { 0xc44dbb88, 0x01b1fb53 },
+    { 0xe002ffe2, 0x3e548933 }, { 0x5caed250, 0xd76ef046 },
+    { 0xc35979f0, 0x52293488 }, { 0x77cd1a5d, 0xabb8d697 },
+    { 0xa596dee1, 0x470fe1f7 }, { 0x322376be, 0x9a7548f0 },
+    { 0xec9e365e, 0x7fa4d57e }, { 0xdb7d3cda, 0xfa1934d1 },
+    { 0x6e917acf, 0xbd501e31 }, { 0x19ca21ab, 0x942e5c68 },
+    { 0xfe35bada, 0x1ad9974a }, { 0x30397a23, 0x3e7274af },
+    { 0x074fdf0a, 0x698e05ec }, { 0xb5079f23, 0x686928ba },
+    { 0xc30bb075, 0x420c38b0 }, { 0xa812a8b3, 0x01738395 },
+    { 0xedfa7b06, 0x842340e0 }, { 0x87c66f15, 0x0dd41ab0 },
+    { 0xb290a38d, 0xad63ac66 }, { 0x2839d715, 0x4c34de07 },
+    { 0x7db5e8a6, 0xb661d255 }, { 0x09c8b8ce, 0x89fc331d },
+    { 0x77f73e13, 0x44dd9c43 }, { 0x7bd9bb5a, 0x3c3230de },
+    { 0x08947b0e, 0xa3285475 }, { 0x24931256, 0x8f5b98b9 },
+    { 0xf679fd8a, 0x963ed209 }, { 0xb8bc3e9a, 0xbf743575 },
+    { 0x5eb88899, 0x15289c06 }, { 0x09ae43c6, 0xe74a2165 },
+    { 0xcd900b32, 0x7d113331 }, { 0x5f073e9a, 0x7b8ede0b },
+    { 0xb704d64c, 0x25ff0f60 }, { 0x7aee6d19, 0xecb22142 },
+    { 0x427a3ebb, 0xd5f5277c }, { 0xcfb6efce, 0xe6fe1fe0 },
+    { 0x72da7735, 0xdbb15c31 }, { 0x3b692873, 0x38421b9f },
+    { 0x059d8935, 0x52c93bdb }, { 0x641c8c43, 0x62d3ac18 },
+    { 0x698bbb2d, 0x86285a71 }, { 0x3b8c0c45, 0x66ffde51 },
+    { 0x08ece6cb, 0xb24035db }, { 0x7a2eb80c, 0xfd4d3d29 },
+    { 0x3a3ac027, 0xfd4e4d84 }, { 0xb3fcd820, 0x418c7287 },
+    { 0xc25eef98, 0x3fb2ba86 }, { 0x68002919, 0xa2a2a8ab },
+    { 0x4a61ba85, 0x1b238058 }, { 0xc8f9dba2, 0x3302f8ee },
+    { 0x4f8e545b, 0x13355738 }, { 0x4e671e73, 0x6fe67374 },
+    { 0x0786cb4d, 0xc176448a }, { 0x7800b0fe, 0x84692eb0 },
+    { 0xbf1e7657, 0x65870bd1 }, { 0x3321809a, 0x0b9be0f4 },
+    { 0x2dd65074, 0x8aac3539 }, { 0x23dc6591, 0x15eca8a6 },
+    { 0xd14f393f, 0x8cbad7c5 }, { 0x47699a07, 0x2b23dfeb },
+    { 0xea13af8a, 0x89782b0e }, { 0x6a870727, 0x974e6fa9 },
+    { 0x4693a2bc, 0xbc5c7404 }, { 0x8e5fad0a, 0x0e76f6fb },
+    { 0xec879557, 0x7b4f9d98 }, { 0xfdff4f40, 0x92d10c69 },
+    { 0xac54592a, 0x012c84fd }, { 0x5e769336, 0xa70a9edc },
+    { 0xaaf5bfd2, 0xf9b98271 }, { 0x38371405, 0x374a8c5f },
+    { 0x758cbf41, 0x0b7d98b7 }, { 0xe996cd81, 0x54f7bee4 },
+    { 0x94e98407, 0x92a26096 }, { 0xb89f260e, 0x4d748c82 },
+    { 0x82f59d11, 0x41279e44 }, { 0xa0faa310, 0xb5464cba },
+    { 0xb12c05f9, 0x02aeefa3 }, { 0x20d1d7c5, 0x075ba018 },
+    { 0xf2473714, 0xca35c979 }, { 0x6939c288, 0xbf51a300 },
+    { 0x7106f6aa, 0xa0f9dbd7 }, { 0x08b55316, 0x6fe6cad2 },
+    { 0x13917c23, 0xce5a742f }, { 0x2efb0b67, 0xffb577ff },
+    { 0x744976ca, 0x00063a79 }, { 0x4eaf7239, 0x53d40e25 },
+    { 0xca332122, 0x185a7d14 }, { 0x60f05d43, 0x0ae4f013 },
+    { 0x69271d4d, 0xa0dfb44f }, { 0x5fe871dd, 0x901e9a4c },
+    { 0x36a7840f, 0x42f3cd34 }, { 0x52a5f893, 0xab764696 },
+    { 0xeb4c5b7d, 0xe5efafb6 }, { 0xa9ef41f7, 0x79184147 },
+    { 0x0fdce4eb, 0x4b710981 }, { 0x1351d863, 0xeb778682 },
+    { 0xd54a83f2, 0x747336b9 }, { 0x552d21aa, 0x37840f84 },
+    { 0xb63eee28, 0x44acc755 }, { 0x5b9fa886, 0x4cd5701b },
+    { 0x73cd3dd2, 0xa2e6166d }, { 0x0ceec004, 0xd4e6624b },
+    { 0xc31f8eaa, 0x4f5b45d9 }, { 0xde90e084, 0x3b6cc837 },
+    { 0xeeefaf59, 0x492fbd63 }, { 0xd480beb9, 0x47a17e3f },
+    { 0x15cd4591, 0x7dc870a3 }, { 0x02a5726e, 0x4e001034 },
+    { 0xc10034ed, 0x5c038b76 }, { 0x81ab9be7, 0xe4af0ed4 },
+    { 0xc5c939d2, 0x6151bb15 }, { 0xe1e81a86, 0xf57b2502 },
+    { 0x3532c3e6, 0xd79e7fb8 }, { 0x586f5f44, 0xf90538f2 },
+    { 0xaab75bdd, 0xcc375e4a }, { 0x51085e3d, 0x54f2bbf0 },
+    { 0xbad887e3, 0xb340e787 }, { 0x119c8692, 0x1ea28e1a },
+    { 0x01cad773, 0x25f40db2 }, { 0xc2547ca4, 0xd5863679 },
+    { 0xabec2a9e, 0xbcf6113e }, { 0x3074c5c9, 0xe99fab6a },
+    { 0xf24753a7, 0x0083da8c }, { 0xf88e8509, 0xb06008b8 },
+    { 0xc8aa5683, 0x9abcdd9d }, { 0xc7a4c934, 0x307fa7d9 },
+    { 0xdeeafb55, 0x2015ae3d }, { 0x98f1291b, 0x65cf0032 },
+    { 0x711cd35c, 0xa6a3d521 }, { 0x2e871ac8, 0x34041287 },
+    { 0xf9fe3770, 0x95dc841d }, { 0x569ae7fb, 0x0a2504e3 },
+    { 0xf4f8cc6f, 0x736055f3 }, { 0x489d74df, 0x176da059 },
+    { 0xe5c20cff, 0x4579ec43 }, { 0x3560b22c, 0x8e2fed8c },
+    { 0x92563915, 0x2b0ca248 }, { 0xe4003981, 0xa652f9f3 },
+    { 0xdb93c247, 0x0c7f030c }, { 0x07ecb3bf, 0x277db171 },
+    { 0xb78d45e7, 0xd35c6621 }, { 0x868bbc0f, 0xc0e778e5 },
+    { 0x13fa7c19, 0xd1b1cb6d }, { 0xa139ea3f, 0xdd5dcc1c },
+    { 0x70de853f, 0xf53f8c21 }, { 0xecead059, 0x5bd8b127 },
+    { 0x74410483, 0x026bf30e }, { 0x1e95a228, 0xca65d6df },
+    { 0x195abde2, 0x80d72dd8 }, { 0xbb211e07, 0x0e1b51cb },
+    { 0x3a303331, 0x6fb2bd0c }, { 0xce5b5133, 0x4cdf8ed8 },
+    { 0xe8c1e47e, 0x28f46f54 }, { 0x66bccc99, 0x5249a6b4 },
+    { 0x67cd42d5, 0x7f2fb9bd }, { 0x7a20f16f, 0x35459b35 },
+    { 0x04706ef6, 0x663647bf }, { 0x9daa7b22, 0xba6d75f3 },
+    { 0x7c62d525, 0x519a4a21 }, { 0xa73c1c7e, 0x2fb67253 },
+    { 0xe543457e, 0xf92fef15 }, { 0x40cc81db, 0x0d4a9d81 },
+    { 0xb80929af, 0x65da53be }, { 0xfa75a33c, 0xc163965d },
+    { 0xc10329d7, 0x4b30e5ab }, { 0x7aba6dc0, 0x9219ef15 },
+    { 0x61fe3f5b, 0xfd01bd2c }, { 0x9db7f633, 0x84d2a139 },
+    { 0x51537c58, 0x7b102ccc }, { 0x3ec1c1a8, 0x0cd5e5dc },
+    { 0x7ce95c65, 0xa2cc69fa }, { 0xc9cb8610, 0x7fba697e },
+    { 0x46ac516e, 0x81666303 }, { 0x5531048d, 0xe5e9ac53 },
+    { 0xc74718ec, 0x403c6c33 }, { 0x3fad0853, 0xc765bdcc },
+    { 0x34ee5027, 0x8ad39285 }, { 0xa7f3d273, 0x0d9d2e9a },
+    { 0xb38c5976, 0xae98eab0 }, { 0xb9adae88, 0x6032dc40 },
+    { 0xa040b7b0, 0x12840cd3 }, { 0x83f7f1b8, 0x8516405e },
+    { 0x9f47c5ae, 0x878bef3a }, { 0xbec9dee9, 0xbe57d218 },
+    { 0x6bdc399b, 0xe627ff7f }, { 0x059bc469, 0x1f3019d5 },
+    { 0x0c0efc5e, 0x78be35e4 }, { 0x50a18cb6, 0x2702816a },
+    { 0xd320ff5e, 0x9d2f817e }, { 0x437d6b0c, 0x790ca1da },
+    { 0xa32d4822, 0x262b3758 }, { 0x27184962, 0xb42a3147 },
+    { 0x48c8476d, 0x5b9b4069 }, { 0x3a8f9fab, 0x4755bc46 },
+    { 0x34b5e1ab, 0x395c5470 }, { 0xc235eaa4, 0x4e33e6c5 },
+    { 0x194070cc, 0x3bfbdc18 }, { 0x615d6bee, 0x47ceca0a },
+    { 0xdf2e1a83, 0xe4ab57ce }, { 0xbe27be9b, 0xf4f93c23 },
+    { 0x63bf076c, 0xb8e55731 }, { 0x68e70b91, 0xdeb13960 },
+    { 0xb4fa31fe, 0x0ced5393 }, { 0xb1ac210f, 0x5e25b132 },
+    { 0x26d8ef22, 0xfe830d6e }, { 0x4bae7b8b, 0xbed285a0 },
+    { 0xf6d69825, 0x48a64901 }, { 0xe78ce99a, 0x1ecfb60f },
+    { 0x140c4c1d, 0x1abf9ef1 }, { 0x9e5ca914, 0xdb34a07b },
+    { 0x1cbbdc29, 0xffe42dd4 }, { 0x689888b5, 0x18ffc71a },
+    { 0x5edf7ff7, 0xa1446a5b }, { 0xbe2f4148, 0x8650a9b0 },
+    { 0xbd4ff27e, 0x1ebb8b92 }, { 0x0b6072f8, 0xe8201fde },
+    { 0x27d99dd6, 0xdb9ec7ee }, { 0x66340aee, 0x6088bce5 },
+    { 0x3e3fd29a, 0x4c19953b }, { 0xeafeafa1, 0x36efd6d4 },
+    { 0xd76cd1fa, 0x6134814d }, { 0xe649f720, 0x7546de88 },
+    { 0x0ef8b024, 0x1185f48e }, { 0x528f289d, 0x1c6a144e },
+    { 0x0f11f3bc, 0x5bfcced6 }, { 0x81a382cf, 0x7551d28a },
+    { 0x0d3ed0c5, 0x3687c853 }, { 0x3eb4778d, 0x87f06f59 },
+    { 0xec343e30, 0x23e6f08d }, { 0xd7a7fe6c, 0xfb83db5f },
+    { 0xffccbf96, 0x949c0401 }, { 0xab950ce1, 0xa26f0dcd },
+    { 0x19d1f7ca, 0x55295c45 }, { 0x8a8ce812, 0x4f6eef97 },
+    { 0xa5ed9104, 0x04f2aa74 }, { 0xdfc5e26e, 0x2874223b },
+    { 0x5ca65934, 0xa6c94b9c }, { 0x2ec6881b, 0xde0f47a5 },
+    { 0x54104310, 0xa3c43fdb }, { 0xc67c18f2, 0x495ee936 },
+    { 0xf9d93c60, 0x5e85c084 }, { 0xeb3d98ed, 0x38434894 },
+    { 0xf446d949, 0xfe996501 }, { 0x9a75d960, 0x18086f15 },
+    { 0x60d31c33, 0x22dc5efe }, { 0xb46b2a34, 0x2ef38f2b },
+    { 0xeaebf9f5, 0xd0482fe9 }, { 0x0a4c1adc, 0x2f177911 },
+    { 0x6a9ead89, 0xcc2419c7 }, { 0x815ac638, 0xb6de1a0b },
+    { 0xdf952cc8, 0x22ae5dc4 }, { 0x2f12a6b5, 0x0e89943a },
+    { 0x58701e7e, 0x02f47320 }, { 0x6c059464, 0x2985f3c3 },
+    { 0xb5218f45, 0x956cab2f }, { 0x2148c782, 0xdfdb59f7 },
+    { 0xa2e53470, 0x239eac03 }, { 0x5f54e060, 0x8d95e536 },
+    { 0xcec0ce33, 0x3d0b1917 }, { 0xa1d86e1e, 0xd18839a9 },
+    { 0xd3c2973e, 0xad19e8b7 }, { 0x489af819, 0x0eeaccfe },
+    { 0x82c05822, 0xf409885c }, { 0x143761ea, 0x4e52fdb8 },
+    { 0xd463ca00, 0xbf487657 }, { 0x811b4e7d, 0xdc9cb7dd },
+    { 0xbdb6c157, 0x433957b7 }, { 0xb372958a, 0x95ca13ed },
+    { 0x3b8d10c7, 0xa5195fd9 }, { 0x7e3fa42a, 0x8550fbb2 },
+    { 0x667c28b4, 0xd8257812 }, { 0xc1415e1e, 0x94c96e79 },
+    { 0x17f51874, 0x61dce7a5 }, { 0xeaadc4f5, 0x2ec91c16 },
+    { 0x5600ba67, 0xd0a52085 }, { 0x76d252b0, 0x8bfb9c2e },
+    { 0xe374aaec, 0xd915697f }, { 0xb2cc2b3b, 0x2bc19131 },
+    { 0xb9ee1b08, 0xc505d49c }, { 0x3253c96a, 0xbf742f7a },
+    { 0x8ff4a96b, 0x221d0fa6 }, { 0xb4a25568, 0xbc4fbb63 },
+    { 0x4693b306, 0xf19e482c }, { 0x968f9abb, 0xc4ef3524 },
+    { 0xdd55e6f3, 0xcdb396af }, { 0x67df7806, 0x51bc2f45 },
+    { 0xf65392bf, 0x017d2ce6 }, { 0x84db8720, 0xc3f9d2ed },
+    { 0xeb6e3c73, 0xcaccd599 }, { 0x9d7eb982, 0xba47c6ad },
+    { 0x83e0486b, 0xc69b251f }, { 0x085c5172, 0xc345235c },
+    { 0xee8a487e, 0xd55abcec }, { 0xec2bd970, 0x6f8c2cab },
+    { 0x95d43b9e, 0x5675d478 }, { 0xb879f96c, 0xc5a12293 },
+    { 0x2460514b, 0x6b7ff048 }, { 0xdedcd592, 0xdcf90481 },
+    { 0xbf8d67d4, 0xe20a981c }, { 0xafe26862, 0x28992346 },
+    { 0xbbfd9f5f, 0x5ef9ba51 }, { 0xc3894bc4, 0x07f6e923 },
+    { 0xa4ccfb5c, 0x8b1fc930 }, { 0x9f47b7b0, 0x9ad540cd },
+    { 0xe66886c6, 0x6c944325 }, { 0x2d4bbd2b, 0x3439b90f },
+    { 0x0eef1970, 0xcac877c0 }, { 0x7cb7247d, 0x2d77e4fa },
+    { 0xa533d1a6, 0x7949dbfb }, { 0x33f7b798, 0x351c4fbf },
+    { 0xbe8ef440, 0x2eb4f965 }, { 0x040c85fd, 0x1206b890 },
+    { 0x002a4bc6, 0x158a1df9 }, { 0xa8509c82, 0x835d1349 },
+    { 0xdf00dccd, 0x0e3a7840 }, { 0xedbc2040, 0x9af65335 },
+    { 0x6ee25281, 0x12828206 }, { 0xfaad5f3c, 0x135ab16b },
+    { 0xd9c98dfd, 0x17d08483 }, { 0xf18915ba, 0xf3a45338 },
+    { 0xe314de5e, 0x80a75baa }, { 0x19254d61, 0x48f49cc6 },
+    { 0x020c9e0f, 0x4428aaaf }, { 0x56a074d6, 0x6787ccd6 },
+    { 0x8a770806, 0x59c4bfba }, { 0xf40a9b99, 0xf20696d9 },
+    { 0x898288d0, 0x45e39433 }, { 0x1679e334, 0x35ad6c57 },
+    { 0x3846aefe, 0xffc4fceb }, { 0x69310fa7, 0xb7d39293 },
+    { 0x17ca4edb, 0x3c299fb0 }, { 0xb23429fc, 0x5e79c28e },
+    { 0xa3a1573e, 0xc35f336f }, { 0x8f435446, 0x97c6cd4b },
+    { 0x68345aec, 0xefd5fbd7 }, { 0x4dd534ba, 0x17e95709 },
+    { 0x18f61100, 0x4a1882b1 }, { 0x9480f4a8, 0x34f84a06 },
+    { 0x4c132524, 0x01e45aaf }, { 0xf6e8533a, 0x26820a47 },
+    { 0x7faf3762, 0xb49a2de0 }, { 0xeedc6c5b, 0xce87ebbc },
+    { 0x8d7e0868, 0xd33f22bb }, { 0x9deeef87, 0x18b0626e },
+    { 0x1701c235, 0x095adad1 }, { 0x5a5f0d54, 0x483b0da7 },
+    { 0x0700a885, 0xb1ad97d0 }, { 0xe1392a7d, 0x68f52dae },
+    { 0x1840873b, 0xc7282564 }, { 0x0b8e3ec0, 0x6fe51bcc },
+    { 0xc60cfdb0, 0xeee5bb43 }, { 0xb0da8311, 0x4b66e3e2 },
+    { 0x5d45d717, 0x60d4ed91 }, { 0x93aba596, 0x1977e98d },
+    { 0x8cb549ae, 0xc931951e }, { 0x14e1a7ff, 0xd752729b },
+    { 0x5794367d, 0xd6f59b73 }, { 0xcad92029, 0xd01f93e8 },
+    { 0xc5a1fb1b, 0x2a8f0187 }, { 0x314c3349, 0xce9d455f },
+    { 0xdcf9ecf9, 0x1cb39174 }, { 0x219923f6, 0x77809ae8 },
+    { 0x717ccd75, 0x48a11a80 }, { 0xf7e59ab5, 0x44ed92cb },
+    { 0x97ac579b, 0xeae6c9fe }, { 0x40e8e26a, 0x1ef93d3c },
+    { 0xb6774a57, 0x8fb5b7cf }, { 0xccf6f771, 0x4cd44717 },
+    { 0x001c5982, 0xee500771 }, { 0x2d9e567f, 0x25a69da0 },
+    { 0x5dfb2094, 0x510991ba }, { 0x9c56ac6c, 0xefb33dff },
+    { 0xc665e8e0, 0xd435a477 }, { 0x417fc33b, 0x0f352306 },
+    { 0x35ce1cf0, 0xdf6da391 }, { 0xca3da55c, 0xa9260487 },
+    { 0x30a81214, 0x676eba2d }, { 0x996ac199, 0x037412f0 },
+    { 0x10256618, 0xc11a855f }, { 0x52b1273d, 0xdd34b6ce },
+    { 0xa0c23f31, 0x70e4cd10 }, { 0x2c2e0c68, 0x27239b82 },
+    { 0x15d9291d, 0xaef038ae }, { 0xfd54b057, 0x941ca35b },
+    { 0x1891b32b, 0x572d7b50 }, { 0x629b121e, 0x694ef58c },
+    { 0xd0aa4872, 0xbfd4a1a3 }, { 0xb6a8314e, 0xfaf4ec64 },
+    { 0xb4456aa4, 0x2b2d8b23 }, { 0xb284ecac, 0x2fb2f51d },
+    { 0x7d5e7ad9, 0x16918cd1 }, { 0xf157b3ea, 0xa3a45161 },
+    { 0x8902564a, 0x737a5f45 }, { 0x440c0c3b, 0xeef62546 },
+    { 0x1768d1ae, 0xc166a6cf }, { 0xee6bc133, 0x325c4e82 },
+    { 0xc1408f2f, 0xe5d7d377 }, { 0x4a0d2337, 0x917f1d82 },
+    { 0xdd578252, 0xb88d6d1f }, { 0xeeefe690, 0x494e1e45 },
+    { 0x3b6d6b0b, 0xbe6c5cf5 }, { 0xe2612f88, 0x7fb6ec38 },
+    { 0x79d057dc, 0xc10b49b0 }, { 0x13af1ded, 0x6f68b5ec },
+    { 0x09f546c8, 0xd5478e02 }, { 0x240396df, 0xa87983b2 },
+    { 0x68b6b27d, 0x7dbac34e }, { 0x053a9d63, 0xd5d3f6fa },
+    { 0xaf31c4f5, 0xf6df0d09 }, { 0x98b3f0c8, 0xf70ef802 },
+    { 0x978c0b36, 0x52b332be }, { 0xae2373f7, 0x304a9a58 },
+    { 0x878bf080, 0xc3fae48d }, { 0xc90fe3b1, 0x47d6bacf },
+    { 0xc06d1504, 0x5e307306 }, { 0x99b4ff6f, 0x583ea391 },
+    { 0xf361bea3, 0xd42f7137 }, { 0x0ba60e6b, 0x49ff3b75 },
+    { 0xbd5ef32e, 0x6e04985b }, { 0x9dd81f96, 0xb5447bcc },
+    { 0x1827defe, 0xb9fd232c }, { 0x3d23e1a3, 0xb0226425 },
+    { 0x519b7ef4, 0x5603e97b }, { 0x8e55c320, 0xb5eaca67 },
+    { 0xfa7a73ea, 0x81fbaf69 }, { 0xb08eb511, 0x46b89520 },
+    { 0x2dc5fafb, 0x765012e1 }, { 0x0e0d4b1c, 0xda6b72dd },
+    { 0xa2143e53, 0x27fa6cb9 }, { 0x044124b3, 0xc9733846 },
+    { 0x3318da55, 0xe1ca82c0 }, { 0xe919e6c5, 0x16347ec7 },
+    { 0x1415dddb, 0xfcb55341 }, { 0xebda89ab, 0x25df2ac9 },
+    { 0x1e2550e1, 0xc0f249d1 }, { 0x21565e55, 0x355ecce2 },
+    { 0x1bf0a305, 0xe7b374be }, { 0xc2503684, 0x6cf9043a },
+    { 0x8bd137e2, 0x811bd337 }, { 0xa4139c45, 0x1fc884f9 },
+    { 0x60f5c339, 0x954aab44 }, { 0x9a2dd14e, 0xb8310145 },
+    { 0x51c005b2, 0x437eda2b }, { 0x28833c4e, 0xa89e5914 },
+    { 0x96b88a3b, 0x7c33a56c }, { 0xdc8afdfc, 0xa013ddc2 },
+    { 0x2d83f572, 0xb500c36e }, { 0x2c7d6525, 0x5a9a202d },
+    { 0xe65349f9, 0x6fc11791 }, { 0x053489a1, 0x8cadae20 },
+    { 0x9365b50d, 0xf6da327d }, { 0x22338eac, 0xc8d3d213 },
+    { 0x48eb88fa, 0xbabc3625 }, { 0xc742ad7a, 0x8204f38a },
+    { 0x04cb9a3c, 0x73ae489e }, { 0x011012e2, 0x67f20527 },
+    { 0x74a25f7a, 0x83d209d8 }, { 0x4957c530, 0x99a70bbc },
+    { 0x41673991, 0x36a5fedc }, { 0x79ad1ff4, 0x845ed5b0 },
+    { 0x205d4ca2, 0xf143a308 }, { 0x07a1b38b, 0xd767f7db },
+    { 0x6e698e7c, 0x8850df72 }, { 0x99130ec7, 0xd7f6d3cd },
+    { 0x16545ec2, 0x131c7830 }, { 0xee2cd895, 0x3b76946f },
+    { 0x36a9b175, 0x9ead7106 }, { 0x8b6de3e6, 0xcf5d2529 },
+    { 0x8bf9308b, 0xa51d9748 }, { 0x62ec6880, 0x2ef0d67a },
+    { 0x4377648c, 0xa6139f37 }, { 0x6b6b8f25, 0xdec5c23c },
+    { 0x51e1b538, 0x77a7b401 }, { 0x5d9e94f5, 0xf24c83fb },
+    { 0x47f20f58, 0xe831daac }, { 0xca4923dc, 0x2ef03052 },
+    { 0xdfac584c, 0x326d3fca }, { 0x86c0f32e, 0x5a66fbfe },
+    { 0xe6bcc185, 0x9d4847ce }, { 0x4800d470, 0xb2839f1c },
+    { 0x8b1d2eea, 0x0f97fd9f }, { 0xbcd94484, 0x0b536086 },
+    { 0x8bee12ee, 0xcb0e8ac1 }, { 0xccaab5cd, 0x91abc213 },
+    { 0x1abbb975, 0x3c44d3e5 }, { 0xb0f7b527, 0xcad71ff1 },
+    { 0xf4f813a7, 0x33b94851 }, { 0xca05872f, 0x8753be4e },
+    { 0x7f97a282, 0xf59ef7bc }, { 0xb8a8b6a7, 0xf01a92d9 },
+    { 0x561e0770, 0x67fd54c1 }, { 0x0ccfb52e, 0xe7a2aea4 },
+    { 0xe46024bc, 0xa97dad4e }, { 0xd4ee3d8c, 0x52b085c4 },
+    { 0xc57033ad, 0x2418074d }, { 0x2250ab3c, 0xcade71bd },
+    { 0x5ff3dd70, 0x56c9daed }, { 0x61060cc7, 0xb5a74986 },
+    { 0x55c06ed4, 0x2e7ca8b2 }, { 0x59bfe84c, 0xd88269ae },
+    { 0xa0e0494a, 0x46d0f74d }, { 0xd2b7d653, 0xd55094f2 },
+    { 0x810cc6af, 0xfff115a6 }, { 0x415f2799, 0x64b8b539 },
+    { 0xf0b3bad2, 0xc5b47aea }, { 0x9e169cc5, 0x372ecbb1 },
+    { 0x9bc3ec21, 0x1db05e10 }, { 0x633a7867, 0xaa567fcc },
+    { 0xb8b2c16a, 0x2b53d39c }, { 0x1f5a714d, 0x63a80b38 },
+    { 0x9fd7ea96, 0x50519a28 }, { 0xfb17c5bf, 0x3577fd50 },
+    { 0xe173972c, 0x2d6935a9 }, { 0xa217857d, 0x912ab137 },
+    { 0x0d198e61, 0x75b12963 }, { 0x1495dd9a, 0x447e0ece },
+    { 0xf6adaceb, 0xa95a5a73 }, { 0x6b4e97f7, 0x160c77d2 },
+    { 0xa3bea6d9, 0x58fae9a1 }, { 0x2ade5abc, 0x8b11cff4 },
+    { 0xbde7503a, 0x29443c5e }, { 0x1d38d124, 0xd97be9f0 },
+    { 0x8400b4e6, 0xf248118c }, { 0x840168e8, 0x3cdf9361 },
+    { 0x8ff92ded, 0x36c7f87c }, { 0x9718f803, 0xaaedf2c1 },
+    { 0x4b47e062, 0x1dfa6a17 }, { 0x12a15b45, 0xc16ee945 },
+    { 0xed21a1ea, 0x06c412d8 }, { 0x3f1ce392, 0x06e13248 },
+    { 0xfdcf9b23, 0xf49f3c49 }, { 0xefcd2636, 0xe1e7fa78 },
+    { 0x04b9225b, 0xa5552c30 }, { 0xac628acf, 0xe5e9fb73 },
+    { 0xdf7d1696, 0xc3052cca }, { 0xc9e1aedf, 0x7d1b8343 },
+    { 0xf18fcde6, 0x9994f722 }, { 0x58bec89e, 0xcbd016f7 },
+    { 0xf3ff0b65, 0xc827d84f }, { 0x49d58670, 0x27ea7f87 },
+    { 0xab2ac9da, 0xc145d1d2 }, { 0x3a22ea2d, 0xa4a3612b },
+    { 0x2e8e59c7, 0x1cc71296 }, { 0x9d28aba8, 0x6f5bd80d },
+    { 0xdf509137, 0xb8cd8a35 }, { 0x98b9710b, 0x763287d7 },
+    { 0xe0dcd24c, 0x26e1685b }, { 0x457d7f2a, 0x19452026 },
+    { 0x21903e2e, 0x82bedf0f }, { 0xf316ff07, 0xcde856de },
+    { 0x7e1a170e, 0xc15154c2 }, { 0xc95cc146, 0xac68b894 },
+    { 0xca425667, 0xa552c2e0 }, { 0xa6c92d4d, 0x0f9c366f },
+    { 0x9ab8d31b, 0x2ab7ea7b }, { 0x993c71cd, 0xfb2090f1 },
+    { 0x50bf8353, 0x9ea4a487 }, { 0xe67eaaad, 0xf010ab74 },
+    { 0x46b08182, 0x06f42491 }, { 0x57090cf5, 0x49aea994 },
+    { 0x60c07f73, 0x565a11ce }, { 0x877ff569, 0x295e0c6f },
+    { 0xe428dfb9, 0xa5bcc082 }, { 0x2ed8e53b, 0x42e6ab31 },
+    { 0xcf1a5880, 0x4b741159 }, { 0x13433be6, 0x230d533f },
+    { 0x6f07751f, 0xf98ee509 }, { 0xae8c6efa, 0x90fe889e },
+    { 0x45daa1ab, 0xdeb7af59 }, { 0x372b0a23, 0x69e73868 },
+    { 0x911f9a08, 0x72d7af67 }, { 0xb0f7f91a, 0x830871ed },
+    { 0x8a1bb973, 0x3c677bdd }, { 0xefebd9ac, 0xf9e1d5a1 },
+    { 0xa61b148d, 0x2a570cde }, { 0x2fd03ee8, 0x86eeb750 },
+    { 0xb964462b, 0x58e30888 }, { 0x277ab100, 0xa754c4f9 },
+    { 0x5c43e966, 0x278ccc8e }, { 0x0f7788c8, 0xf82ca737 },
+    { 0x365094a6, 0x2487bd4b }, { 0x26c5ef0c, 0x018502eb },
+    { 0xd3d29b4e, 0xdbfc2cb7 }, { 0xc0faf328, 0x6121dd65 },
+    { 0xf121c24c, 0xfc6b030e }, { 0xaa873dcb, 0xa9f80ac3 },
+    { 0x780cf4d7, 0xc7ff296b }, { 0x8fccda75, 0x145f8256 },
+    { 0x29a8ec0c, 0x99fb059d }, { 0xa39d6a96, 0x29aade36 },
+    { 0x42f1530b, 0x412cee51 }, { 0xcf976c63, 0x592f0aad },
+    { 0x158d09f6, 0x8ce89b6f }, { 0x6b1c6742, 0x05a3acda },
+    { 0x137fee36, 0x38de8018 }, { 0xe3a93399, 0x5209b686 },
+    { 0xc6b805ea, 0xe79c3d44 }, { 0x609553a8, 0xab8fdb25 },
+    { 0xaa58bab8, 0x147d3d02 }, { 0x3d2af86d, 0x4cfbccd3 },
+    { 0x92b2e48b, 0xafba057b }, { 0x56e342f3, 0x97ff6968 },
+    { 0x3560e32f, 0x148b4873 }, { 0x22a373d9, 0xc4bf8442 },
+    { 0xe8cdc6cd, 0x330a3908 }, { 0x9722e79d, 0x780c84b4 },
+    { 0xe5d71f09, 0x63231f02 }, { 0x5162d363, 0xf9db479d },
+    { 0xa44fa098, 0xc2a6ae85 }, { 0xdef989bb, 0x2a5282a7 },
+    { 0xd5794dc4, 0xa2798b53 }, { 0x814abb06, 0xf7170104 },
+    { 0x641f48f1, 0xb62003b4 }, { 0x5dff611e, 0x60b0c2f1 },
+    { 0x9db9dd3d, 0x75fb9df8 }, { 0x13ca4229, 0xa536a5ba },
+    { 0x29733946, 0x8715af68 }, { 0x4cec1018, 0x2b99d11b },
+    { 0x14ed83be, 0x7293c90f }, { 0x43578ed1, 0x314f11ee },
+    { 0x7136ed8a, 0xd47475ba }, { 0xd4611622, 0x48daeb55 },
+    { 0x27f9c43b, 0x9ddeb1ab }, { 0xcae30ede, 0x9259b3f3 },
+    { 0xfb47cfe4, 0xa4d8aea7 }, { 0xb0a68240, 0x2b355e65 },
+    { 0x3932ec53, 0x9af66a58 }, { 0x3b92b88a, 0x23c24885 },
+    { 0xd170bdfa, 0x0fd45bf4 }, { 0x729a352f, 0xa13260cf },
+    { 0xa02c2ca4, 0xa2c3ffb4 }, { 0x79945c2b, 0xf4b62a86 },
+    { 0x83602c21, 0x59d3a72a }, { 0x5849f931, 0x1ef4a5ba },
+    { 0xeca8252f, 0xd6609ba0 }, { 0x684a1008, 0xb9541ea1 },
+    { 0x87884a35, 0xdb597573 }, { 0xef68735f, 0xa1af7944 },
+    { 0x9d60fb06, 0x80e1cdb8 }, { 0x34a19718, 0xb215c23b },
+    { 0xaa8feb0b, 0xd621b4fa }, { 0xb5534859, 0x1fd8ea54 },
+    { 0x26422577, 0x3139e4cb }, { 0xdeedab19, 0x6c80158b },
+    { 0xeb8f15a4, 0x18f3c66f }, { 0xf7feda67, 0xd337d84e },
+    { 0x63efbbe3, 0xfe74c3cf }, { 0x418f7094, 0x88d21206 },
+    { 0x8998f55a, 0x0f83dcf6 }, { 0xc8baff86, 0xe5496be3 },
+    { 0x7eba2371, 0xe2956131 }, { 0x1cbb24b5, 0x47b59c6c },
+    { 0xcc6c5855, 0xf85d318b }, { 0xc064f11f, 0x54fed0b9 },
+    { 0x4d6c0ee6, 0x283902c1 }, { 0xe8970222, 0x7bb994cb },
+    { 0x48536be3, 0xa3eaef9d }, { 0x75839ded, 0x21bb16e3 },
+    { 0xef35d32c, 0x830ea97f }, { 0x653fbb9f, 0xb212fbed },
+    { 0xe22044a7, 0x5136855e }, { 0x27a79b6a, 0x4856eea3 },
+    { 0x3d883258, 0x3cf87bd2 }, { 0x5e5c216b, 0xe0e690de },
+    { 0x4cde5f50, 0xfbe40d35 }, { 0xee5757d7, 0x70413917 },
+    { 0x7f6386dc, 0xc46cd4af }, { 0x59020508, 0x4fc0774d },
+    { 0x2768d55d, 0x04fd5a0f }, { 0xbe18e037, 0xa39a2a79 },
+    { 0xd463df8d, 0x0d535cbf }, { 0xd81e0b0f, 0x3689a13f },
+    { 0x5c66936a, 0x8d568dc5 }, { 0xdf1e87cc, 0xc7633ab7 },
+    { 0x79583815, 0x38f1a864 }, { 0xcb3ac306, 0x2f6dfcee },
+    { 0xb5d4db77, 0x85f60952 }, { 0x9180a4b6, 0x0ed22b83 },
+    { 0xc0431c37, 0x8440f6ee }, { 0xf8d7dc84, 0xb708ff14 },
+    { 0x57437dc9, 0x2243fb4e }, { 0xf6282afd, 0xca52aa20 },
+    { 0x12fed73d, 0xd1ddf9ba }, { 0xd5e90e7f, 0x02b7d886 },
+    { 0x00c3ed52, 0xb0e4615a }, { 0xe872670a, 0x2b0f2df0 },
+    { 0x1def7dbd, 0x79e34873 }, { 0x8096dd5b, 0x58ba3c60 },
+    { 0x123a09a2, 0xf35927b6 }, { 0x3786f4a1, 0x1f9810f8 },
+    { 0x959eba6f, 0x9ee5d5bc }, { 0xe4c720cf, 0x4639f78e },
+    { 0x54cdee72, 0xc10887b8 }, { 0x62d921d3, 0x0375a6f8 },
+    { 0x0a6e2bd6, 0x3795bb77 }, { 0x91db76f4, 0x77345ccf },
+    { 0xccfaf3ec, 0x125f15d6 }, { 0x96d5d14c, 0xf83fde01 },
+    { 0xa478448f, 0x793974b2 }, { 0xb5e04e32, 0xa27e3eaa },
+    { 0x31659b28, 0xd34f7b15 }, { 0xad61374d, 0x5f3a2621 },
+    { 0x601a93ec, 0x2afde759 }, { 0xa545f80c, 0x5d09bcd0 },
+    { 0x8559bc2d, 0x809cb0d7 }, { 0x22116dda, 0x28adc7b1 },
+    { 0x195f099a, 0xc78b55d6 }, { 0x0a450061, 0x93750517 },
+    { 0x03babce1, 0x9e43666f }, { 0x9c374259, 0xa5f802f1 },
+    { 0xf15b5227, 0x7d71fd97 }, { 0xe93166ba, 0x8ee890f7 },
+    { 0xd7557c07, 0xb688f78d }, { 0x58f203ef, 0x7feddc37 },
+    { 0xbd18a4e3, 0x3bfd8752 }, { 0x070b4a55, 0xd486f6be },
+    { 0xccb88c71, 0xe940b006 }, { 0xe0105b20, 0x30024cb5 },
+    { 0xa58df1d2, 0x26deb956 }, { 0x0798d6dd, 0x3af0502d },
+    { 0xc8993279, 0xa636d091 }, { 0xd376dd99, 0x7832709a },
+    { 0x3e7f9791, 0x2dc2d5a3 }, { 0xbf700460, 0xec7eb118 },
+    { 0x9b4904be, 0x48719509 }, { 0x55778255, 0x9ec35346 },
+    { 0xbf4f80d2, 0x17df2885 }, { 0xe155fb32, 0xbb48cb0b },
+    { 0x42b6cd68, 0x50efc04e }, { 0x3b7e0d5f, 0x7fb21874 },
+    { 0x175a452e, 0xb18a5bd9 }, { 0xbf638479, 0xb53e1752 },
+    { 0xb111b6d4, 0xb101d523 }, { 0xac4d9d69, 0x98b88dab },
+    { 0x1e065885, 0x8cae6e92 }, { 0x1fd43d35, 0xbfb6e057 },
+    { 0x0e38bc44, 0x3f61dbe2 }, { 0x4a48835b, 0x2993a277 },
+    { 0x0d7783d5, 0xc05fe85a }, { 0x9a71741d, 0x04997643 },
+    { 0xde2c36ff, 0x5bd9be76 }, { 0x1cb19e37, 0xa5c57fe4 },
+    { 0xc91968b8, 0xae35d42b }, { 0x5a4b9b08, 0x20811966 },
+    { 0x605244c8, 0x3163a063 }, { 0x8c442c01, 0xde4b0ee9 },
+    { 0x4a26399e, 0x2fd19566 }, { 0xa449742f, 0x436596b5 },
+    { 0x74aa18cb, 0x58a07049 }, { 0xc6288dc0, 0xa2884767 },
+    { 0x12ad100a, 0xfda09500 }, { 0x2d4b8416, 0x42726ef7 },
+    { 0x722f59a7, 0x47c23198 }, { 0x408c52fb, 0xf84ecc7e },
+    { 0xf68ccf8a, 0x14cc5305 }, { 0x2d3829c0, 0x6203829d },
+    { 0x62ab9404, 0xcd2f9e54 }, { 0x5bbadfa0, 0x3b06dc1b },
+    { 0x792507e0, 0x386becb9 }, { 0x10eaf4ce, 0x25728a39 },
+    { 0x96db1a3d, 0x4c132d2f }, { 0x05652b6c, 0x69bab894 },
+    { 0xb8b0e19c, 0xa22fdab4 }, { 0x1fd2d9e9, 0x9e38d2dc },
+    { 0xc9958948, 0x71150a10 }, { 0x41ea3af6, 0x965e89d5 },
+    { 0xc860db6b, 0xbd726606 }, { 0xe5fe7aa0, 0x4c46750f },
+    { 0x40155571, 0xf6af8c59 }, { 0xa1762bad, 0xe890e53c },
+    { 0x4fcb8251, 0x4934bf79 }, { 0x1b468403, 0x5fb852ea },
+    { 0x9b56949d, 0xf93fea88 }, { 0x7f444c7a, 0xe511b148 },
+    { 0x49e75a6e, 0xc9074fd1 }, { 0x99cb010b, 0x2e820ead },
+    { 0x7e5a66b8, 0xb28ec9f6 }, { 0x328a2e87, 0x5da33de9 },
+    { 0x491243a2, 0x6b196da6 }, { 0xf6f3b584, 0x69d3f6db },
+    { 0xecf5e5ec, 0x421db4ec }, { 0x603af21a, 0x9a764900 },
+    { 0xae9ce0f3, 0x81caecd2 }, { 0xbd59a043, 0x48f51938 },
+    { 0xe0bbf1eb, 0x4f984a4a }, { 0x28507aaf, 0x0f5bb928 },
+    { 0x561f99a1, 0x12bc67ed } };
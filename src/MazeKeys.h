@@ -0,0 +1,11 @@
+#ifndef MAZE_KEYS_H_INCLUDED
+#define MAZE_KEYS_H_INCLUDED
+
+/* Zobrist keys of the features of a map that mm_rehash() hashes (see
+   MazeMap.c), as their high and low 32 bits. MazeKeys.c is generated by
+   tools/zobrist.pl, for maps of 25 by 25 squares. */
+#define MM_NUM_KEYS 4479
+
+extern const unsigned long mm_zobrist_keys[MM_NUM_KEYS][2];
+
+#endif /* ndef MAZE_KEYS_H_INCLUDED */
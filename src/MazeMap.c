@@ -1,4 +1,5 @@
 #include "MazeMap.h"
+#include "MazeKeys.h"
 #include <assert.h>
 #include <string.h>
 #include <stdlib.h>
@@ -6,6 +7,84 @@
 int dir_dr[4] = { -1,  0, +1,  0 };
 int dir_dc[4] = {  0, +1,  0, -1 };
 
+/* Features hashed (cell kinds are numbered as in journal entries and border
+   sides as in Rect): */
+#define Z_CELL(kind, r, c, val) \
+    ((((kind)*HEIGHT + (r))*WIDTH + (c))*2 + ((val) == PRESENT))
+#define Z_LOC(r, c)         (3*HEIGHT*WIDTH*2 + (r)*WIDTH + (c))
+#define Z_DIR(dir)          (Z_LOC(HEIGHT, 0) + (int)(dir))
+#define Z_BORDER(side, val) (Z_DIR(4) + (side)*HEIGHT + (val))
+
+/* The generated key table must cover exactly the features above: */
+typedef char key_table_check[Z_BORDER(4, 0) == MM_NUM_KEYS ? 1 : -1];
+
+/* Returns the Zobrist key of a feature. The keys are fixed pseudo-random
+   numbers (see MazeKeys.h) rather than drawn at startup, so that they need
+   no initialization and are the same in every process. */
+static MazeHash zobrist(int feature)
+{
+    return (MazeHash)(mm_zobrist_keys[feature][0] << 16 << 16) ^
+           (MazeHash)mm_zobrist_keys[feature][1];
+}
+
+/* Returns the key of a square or wall with the given value (unknown values
+   have none, which keeps clearing cheap). The key is masked rather than
+   skipped, since whether values are known is hard to predict. */
+static MazeHash cell_key(int kind, int r, int c, int val)
+{
+    return zobrist(Z_CELL(kind, r, c, val)) &
+           ((MazeHash)0 - (MazeHash)(val != UNKNOWN));
+}
+
+static void set_border(MazeMap *mm, int side, int *edge, int val)
+{
+    mm->hash ^= zobrist(Z_BORDER(side, *edge)) ^ zobrist(Z_BORDER(side, val));
+    *edge = val;
+}
+
+MazeHash mm_cell_key(int kind, int r, int c, int val)
+{
+    return cell_key(kind, r, c, val);
+}
+
+MazeHash mm_border_key(int side, int val)
+{
+    return zobrist(Z_BORDER(side, val));
+}
+
+MazeHash mm_pose_hash(const MazeMap *mm)
+{
+    return zobrist(Z_LOC(mm->loc.r, mm->loc.c)) ^ zobrist(Z_DIR(mm->dir));
+}
+
+/* Returns the part of a map's hash that is due to its pose and borders: */
+static MazeHash outline_hash(const MazeMap *mm)
+{
+    return mm_pose_hash(mm) ^
+           zobrist(Z_BORDER(0, mm->border.top))    ^
+           zobrist(Z_BORDER(1, mm->border.right))  ^
+           zobrist(Z_BORDER(2, mm->border.bottom)) ^
+           zobrist(Z_BORDER(3, mm->border.left));
+}
+
+MazeHash mm_rehash(MazeMap *mm)
+{
+    int r, c;
+
+    mm->hash = outline_hash(mm);
+    for (r = 0; r < HEIGHT; ++r)
+    {
+        for (c = 0; c < WIDTH; ++c)
+        {
+            const MazeCell *cell = &mm->grid[r][c];
+            mm->hash ^= cell_key(JE_SQUARE, r, c, cell->square) ^
+                        cell_key(JE_WALL_N, r, c, cell->wall_n) ^
+                        cell_key(JE_WALL_W, r, c, cell->wall_w);
+        }
+    }
+    return mm->hash;
+}
+
 int mm_get_wall(const MazeMap *mm, int r, int c, Dir dir)
 {
     if (((int)dir&1) == 0)  /* north/south */
@@ -18,18 +97,69 @@ int mm_get_wall(const MazeMap *mm, int r, int c, Dir dir)
     }
 }
 
+static void journal_add(MazeJournal *journal, unsigned short entry)
+{
+    if (journal->size < MAX_JOURNAL)
+        journal->entry[journal->size++] = entry;
+    else
+        journal->incomplete = true;
+}
+
 void mm_set_wall(MazeMap *mm, int r, int c, Dir dir, int val)
 {
+    MazeCell *cell;
     if (((int)dir&1) == 0)  /* north/south */
     {
-        mm->grid[(dir == NORTH) ? r : (r + 1)%25][c].wall_n = val;
+        if (dir == SOUTH) r = (r + 1)%25;
+        cell = &mm->grid[r][c];
+        if (cell->wall_n == val) return;
+        if (mm->journal != NULL)
+            journal_add(mm->journal, JE_MAKE(JE_WALL_N, r, c, val));
+        mm->hash ^= cell_key(JE_WALL_N, r, c, cell->wall_n) ^
+                    cell_key(JE_WALL_N, r, c, val);
+        cell->wall_n = val;
     }
     else  /* east/west */
     {
-        mm->grid[r][(dir == WEST) ? c : (c + 1)%25].wall_w = val;
+        if (dir == EAST) c = (c + 1)%25;
+        cell = &mm->grid[r][c];
+        if (cell->wall_w == val) return;
+        if (mm->journal != NULL)
+            journal_add(mm->journal, JE_MAKE(JE_WALL_W, r, c, val));
+        mm->hash ^= cell_key(JE_WALL_W, r, c, cell->wall_w) ^
+                    cell_key(JE_WALL_W, r, c, val);
+        cell->wall_w = val;
     }
 }
 
+void mm_set_square(MazeMap *mm, int r, int c, int val)
+{
+    if (mm->grid[r][c].square == val) return;
+    if (mm->journal != NULL)
+        journal_add(mm->journal, JE_MAKE(JE_SQUARE, r, c, val));
+    mm->hash ^= cell_key(JE_SQUARE, r, c, mm->grid[r][c].square) ^
+                cell_key(JE_SQUARE, r, c, val);
+    mm->grid[r][c].square = val;
+}
+
+void mm_set_journal(MazeMap *mm, MazeJournal *journal)
+{
+    mm->journal = journal;
+    if (journal != NULL)
+    {
+        journal->size = 0;
+        journal->incomplete = true;
+        ++journal->generation;
+    }
+}
+
+void mm_journal_reset(MazeJournal *journal)
+{
+    journal->size = 0;
+    journal->incomplete = false;
+    ++journal->generation;
+}
+
 void mm_clear_squares(MazeMap *mm)
 {
     int r, c;
@@ -37,7 +167,7 @@ void mm_clear_squares(MazeMap *mm)
     {
         for (c = 0; c < WIDTH; ++c)
         {
-            mm->grid[r][c].square = UNKNOWN;
+            SET_SQUARE(mm, r, c, UNKNOWN);
         }
     }
 }
@@ -45,6 +175,7 @@ void mm_clear_squares(MazeMap *mm)
 void mm_clear(MazeMap *mm)
 {
     memset(mm, 0, sizeof(MazeMap));
+    mm->hash = outline_hash(mm);  /* unknown squares and walls have no key */
 }
 
 void mm_initialize(MazeMap *mm, int r, int c, Dir dir)
@@ -57,6 +188,7 @@ void mm_initialize(MazeMap *mm, int r, int c, Dir dir)
     mm->border.left   = c;
     mm->border.bottom = (r + 1)%WIDTH;
     mm->border.right  = (c + 1)%HEIGHT;
+    mm_rehash(mm);
     SET_SQUARE(mm, r, c, PRESENT);
 }
 
@@ -66,19 +198,23 @@ static void push_border(MazeMap *mm, int r, int c, Dir dir)
     {
     case NORTH:
         if (r == mm->border.top)
-            mm->border.top = (mm->border.top + HEIGHT - 1)%HEIGHT;
+            set_border( mm, 0, &mm->border.top,
+                        (mm->border.top + HEIGHT - 1)%HEIGHT );
         break;
     case EAST:
         if ((c + 1)%WIDTH == mm->border.right)
-            mm->border.right = (mm->border.right + 1)%WIDTH;
+            set_border( mm, 1, &mm->border.right,
+                        (mm->border.right + 1)%WIDTH );
         break;
     case SOUTH:
         if ((r + 1)%HEIGHT == mm->border.bottom)
-            mm->border.bottom = (mm->border.bottom + 1)%HEIGHT;
+            set_border( mm, 2, &mm->border.bottom,
+                        (mm->border.bottom + 1)%HEIGHT );
         break;
     case WEST:
         if (c == mm->border.left)
-            mm->border.left = (mm->border.left + WIDTH - 1)%WIDTH;
+            set_border( mm, 3, &mm->border.left,
+                        (mm->border.left + WIDTH - 1)%WIDTH );
         break;
     }
 }
@@ -154,10 +290,12 @@ void mm_move(MazeMap *mm, char move)
     case 'R': rel_dir = RIGHT; break;
     default: assert(0);   /* invalid char */
     }
+    mm->hash ^= mm_pose_hash(mm);
     mm->dir = TURN(mm->dir, rel_dir);
     push_border(mm, mm->loc.r, mm->loc.c, mm->dir);
     mm->loc.r = RDR(mm->loc.r, mm->dir);
     mm->loc.c = CDC(mm->loc.c, mm->dir);
+    mm->hash ^= mm_pose_hash(mm);
     SET_SQUARE(mm, mm->loc.r, mm->loc.c, PRESENT);
 }
 
@@ -276,25 +414,25 @@ void mm_infer(MazeMap *mm)
                 {
                     if (n == UNKNOWN)
                     {
-                        mm->grid[r ][c1].wall_w = PRESENT;
+                        SET_WALL(mm, r , c1, WEST, PRESENT);
                         changed = true;
                     }
                     else
                     if (e == UNKNOWN)
                     {
-                        mm->grid[r1][c1].wall_n = PRESENT;
+                        SET_WALL(mm, r1, c1, NORTH, PRESENT);
                         changed = true;
                     }
                     else
                     if (s == UNKNOWN)
                     {
-                        mm->grid[r1][c1].wall_w = PRESENT;
+                        SET_WALL(mm, r1, c1, WEST, PRESENT);
                         changed = true;
                     }
                     else
                     if (w == UNKNOWN)
                     {
-                        mm->grid[r1][c ].wall_n = PRESENT;
+                        SET_WALL(mm, r1, c , NORTH, PRESENT);
                         changed = true;
                     }
                 }
@@ -311,7 +449,7 @@ void mm_infer(MazeMap *mm)
                 if (mm->grid[r][mm->border.left].wall_w != PRESENT)
                 {
                     assert(mm->grid[r][mm->border.left].wall_w == UNKNOWN);
-                    mm->grid[r][mm->border.left].wall_w = PRESENT;
+                    SET_WALL(mm, r, mm->border.left, WEST, PRESENT);
                     changed = true;
                 }
             }
@@ -327,7 +465,7 @@ void mm_infer(MazeMap *mm)
                 if (mm->grid[mm->border.top][c].wall_n != PRESENT)
                 {
                     assert(mm->grid[mm->border.top][c].wall_n == UNKNOWN);
-                    mm->grid[mm->border.top][c].wall_n = PRESENT;
+                    SET_WALL(mm, mm->border.top, c, NORTH, PRESENT);
                     changed = true;
                 }
             }
@@ -22,11 +22,36 @@ typedef enum RelDir  { FRONT = 0, RIGHT = 1, BACK = 2, LEFT = 3 } RelDir;
 #define CDC(c, dir) ((c + DC(dir) + WIDTH)%WIDTH)
 
 #define SQUARE(mm, r, c)        ((mm)->grid[r][c].square)
-#define SET_SQUARE(mm, r, c, v) ((void)((mm)->grid[r][c].square = v))
+#define SET_SQUARE(mm, r, c, v) ((void)mm_set_square(mm, r, c, v))
 
 #define WALL(mm, r, c, dir)         (mm_get_wall(mm, r, c, dir))
 #define SET_WALL(mm, r, c, dir, v)  ((void)mm_set_wall(mm, r, c, dir, v))
 
+/* Journal entries describe a single change to a map; they pack the kind of
+   change, the new value and the index of the affected cell (which requires
+   WIDTH*HEIGHT <= 1024). Walls are identified as in MazeCell. */
+#define JE_SQUARE   0
+#define JE_WALL_N   1
+#define JE_WALL_W   2
+
+#define JE_MAKE(kind, r, c, v)  ((unsigned short)((kind) << 12 | \
+                                    ((v) + 1) << 10 | ((r)*WIDTH + (c))))
+#define JE_KIND(e)              ((e) >> 12)
+#define JE_VALUE(e)             ((((e) >> 10)&3) - 1)
+#define JE_ROW(e)               (((e)&1023)/WIDTH)
+#define JE_COL(e)               (((e)&1023)%WIDTH)
+
+/* Enough to record every square and wall changing once: */
+#define MAX_JOURNAL 2048
+
+typedef struct MazeJournal
+{
+    int             size;
+    bool            incomplete;     /* changes were not recorded; see below */
+    unsigned        generation;     /* incremented whenever it is reset */
+    unsigned short  entry[MAX_JOURNAL];
+} MazeJournal;
+
 typedef struct MazeCell
 {
     signed char square : 2, wall_w : 2, wall_n : 2;
@@ -42,12 +67,17 @@ typedef struct Rect
     int top, right, bottom, left;
 } Rect;
 
+/* Zobrist hash of a map's contents (64 bits where longs are): */
+typedef unsigned long MazeHash;
+
 typedef struct MazeMap
 {
     MazeCell    grid[WIDTH][HEIGHT];
     Point       loc;
     Dir         dir;
     Rect        border;
+    MazeHash    hash;       /* hash of the fields above; see mm_rehash() */
+    MazeJournal *journal;
 } MazeMap;
 
 extern int dir_dr[4], dir_dc[4];
@@ -61,8 +91,38 @@ extern void mm_move(MazeMap *mm, char move);
 extern void mm_turn(MazeMap *mm, const char *move);
 extern int  mm_get_wall(const MazeMap *mm, int r, int c, Dir dir);
 extern void mm_set_wall(MazeMap *mm, int r, int c, Dir dir, int val);
+extern void mm_set_square(MazeMap *mm, int r, int c, int val);
 extern int  mm_count_squares(const MazeMap *mm);
 extern int  mm_width(const MazeMap *mm);
 extern int  mm_height(const MazeMap *mm);
 
+/* Attaches a journal to a map (or detaches it, if `journal' is NULL). While
+   attached, every change to a square or wall made through SET_SQUARE or
+   SET_WALL (including those by mm_look, mm_move and mm_infer) is appended to
+   the journal. The journal is marked incomplete when it is attached or when
+   it overflows; its user should then examine the entire map instead.
+   Resetting a journal increments its generation, so readers that keep track
+   of how much of it they have processed can tell that it was emptied.
+   Note that mm_clear() (and functions that call it) detaches the journal. */
+extern void mm_set_journal(MazeMap *mm, MazeJournal *journal);
+extern void mm_journal_reset(MazeJournal *journal);
+
+/* A map's hash is the exclusive-or of a pseudo-random key for the value of
+   every known square and wall, for its location and direction, and for each
+   of its borders. SET_SQUARE, SET_WALL, mm_look, mm_move and mm_infer keep
+   it up to date incrementally; after changing the map's fields directly,
+   mm_rehash() must be called to recompute it from scratch (which returns the
+   new hash). mm_pose_hash() returns the part of the hash that is due to the
+   location and direction, so that hash ^ mm_pose_hash() identifies what is
+   known about the maze, regardless of where in it the player is. */
+extern MazeHash mm_rehash(MazeMap *mm);
+extern MazeHash mm_pose_hash(const MazeMap *mm);
+
+/* Return the keys hashed for a square or wall (`kind' as in journal entries)
+   with value `val', and for a border (`side' numbered as in Rect) at row or
+   column `val'. The template kernels in MazeGrid.hpp use these to keep the
+   hash up to date like the functions above. */
+extern MazeHash mm_cell_key(int kind, int r, int c, int val);
+extern MazeHash mm_border_key(int side, int val);
+
 #endif /* ndef MAZE_MAP_H */
@@ -0,0 +1,197 @@
+#define _POSIX_C_SOURCE 200112L
+#include "MazePack.h"
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/* File layout (all integers little-endian):
+
+   Header:      "AMZP", version (1 byte), 3 reserved bytes,
+                number of mazes (4 bytes).
+
+   Index:       offset of each maze's record from the start of the file
+                (4 bytes each).
+
+   Records:     north walls, then west walls: one bit per square (1 if the
+                wall is present), row-major, least-significant bit first,
+                each plane padded to a whole number of bytes. */
+
+#define HEADER_SIZE 12
+#define PLANE_SIZE  ((HEIGHT*WIDTH + 7)/8)
+#define RECORD_SIZE (2*PLANE_SIZE)
+
+static void put32(unsigned char *p, unsigned long v)
+{
+    p[0] = v&255;
+    p[1] = (v >> 8)&255;
+    p[2] = (v >> 16)&255;
+    p[3] = (v >> 24)&255;
+}
+
+static unsigned long get32(const unsigned char *p)
+{
+    return p[0] | (p[1] << 8) | ((unsigned long)p[2] << 16) |
+           ((unsigned long)p[3] << 24);
+}
+
+bool mp_open(MazePack *mp, const char *path)
+{
+    struct stat st;
+    void *data;
+    int fd;
+
+    memset(mp, 0, sizeof(*mp));
+    if ((fd = open(path, O_RDONLY)) == -1) return false;
+    if (fstat(fd, &st) != 0 || st.st_size < HEADER_SIZE ||
+        (data = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0))
+            == MAP_FAILED)
+    {
+        close(fd);
+        return false;
+    }
+    close(fd);
+
+    mp->data  = data;
+    mp->size  = st.st_size;
+    mp->count = (int)get32(mp->data + 8);
+    if (memcmp(mp->data, "AMZP", 4) != 0 || mp->data[4] != 1 ||
+        mp->count < 0 ||
+        (mp->size - HEADER_SIZE)/4 < (unsigned long)mp->count)
+    {
+        mp_close(mp);
+        return false;
+    }
+    return true;
+}
+
+void mp_close(MazePack *mp)
+{
+    if (mp->data != NULL) munmap((void*)mp->data, mp->size);
+    memset(mp, 0, sizeof(*mp));
+}
+
+bool mp_get(const MazePack *mp, int index, MazeMap *mm)
+{
+    const unsigned char *north, *west;
+    unsigned long offset;
+    int r, c, i;
+
+    if (index < 0 || index >= mp->count) return false;
+    offset = get32(mp->data + HEADER_SIZE + 4*index);
+    if (offset > mp->size || mp->size - offset < RECORD_SIZE) return false;
+    north = mp->data + offset;
+    west  = north + PLANE_SIZE;
+
+    mm_clear(mm);
+    for (r = 0, i = 0; r < HEIGHT; ++r)
+    {
+        for (c = 0; c < WIDTH; ++c, ++i)
+        {
+            mm->grid[r][c].square = PRESENT;
+            mm->grid[r][c].wall_n = (north[i/8] >> i%8)&1 ? PRESENT : ABSENT;
+            mm->grid[r][c].wall_w = (west[i/8] >> i%8)&1 ? PRESENT : ABSENT;
+        }
+    }
+    mm_rehash(mm);
+    return true;
+}
+
+bool mp_load(MazeMap *mm, const char *ref)
+{
+    const char *colon = strrchr(ref, ':');
+    char *path;
+    MazePack mp;
+    bool ok;
+
+    if (colon == NULL || colon[1] == '\0' ||
+        strspn(colon + 1, "0123456789") != strlen(colon + 1))
+        return false;
+    if ((path = malloc(colon - ref + 1)) == NULL) return false;
+    memcpy(path, ref, colon - ref);
+    path[colon - ref] = '\0';
+    ok = mp_open(&mp, path);
+    free(path);
+    if (!ok) return false;
+    ok = mp_get(&mp, atoi(colon + 1), mm);
+    mp_close(&mp);
+    return ok;
+}
+
+void mp_create(MazePackWriter *mpw)
+{
+    memset(mpw, 0, sizeof(*mpw));
+}
+
+bool mp_add(MazePackWriter *mpw, const MazeMap *mm)
+{
+    unsigned char *north, *west;
+    int r, c, i;
+
+    if (mm->border.top != 0 || mm->border.left != 0 ||
+        mm->border.bottom != 0 || mm->border.right != 0) return false;
+    for (r = 0; r < HEIGHT; ++r)
+    {
+        for (c = 0; c < WIDTH; ++c)
+        {
+            if (mm->grid[r][c].wall_n == UNKNOWN ||
+                mm->grid[r][c].wall_w == UNKNOWN) return false;
+        }
+    }
+
+    if (mpw->count == mpw->capacity)
+    {
+        int capacity = mpw->capacity ? 2*mpw->capacity : 64;
+        unsigned char *data = realloc(mpw->data, RECORD_SIZE*capacity);
+        if (data == NULL) return false;
+        mpw->data     = data;
+        mpw->capacity = capacity;
+    }
+    north = mpw->data + RECORD_SIZE*mpw->count++;
+    west  = north + PLANE_SIZE;
+    memset(north, 0, RECORD_SIZE);
+    for (r = 0, i = 0; r < HEIGHT; ++r)
+    {
+        for (c = 0; c < WIDTH; ++c, ++i)
+        {
+            if (mm->grid[r][c].wall_n == PRESENT) north[i/8] |= 1 << i%8;
+            if (mm->grid[r][c].wall_w == PRESENT) west[i/8]  |= 1 << i%8;
+        }
+    }
+    return true;
+}
+
+bool mp_save(const MazePackWriter *mpw, const char *path)
+{
+    const unsigned long first = HEADER_SIZE + 4ul*mpw->count;
+    unsigned char header[HEADER_SIZE], entry[4];
+    FILE *fp;
+    bool ok;
+    int n;
+
+    memset(header, 0, sizeof(header));
+    memcpy(header, "AMZP", 4);
+    header[4] = 1;
+    put32(header + 8, mpw->count);
+    if ((fp = fopen(path, "wb")) == NULL) return false;
+    ok = fwrite(header, 1, HEADER_SIZE, fp) == HEADER_SIZE;
+    for (n = 0; ok && n < mpw->count; ++n)
+    {
+        put32(entry, first + (unsigned long)RECORD_SIZE*n);
+        ok = fwrite(entry, 1, 4, fp) == 4;
+    }
+    if (ok && mpw->count > 0)
+    {
+        ok = fwrite(mpw->data, RECORD_SIZE, mpw->count, fp) ==
+             (size_t)mpw->count;
+    }
+    return fclose(fp) == 0 && ok;
+}
+
+void mp_free(MazePackWriter *mpw)
+{
+    free(mpw->data);
+    memset(mpw, 0, sizeof(*mpw));
+}
@@ -0,0 +1,52 @@
+#ifndef MAZE_PACK_H_INCLUDED
+#define MAZE_PACK_H_INCLUDED
+
+#include "MazeMap.h"
+
+/* Maze packs.
+
+   A maze pack holds any number of complete mazes (of HEIGHT by WIDTH squares,
+   with all walls known), each stored as two bit planes: one for the north
+   walls and one for the west walls of all squares, in row-major order. A
+   header with the number of mazes is followed by an index of the offsets of
+   their records, so mp_open() only maps the file into memory and checks the
+   header, and mp_get() decodes a single maze without any parsing. See
+   MazePack.c for the exact file layout.
+
+   Mazes in a pack are referred to as <pack file>:<index>, with indices
+   counting from 0; mp_load() accepts this form. */
+
+typedef struct MazePack
+{
+    const unsigned char *data;
+    unsigned long       size;
+    int                 count;          /* number of mazes */
+} MazePack;
+
+typedef struct MazePackWriter
+{
+    unsigned char       *data;          /* records */
+    int                 count, capacity;
+} MazePackWriter;
+
+/* Reading: */
+extern bool mp_open(MazePack *mp, const char *path);
+extern void mp_close(MazePack *mp);
+
+/* Stores maze `index' in `mm' (with all squares present, and the player at
+   (0,0) facing north). Returns false if the index is out of range or the
+   record is damaged. */
+extern bool mp_get(const MazePack *mp, int index, MazeMap *mm);
+
+/* Loads a maze from a reference of the form <pack file>:<index>. Returns
+   false if `ref' is not of this form, or the maze couldn't be loaded. */
+extern bool mp_load(MazeMap *mm, const char *ref);
+
+/* Writing: mp_add() returns false if the maze is not complete (its size is
+   not HEIGHT by WIDTH, or some walls are unknown) or memory ran out. */
+extern void mp_create(MazePackWriter *mpw);
+extern bool mp_add(MazePackWriter *mpw, const MazeMap *mm);
+extern bool mp_save(const MazePackWriter *mpw, const char *path);
+extern void mp_free(MazePackWriter *mpw);
+
+#endif /* ndef MAZE_PACK_H_INCLUDED */
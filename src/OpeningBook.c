@@ -0,0 +1,155 @@
+#define _POSIX_C_SOURCE 200112L
+#include "OpeningBook.h"
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/* File layout (all integers little-endian):
+
+   Header:      "AMZB", version (1 byte), 3 reserved bytes,
+                number of slots (4 bytes, a power of two),
+                number of entries (4 bytes).
+
+   Slots:       key (8 bytes), turn string (zero-padded to 56 bytes; empty
+                if the slot is unused).
+
+   A key is stored in slot (key mod number of slots), or in the first unused
+   slot after it (wrapping around). */
+
+#define HEADER_SIZE 16
+
+static void put32(unsigned char *p, unsigned long v)
+{
+    p[0] = v&255;
+    p[1] = (v >> 8)&255;
+    p[2] = (v >> 16)&255;
+    p[3] = (v >> 24)&255;
+}
+
+static unsigned long get32(const unsigned char *p)
+{
+    return p[0] | (p[1] << 8) | ((unsigned long)p[2] << 16) |
+           ((unsigned long)p[3] << 24);
+}
+
+static void put_key(unsigned char *p, MazeHash key)
+{
+    put32(p, key&0xfffffffful);
+    put32(p + 4, (key >> 16 >> 16)&0xfffffffful);
+}
+
+bool book_open(OpeningBook *book, const char *path)
+{
+    struct stat st;
+    void *data;
+    int fd;
+
+    memset(book, 0, sizeof(*book));
+    if ((fd = open(path, O_RDONLY)) == -1) return false;
+    if (fstat(fd, &st) != 0 || st.st_size < HEADER_SIZE ||
+        (data = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0))
+            == MAP_FAILED)
+    {
+        close(fd);
+        return false;
+    }
+    close(fd);
+
+    book->data      = data;
+    book->size      = st.st_size;
+    book->num_slots = get32(book->data + 8);
+    book->count     = get32(book->data + 12);
+    if (memcmp(book->data, "AMZB", 4) != 0 || book->data[4] != 1 ||
+        book->num_slots == 0 || (book->num_slots&(book->num_slots - 1)) ||
+        book->size != HEADER_SIZE + BOOK_SLOT_SIZE*book->num_slots)
+    {
+        book_close(book);
+        return false;
+    }
+    return true;
+}
+
+void book_close(OpeningBook *book)
+{
+    if (book->data != NULL) munmap((void*)book->data, book->size);
+    memset(book, 0, sizeof(*book));
+}
+
+const char *book_lookup(const OpeningBook *book, MazeHash key)
+{
+    const unsigned long mask = book->num_slots - 1;
+    unsigned char k[8];
+    unsigned long i, n;
+
+    put_key(k, key);
+    for (n = 0, i = key&mask; n < book->num_slots; ++n, i = (i + 1)&mask)
+    {
+        const unsigned char *slot = book->data + HEADER_SIZE +
+                                    BOOK_SLOT_SIZE*i;
+        if (slot[8] == '\0') break;
+        if (memcmp(slot, k, 8) == 0)
+        {
+            /* The file is not trusted to be zero-terminated: */
+            if (slot[BOOK_SLOT_SIZE - 1] != '\0') break;
+            return (const char*)slot + 8;
+        }
+    }
+    return NULL;
+}
+
+bool book_create(BookWriter *bw, unsigned long num_slots)
+{
+    unsigned long n = 1;
+
+    while (n < num_slots) n *= 2;
+    memset(bw, 0, sizeof(*bw));
+    bw->data = calloc(HEADER_SIZE + BOOK_SLOT_SIZE*n, 1);
+    if (bw->data == NULL) return false;
+    bw->num_slots = n;
+    return true;
+}
+
+bool book_add(BookWriter *bw, MazeHash key, const char *turn)
+{
+    const unsigned long mask = bw->num_slots - 1;
+    unsigned char k[8], *slot;
+    unsigned long i;
+
+    if (strlen(turn) > BOOK_MAX_TURN_LEN || *turn == '\0') return false;
+    put_key(k, key);
+    for (i = key&mask; ; i = (i + 1)&mask)
+    {
+        slot = bw->data + HEADER_SIZE + BOOK_SLOT_SIZE*i;
+        if (slot[8] == '\0') break;
+        if (memcmp(slot, k, 8) == 0) return true;
+    }
+    if (4*(bw->count + 1) > 3*bw->num_slots) return false;
+    memcpy(slot, k, 8);
+    strcpy((char*)slot + 8, turn);
+    ++bw->count;
+    return true;
+}
+
+bool book_save(const BookWriter *bw, const char *path)
+{
+    const unsigned long size = HEADER_SIZE + BOOK_SLOT_SIZE*bw->num_slots;
+    FILE *fp;
+    bool ok;
+
+    memcpy(bw->data, "AMZB", 4);
+    bw->data[4] = 1;
+    put32(bw->data + 8, bw->num_slots);
+    put32(bw->data + 12, bw->count);
+    if ((fp = fopen(path, "wb")) == NULL) return false;
+    ok = fwrite(bw->data, 1, size, fp) == size;
+    return fclose(fp) == 0 && ok;
+}
+
+void book_free(BookWriter *bw)
+{
+    free(bw->data);
+    memset(bw, 0, sizeof(*bw));
+}
@@ -0,0 +1,55 @@
+#ifndef OPENING_BOOK_H_INCLUDED
+#define OPENING_BOOK_H_INCLUDED
+
+#include "MazeMap.h"
+
+/* Opening books.
+
+   Every game starts from the same knowledge state (mm_initialize(&mm, 0, 0,
+   NORTH)) plus four lines of sight, so the states of the first few turns are
+   few and recur from game to game (and from maze to maze). An opening book
+   maps the hash of such a state (MazeMap.hash, which includes the player's
+   location and direction) to the turn to play.
+
+   The book is an open-addressing hash table with linear probing and fixed
+   size slots, stored exactly as it is searched, so book_open() only maps the
+   file into memory and checks its header; lookups return pointers into the
+   mapped file. See OpeningBook.c for the exact file layout.
+
+   Hashes are 64 bits where longs are, so books should be built and used on
+   such platforms (elsewhere, lookups simply never match). */
+
+#define BOOK_SLOT_SIZE      64
+#define BOOK_MAX_TURN_LEN   (BOOK_SLOT_SIZE - 9)
+
+typedef struct OpeningBook
+{
+    const unsigned char *data;
+    unsigned long       size;
+    unsigned long       num_slots;      /* a power of two */
+    unsigned long       count;          /* number of entries */
+} OpeningBook;
+
+typedef struct BookWriter
+{
+    unsigned char       *data;          /* file contents */
+    unsigned long       num_slots, count;
+} BookWriter;
+
+/* Reading: */
+extern bool book_open(OpeningBook *book, const char *path);
+extern void book_close(OpeningBook *book);
+
+/* Returns the turn for the state with the given hash, or NULL if there is
+   none. The result points into the mapped file. */
+extern const char *book_lookup(const OpeningBook *book, MazeHash key);
+
+/* Writing: `num_slots' is rounded up to a power of two. book_add() returns
+   false if the turn is too long or the table is three quarters full; if the
+   key is present already, the existing turn is kept. */
+extern bool book_create(BookWriter *bw, unsigned long num_slots);
+extern bool book_add(BookWriter *bw, MazeHash key, const char *turn);
+extern bool book_save(const BookWriter *bw, const char *path);
+extern void book_free(BookWriter *bw);
+
+#endif /* ndef OPENING_BOOK_H_INCLUDED */
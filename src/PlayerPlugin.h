@@ -0,0 +1,44 @@
+#ifndef PLAYER_PLUGIN_H_INCLUDED
+#define PLAYER_PLUGIN_H_INCLUDED
+
+/* In-process player interface.
+
+   Instead of an executable, the arbiter can be given the path to a shared
+   library (any player command whose first word ends in `.so'). The library
+   must export a function named `player_plugin' (see PLAYER_PLUGIN_ENTRY)
+   returning a pointer to a PlayerPlugin structure, whose abi_version field
+   must equal PLAYER_PLUGIN_ABI_VERSION.
+
+   The calls correspond to the text protocol used with external players:
+
+    init:       called once before the game starts; `first' is nonzero for
+                the player that would receive the "Start" line. The returned
+                pointer is passed to the other functions.
+    observe:    receives the four lines of sight (front, right, back and left)
+                and the squared distance to the opponent (-1 in a one-player
+                game) at the start of each turn.
+    move:       returns the turn to be performed, as a string of F, T, L and R
+                characters, which must remain valid until the next call.
+    quit:       called once when the game is over, instead of "Quit".
+
+   The arbiter only calls these from a single thread.
+*/
+
+#define PLAYER_PLUGIN_ABI_VERSION   1
+#define PLAYER_PLUGIN_ENTRY         "player_plugin"
+
+typedef struct PlayerPlugin
+{
+    int         abi_version;
+    void        *(*init)(int first);
+    void        (*observe)(void *player, const char *const sight[4],
+                           int distsq);
+    const char  *(*move)(void *player);
+    void        (*quit)(void *player);
+} PlayerPlugin;
+
+typedef const PlayerPlugin *(*PlayerPluginEntry)(void);
+
+extern const PlayerPlugin *player_plugin(void);
+
+#endif /* ndef PLAYER_PLUGIN_H_INCLUDED */
@@ -0,0 +1,270 @@
+#define _POSIX_C_SOURCE 200112L
+#include "Pursuit.h"
+#include <string.h>
+#include <time.h>
+
+#define DIST(ps, s, t) ((ps)->md->dist[(ps)->frame[s]][(ps)->frame[t]])
+
+/* Tests whether table entry e holds the value of a state with hashes k and c,
+   searched at least d deep: */
+#define HIT(e, k, c, d) \
+    ((e)->depth >= (d) && (e)->key == (k) && (e)->check == (c))
+
+/* Returns the current value of a monotonic clock in microseconds. */
+static long time_us()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return 1000000L*ts.tv_sec + ts.tv_nsec/1000;
+}
+
+void ps_reset(Pursuit *ps, long time_limit)
+{
+    ps->time_limit = time_limit;
+    ps->diameter   = -1;
+    memset(ps->table, 0, sizeof(ps->table));
+}
+
+static void hash_state( int s, const MazeRow set[HEIGHT],
+                        unsigned long *key, unsigned long *check )
+{
+    unsigned long h1 = 2166136261ul ^ (unsigned long)s, h2 = s + 1ul;
+    int r;
+
+    for (r = 0; r < HEIGHT; ++r)
+    {
+        h1 = (h1 ^ set[r])*16777619ul;
+        h2 = h2*31ul + set[r];
+    }
+    *key   = h1;
+    *check = h2;
+}
+
+/* Collects (at most `max') possible squares, nearest to square s first. */
+static int nearest( const Pursuit *ps, int s, const MazeRow set[HEIGHT],
+                    int cand[], int max )
+{
+    MazeRow row;
+    int r, i, j, n = 0;
+
+    for (r = 0; r < HEIGHT; ++r)
+    {
+        for (row = set[r]; row != 0; row &= row - 1)
+        {
+            i = r*WIDTH + mb_lowest_bit(row);
+            if (n < max)
+                j = n++;
+            else
+            if (DIST(ps, s, cand[max - 1]) > DIST(ps, s, i))
+                j = max - 1;
+            else
+                continue;
+            for ( ; j > 0 && DIST(ps, s, cand[j - 1]) > DIST(ps, s, i); --j)
+                cand[j] = cand[j - 1];
+            cand[j] = i;
+        }
+    }
+    return n;
+}
+
+/* Estimates the cost of capturing the opponent, beyond the search horizon. */
+static double estimate(const Pursuit *ps, int s, const MazeRow set[HEIGHT],
+                       int n)
+{
+    int t, turns = 1;
+
+    nearest(ps, s, set, &t, 1);
+    while (n > 1)
+    {
+        n /= 2;
+        ++turns;
+    }
+    return DIST(ps, s, t) + (double)turns*PS_TURN_COST;
+}
+
+/* Returns the table entry for state (s, set), which holds a usable value if
+   HIT() holds for it. */
+static PursuitEntry *probe( Pursuit *ps, int s, const MazeRow set[HEIGHT],
+                            unsigned long *key, unsigned long *check )
+{
+    hash_state(s, set, key, check);
+    return &ps->table[*key%PS_TABLE_SIZE];
+}
+
+static void store( PursuitEntry *e, unsigned long key, unsigned long check,
+                   int depth, double value )
+{
+    if (depth < e->depth) return;
+    e->key   = key;
+    e->check = check;
+    e->depth = depth;
+    e->value = value;
+}
+
+static double search( Pursuit *ps, int s, const MazeRow set[HEIGHT], int n,
+                      int depth );
+
+/* Computes the expected cost of capturing the opponent from square t after
+   it has moved to one of the squares in `rest', by splitting them by the
+   distance observed next and searching each part `depth' - 1 deep. */
+static double expect( Pursuit *ps, int t, const MazeRow rest[HEIGHT],
+                      int depth )
+{
+    MazeRow child[HEIGHT], row;
+    int count[BT_MAX_DISTSQ + 1];
+    short dists[HEIGHT*WIDTH];
+    const int tr = t/WIDTH, tc = t%WIDTH;
+    int r, c, d, i, num_dists = 0, total = 0;
+    unsigned long key, check;
+    PursuitEntry *e;
+    double sum = 0;
+
+    /* These states are stored apart from those passed to search(): */
+    e = probe(ps, HEIGHT*WIDTH + t, rest, &key, &check);
+    if (HIT(e, key, check, depth)) return e->value;
+
+    memset(count, 0, sizeof(count));
+    for (r = 0; r < HEIGHT; ++r)
+    {
+        for (row = rest[r]; row != 0; row &= row - 1)
+        {
+            c = mb_lowest_bit(row);
+            d = (r - tr)*(r - tr) + (c - tc)*(c - tc);
+            if (count[d]++ == 0) dists[num_dists++] = (short)d;
+            ++total;
+        }
+    }
+    for (i = 0; i < num_dists; ++i)
+    {
+        bt_ring(ps->bt, tr, tc, dists[i], child);
+        for (r = 0; r < HEIGHT; ++r) child[r] &= rest[r];
+        sum += count[dists[i]]*
+               search(ps, t, child, count[dists[i]], depth - 1);
+        if (ps->aborted) return 0;
+    }
+    store(e, key, check, depth, sum/total);
+    return sum/total;
+}
+
+/* Computes the expected cost of moving from square s to t, when the opponent
+   is on one of the `n' squares in `set' (which includes t). */
+static double evaluate( Pursuit *ps, int s, const MazeRow set[HEIGHT], int n,
+                        int t, int depth )
+{
+    MazeRow rest[HEIGHT];
+    int r;
+
+    if (n == 1) return DIST(ps, s, t) + PS_TURN_COST;
+
+    /* The opponent was elsewhere, and moves (anywhere at all, if it can
+       cross the maze in a single turn): */
+    if (ps->bt->max_moves >= ps->diameter)
+    {
+        for (r = 0; r < HEIGHT; ++r) rest[r] = MB_ROW_MASK;
+    }
+    else
+    {
+        memcpy(rest, set, sizeof(rest));
+        rest[t/WIDTH] &= ~((MazeRow)1 << t%WIDTH);
+        bt_expand(ps->bt, rest, ps->bt->max_moves);
+    }
+    return DIST(ps, s, t) + PS_TURN_COST +
+           (double)(n - 1)/n*expect(ps, t, rest, depth);
+}
+
+/* Computes the expected cost of capturing the opponent from square s, when
+   the opponent is on one of the `n' squares in `set'. */
+static double search( Pursuit *ps, int s, const MazeRow set[HEIGHT], int n,
+                      int depth )
+{
+    int cand[PS_BRANCH];
+    int i, num_cand;
+    unsigned long key, check;
+    PursuitEntry *e;
+    double value, best = -1;
+
+    if (depth == 0) return estimate(ps, s, set, n);
+
+    if ((++ps->nodes&63) == 0 && time_us() > ps->deadline) ps->aborted = true;
+    if (ps->aborted) return 0;
+
+    e = probe(ps, s, set, &key, &check);
+    if (HIT(e, key, check, depth)) return e->value;
+
+    num_cand = nearest(ps, s, set, cand, PS_BRANCH);
+    for (i = 0; i < num_cand; ++i)
+    {
+        value = evaluate(ps, s, set, n, cand[i], depth);
+        if (ps->aborted) return 0;
+        if (best < 0 || value < best) best = value;
+    }
+    store(e, key, check, depth, best);
+    return best;
+}
+
+Point ps_search( Pursuit *ps, const MazeMap *mm,
+                 const MazeDistance *md, const Belief *bt )
+{
+    int cand[HEIGHT*WIDTH];
+    double value[HEIGHT*WIDTH];
+    int r, c, i, j, s, n, num_cand, depth, best;
+    Point res;
+
+    ps->md       = md;
+    ps->bt       = bt;
+    ps->deadline = time_us() + 1000*ps->time_limit;
+    ps->aborted  = false;
+    ps->nodes    = 0;
+    for (r = 0; r < HEIGHT; ++r)
+    {
+        for (c = 0; c < WIDTH; ++c)
+        {
+            ps->frame[r*WIDTH + c] =
+                (r + mm->border.top)%HEIGHT*WIDTH +
+                (c + mm->border.left)%WIDTH;
+        }
+    }
+    if (ps->diameter < 0)
+    {
+        for (i = 0; i < HEIGHT*WIDTH; ++i)
+        {
+            for (j = 0; j < HEIGHT*WIDTH; ++j)
+            {
+                if (md->dist[i][j] > ps->diameter)
+                    ps->diameter = md->dist[i][j];
+            }
+        }
+    }
+    s = (mm->loc.r - mm->border.top + HEIGHT)%HEIGHT*WIDTH +
+        (mm->loc.c - mm->border.left + WIDTH)%WIDTH;
+
+    n = bt_count(bt);
+    num_cand = nearest(ps, s, bt->pos, cand, HEIGHT*WIDTH);
+    best = cand[0];
+    for (depth = 1; depth <= PS_MAX_DEPTH && num_cand > 1; ++depth)
+    {
+        for (i = 0; i < num_cand && !ps->aborted; ++i)
+            value[i] = evaluate(ps, s, bt->pos, n, cand[i], depth);
+        if (ps->aborted) break;
+
+        /* Order the candidates by value for the next iteration: */
+        for (i = 1; i < num_cand; ++i)
+        {
+            const int t = cand[i];
+            const double v = value[i];
+            for (j = i; j > 0 && value[j - 1] > v; --j)
+            {
+                cand[j]  = cand[j - 1];
+                value[j] = value[j - 1];
+            }
+            cand[j]  = t;
+            value[j] = v;
+        }
+        best = cand[0];
+        if (num_cand > PS_BRANCH) num_cand = PS_BRANCH;
+    }
+
+    res.r = ps->frame[best]/WIDTH;
+    res.c = ps->frame[best]%WIDTH;
+    return res;
+}
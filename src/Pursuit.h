@@ -0,0 +1,75 @@
+#ifndef PURSUIT_H_INCLUDED
+#define PURSUIT_H_INCLUDED
+
+#include "Belief.h"
+#include "MazeDist.h"
+
+/* Endgame pursuit search.
+
+   Once the map is complete it never changes again, and the game is won by
+   ending a turn on the opponent's square. ps_search() picks the square to
+   move to by a depth-limited expectimax search over states consisting of the
+   player's square and the set of squares the opponent may occupy (kept as in
+   Belief.h, in maze coordinates):
+
+    - Moving to square t costs its distance plus PS_TURN_COST (a turn is
+      weighed as much as a capture is worth, so that the number of turns is
+      minimized first and the number of moves second).
+    - The opponent is assumed to be on any of the possible squares with equal
+      probability. If it is not on t, it moves up to the belief's `max_moves'
+      moves, and the next observation of the squared distance from t splits
+      the expanded set into rings, each of which is searched further.
+    - At the search horizon, the remaining cost is estimated from the distance
+      to the nearest possible square and the logarithm of the number of
+      possible squares (each observation typically halves the set or better).
+
+   Only the PS_BRANCH nearest possible squares are considered as moves below
+   the root. The search deepens iteratively until PS_MAX_DEPTH or until the
+   time limit expires; the root moves are reordered (and reduced to the
+   PS_BRANCH best) after each iteration. Values are stored in a transposition
+   table, which stays valid for the rest of the game, since neither the map
+   nor the belief's parameters change. Besides the states above, it holds the
+   expected costs after the opponent's move, which only depend on the
+   player's square and the expanded set (the whole maze, if the opponent can
+   cross it in one turn, so these are shared by most of the search).
+
+   Distances are taken from a MazeDistance table, which must reflect the
+   complete map. The opponent is not assumed to try to capture the player. */
+
+#define PS_TURN_COST    100
+#define PS_BRANCH       8
+#define PS_MAX_DEPTH    6
+#define PS_TABLE_SIZE   65536   /* transposition table entries */
+
+typedef struct PursuitEntry
+{
+    unsigned long   key, check;     /* hashes of the state */
+    int             depth;          /* search depth, or 0 if unused */
+    double          value;          /* expected cost */
+} PursuitEntry;
+
+typedef struct Pursuit
+{
+    long            time_limit;     /* milliseconds (wall-clock time) */
+
+    /* Search state: */
+    const MazeDistance  *md;
+    const Belief        *bt;
+    int             frame[HEIGHT*WIDTH];    /* maze to map square index */
+    long            deadline;       /* monotonic clock, in microseconds */
+    bool            aborted;
+    long            nodes;
+    int             diameter;       /* longest distance, or -1 if unknown */
+
+    PursuitEntry    table[PS_TABLE_SIZE];
+} Pursuit;
+
+/* Clears the transposition table; must be called before each game. */
+extern void ps_reset(Pursuit *ps, long time_limit);
+
+/* Returns the square (in map coordinates) to move to on the given complete
+   map, with a valid, non-empty belief of the opponent's location. */
+extern Point ps_search( Pursuit *ps, const MazeMap *mm,
+                        const MazeDistance *md, const Belief *bt );
+
+#endif /* ndef PURSUIT_H_INCLUDED */
@@ -0,0 +1,375 @@
+#define _POSIX_C_SOURCE 200112L
+#include "Replay.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/* File layout (all integers little-endian):
+
+   Header:      "AMZR", version (1 byte), number of players (1 byte),
+                keyframe interval (2 bytes), 8 reserved bytes.
+
+   Records:     record size in bytes (4)
+                kind (1: keyframe, 0: delta), player, turn number + 1 (2)
+                row, column, direction, border top/right/bottom/left, 0
+                moves, squares discovered, discovered first, captures, total
+                                                            (4 bytes each)
+                turn length (2), comments length (2), number of changes (2), 0
+                turn string, comments
+                keyframes: one byte per cell (row-major) holding square,
+                           north wall and west wall (value + 1) in bits 0-1,
+                           2-3 and 4-5 respectively;
+                deltas:    journal entries (2 bytes each; see MazeMap.h)
+
+   Index:       for each record: its file offset (4) and the number of the
+                player's most recent keyframe record (4).
+
+   Trailer:     "AMZI", index offset (4), number of records (4), 0 (4)
+
+   If the trailer is missing (because the arbiter didn't finish writing the
+   log) the index is rebuilt when the log is opened.
+*/
+
+#define HEADER_SIZE         16
+#define RECORD_HEADER_SIZE  44
+#define INDEX_ENTRY_SIZE     8
+#define TRAILER_SIZE        16
+
+static void put16(unsigned char *p, unsigned v)
+{
+    p[0] = v&255;
+    p[1] = (v >> 8)&255;
+}
+
+static void put32(unsigned char *p, unsigned long v)
+{
+    put16(p, v&65535);
+    put16(p + 2, (v >> 16)&65535);
+}
+
+static unsigned get16(const unsigned char *p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+static unsigned long get32(const unsigned char *p)
+{
+    return get16(p) | ((unsigned long)get16(p + 2) << 16);
+}
+
+static long get32s(const unsigned char *p)
+{
+    unsigned long v = get32(p);
+    return (v & 0x80000000UL) ? -(long)(0xFFFFFFFFUL - v) - 1 : (long)v;
+}
+
+bool replay_create( ReplayWriter *rw, const char *path,
+                    int num_players, int interval )
+{
+    unsigned char header[HEADER_SIZE];
+
+    memset(rw, 0, sizeof(*rw));
+    if ((rw->fp = fopen(path, "wb")) == NULL) return false;
+    rw->num_players = num_players;
+    rw->interval    = interval;
+
+    memset(header, 0, sizeof(header));
+    memcpy(header, "AMZR", 4);
+    header[4] = 1;
+    header[5] = num_players;
+    put16(header + 6, interval);
+    fwrite(header, 1, sizeof(header), rw->fp);
+    rw->offset = sizeof(header);
+    return true;
+}
+
+void replay_write( ReplayWriter *rw, int player, int turn_no,
+                   const MazeMap *mm, const ReplayScore *score,
+                   const char *turn, const char *comments )
+{
+    unsigned char header[RECORD_HEADER_SIZE], cells[WIDTH*HEIGHT], *p;
+    const MazeJournal *journal = mm->journal;
+    const int turn_len = strlen(turn), comments_len = strlen(comments);
+    bool keyframe;
+    int r, c, i;
+    unsigned long size;
+
+    keyframe = journal == NULL || journal->incomplete ||
+               rw->since_keyframe[player] == 0 ||
+               rw->since_keyframe[player] >= rw->interval;
+
+    size = RECORD_HEADER_SIZE + turn_len + comments_len +
+           (keyframe ? WIDTH*HEIGHT : 2*journal->size);
+
+    p = header;
+    put32(p, size);                     p += 4;
+    *p++ = keyframe;
+    *p++ = player;
+    put16(p, turn_no + 1);              p += 2;
+    *p++ = mm->loc.r;
+    *p++ = mm->loc.c;
+    *p++ = mm->dir;
+    *p++ = mm->border.top;
+    *p++ = mm->border.right;
+    *p++ = mm->border.bottom;
+    *p++ = mm->border.left;
+    *p++ = 0;
+    put32(p, score->moves);             p += 4;
+    put32(p, score->sq_disc);           p += 4;
+    put32(p, score->sq_disc_first);     p += 4;
+    put32(p, score->captures);          p += 4;
+    put32(p, score->total);             p += 4;
+    put16(p, turn_len);                 p += 2;
+    put16(p, comments_len);             p += 2;
+    put16(p, keyframe ? 0 : journal->size);
+    p += 2;
+    put16(p, 0);                        p += 2;
+    assert(p == header + RECORD_HEADER_SIZE);
+
+    fwrite(header, 1, sizeof(header), rw->fp);
+    fwrite(turn, 1, turn_len, rw->fp);
+    fwrite(comments, 1, comments_len, rw->fp);
+    if (keyframe)
+    {
+        for (r = 0; r < HEIGHT; ++r)
+        {
+            for (c = 0; c < WIDTH; ++c)
+            {
+                const MazeCell *cell = &mm->grid[r][c];
+                cells[r*WIDTH + c] = (cell->square + 1) |
+                                     (cell->wall_n + 1) << 2 |
+                                     (cell->wall_w + 1) << 4;
+            }
+        }
+        fwrite(cells, 1, sizeof(cells), rw->fp);
+        rw->keyframe[player] = rw->count;
+        rw->since_keyframe[player] = 1;
+    }
+    else
+    {
+        for (i = 0; i < journal->size; ++i)
+        {
+            unsigned char entry[2];
+            put16(entry, journal->entry[i]);
+            fwrite(entry, 1, 2, rw->fp);
+        }
+        ++rw->since_keyframe[player];
+    }
+
+    /* Add index entry */
+    if (rw->count == rw->capacity)
+    {
+        rw->capacity = rw->capacity ? 2*rw->capacity : 256;
+        rw->index = realloc(rw->index, INDEX_ENTRY_SIZE*rw->capacity);
+        assert(rw->index != NULL);
+    }
+    put32(rw->index + INDEX_ENTRY_SIZE*rw->count, rw->offset);
+    put32(rw->index + INDEX_ENTRY_SIZE*rw->count + 4, rw->keyframe[player]);
+    ++rw->count;
+    rw->offset += size;
+}
+
+void replay_finish(ReplayWriter *rw)
+{
+    unsigned char trailer[TRAILER_SIZE];
+
+    fwrite(rw->index, INDEX_ENTRY_SIZE, rw->count, rw->fp);
+    memcpy(trailer, "AMZI", 4);
+    put32(trailer + 4, rw->offset);
+    put32(trailer + 8, rw->count);
+    put32(trailer + 12, 0);
+    fwrite(trailer, 1, sizeof(trailer), rw->fp);
+    fclose(rw->fp);
+    free(rw->index);
+    memset(rw, 0, sizeof(*rw));
+}
+
+/* Rebuilds the index of a log without a (valid) trailer by scanning all
+   records that were completely written. */
+static void rebuild_index(ReplayLog *log)
+{
+    unsigned long offset = HEADER_SIZE, size;
+    int keyframe[256], capacity = 0;
+
+    memset(keyframe, 0, sizeof(keyframe));
+    log->count = 0;
+    while (offset + RECORD_HEADER_SIZE <= log->size)
+    {
+        const unsigned char *rec = log->data + offset;
+        size = get32(rec);
+        if (size < RECORD_HEADER_SIZE || size > log->size - offset) break;
+        if (log->count == capacity)
+        {
+            capacity = capacity ? 2*capacity : 256;
+            log->own_index = realloc(log->own_index,
+                                     INDEX_ENTRY_SIZE*capacity);
+            assert(log->own_index != NULL);
+        }
+        if (rec[4]) keyframe[rec[5]] = log->count;
+        put32(log->own_index + INDEX_ENTRY_SIZE*log->count, offset);
+        put32(log->own_index + INDEX_ENTRY_SIZE*log->count + 4,
+              keyframe[rec[5]]);
+        ++log->count;
+        offset += size;
+    }
+    log->index = log->own_index;
+}
+
+bool replay_open(ReplayLog *log, const char *path)
+{
+    struct stat st;
+    const unsigned char *trailer;
+    void *data;
+    int fd;
+
+    memset(log, 0, sizeof(*log));
+    if ((fd = open(path, O_RDONLY)) == -1) return false;
+    if (fstat(fd, &st) != 0 || st.st_size < HEADER_SIZE ||
+        (data = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0))
+            == MAP_FAILED)
+    {
+        close(fd);
+        return false;
+    }
+    close(fd);
+
+    log->data = data;
+    log->size = st.st_size;
+    if (memcmp(log->data, "AMZR", 4) != 0 || log->data[4] != 1)
+    {
+        replay_close(log);
+        return false;
+    }
+    log->num_players = log->data[5];
+    log->interval    = get16(log->data + 6);
+
+    trailer = log->data + log->size - TRAILER_SIZE;
+    if (log->size >= HEADER_SIZE + TRAILER_SIZE &&
+        memcmp(trailer, "AMZI", 4) == 0 &&
+        get32(trailer + 4) + INDEX_ENTRY_SIZE*get32(trailer + 8) ==
+            log->size - TRAILER_SIZE)
+    {
+        log->index = log->data + get32(trailer + 4);
+        log->count = get32(trailer + 8);
+    }
+    else
+    {
+        rebuild_index(log);
+    }
+    return true;
+}
+
+void replay_close(ReplayLog *log)
+{
+    if (log->data != NULL) munmap((void*)log->data, log->size);
+    free(log->own_index);
+    memset(log, 0, sizeof(*log));
+}
+
+static const unsigned char *record_data(const ReplayLog *log, int n)
+{
+    assert(n >= 0 && n < log->count);
+    return log->data + get32(log->index + INDEX_ENTRY_SIZE*n);
+}
+
+/* Returns the number of the record describing the state of `player' after
+   turn `turn_no' (-1 for the initial state), or -1 if there is none. */
+int replay_find(const ReplayLog *log, int player, int turn_no)
+{
+    const unsigned char *rec;
+    int n;
+
+    /* Records are normally written in order of turns, so try that first: */
+    n = (turn_no + 1)*log->num_players + player;
+    if (n >= 0 && n < log->count)
+    {
+        rec = record_data(log, n);
+        if (rec[5] == player && (int)get16(rec + 6) == turn_no + 1) return n;
+    }
+    for (n = 0; n < log->count; ++n)
+    {
+        rec = record_data(log, n);
+        if (rec[5] == player && (int)get16(rec + 6) == turn_no + 1) return n;
+    }
+    return -1;
+}
+
+void replay_record(const ReplayLog *log, int n, ReplayRecord *rec)
+{
+    const unsigned char *p = record_data(log, n);
+
+    rec->keyframe            = p[4];
+    rec->player              = p[5];
+    rec->turn_no             = (int)get16(p + 6) - 1;
+    rec->score.moves         = get32s(p + 16);
+    rec->score.sq_disc       = get32s(p + 20);
+    rec->score.sq_disc_first = get32s(p + 24);
+    rec->score.captures      = get32s(p + 28);
+    rec->score.total         = get32s(p + 32);
+    rec->turn_len            = get16(p + 36);
+    rec->comments_len        = get16(p + 38);
+    rec->num_changes         = get16(p + 40);
+    rec->turn                = (const char*)p + RECORD_HEADER_SIZE;
+    rec->comments            = rec->turn + rec->turn_len;
+}
+
+/* Reconstructs the map of the player of record `n' after that record. */
+void replay_state(const ReplayLog *log, int n, MazeMap *mm)
+{
+    const int player = record_data(log, n)[5];
+    const int first = get32(log->index + INDEX_ENTRY_SIZE*n + 4);
+    const unsigned char *p, *data;
+    ReplayRecord rec;
+    int i, r, c, k;
+
+    /* Start from the keyframe */
+    mm_clear(mm);
+    replay_record(log, first, &rec);
+    data = (const unsigned char*)rec.comments + rec.comments_len;
+    for (r = 0; r < HEIGHT; ++r)
+    {
+        for (c = 0; c < WIDTH; ++c)
+        {
+            const int v = data[r*WIDTH + c];
+            mm->grid[r][c].square = (v&3) - 1;
+            mm->grid[r][c].wall_n = ((v >> 2)&3) - 1;
+            mm->grid[r][c].wall_w = ((v >> 4)&3) - 1;
+        }
+    }
+
+    /* Apply the player's changes since */
+    for (k = first + 1; k <= n; ++k)
+    {
+        if (record_data(log, k)[5] != player) continue;
+        replay_record(log, k, &rec);
+        data = (const unsigned char*)rec.comments + rec.comments_len;
+        for (i = 0; i < rec.num_changes; ++i)
+        {
+            const unsigned e = get16(data + 2*i);
+            r = JE_ROW(e);
+            c = JE_COL(e);
+            switch (JE_KIND(e))
+            {
+            case JE_SQUARE: mm->grid[r][c].square = JE_VALUE(e); break;
+            case JE_WALL_N: mm->grid[r][c].wall_n = JE_VALUE(e); break;
+            case JE_WALL_W: mm->grid[r][c].wall_w = JE_VALUE(e); break;
+            default: assert(0);
+            }
+        }
+    }
+
+    /* Location and border are stored in every record */
+    p = record_data(log, n);
+    mm->loc.r         = p[8];
+    mm->loc.c         = p[9];
+    mm->dir           = (Dir)p[10];
+    mm->border.top    = p[11];
+    mm->border.right  = p[12];
+    mm->border.bottom = p[13];
+    mm->border.left   = p[14];
+    mm_rehash(mm);
+}
@@ -0,0 +1,73 @@
+#ifndef REPLAY_H_INCLUDED
+#define REPLAY_H_INCLUDED
+
+#include "MazeMap.h"
+
+/* Binary replay logs.
+
+   A replay log contains one record for every turn of every player (plus one
+   for each player's starting position), holding the player's location and
+   cumulative score, the turn string, the player's comments and the squares
+   and walls the player learned about. Most records store only these changes
+   (taken from the map's journal); every `interval' records per player, and
+   whenever the journal is incomplete, the full map is stored instead.
+
+   An index at the end of the file allows the state of a player's map after
+   any turn to be reconstructed by decoding a single keyframe and at most
+   `interval' - 1 deltas. See Replay.c for the exact file layout. */
+
+#define REPLAY_KEYFRAME_INTERVAL 16
+
+typedef struct ReplayScore
+{
+    int moves, sq_disc, sq_disc_first, captures, total;
+} ReplayScore;
+
+/* A decoded record; the strings point into the mapped file and are not
+   zero-terminated. */
+typedef struct ReplayRecord
+{
+    int         player, turn_no;        /* turn_no is -1 for initial state */
+    bool        keyframe;
+    ReplayScore score;
+    const char  *turn, *comments;
+    int         turn_len, comments_len;
+    int         num_changes;            /* number of journal entries */
+} ReplayRecord;
+
+typedef struct ReplayWriter
+{
+    FILE            *fp;
+    unsigned long   offset;
+    int             num_players, interval;
+    int             since_keyframe[2], keyframe[2];
+    int             count, capacity;
+    unsigned char   *index;
+} ReplayWriter;
+
+typedef struct ReplayLog
+{
+    const unsigned char *data;
+    unsigned long       size;
+    int                 num_players, interval;
+    int                 count;          /* number of records */
+    const unsigned char *index;
+    unsigned char       *own_index;     /* rebuilt if the file was truncated */
+} ReplayLog;
+
+/* Writing: */
+extern bool replay_create( ReplayWriter *rw, const char *path,
+                           int num_players, int interval );
+extern void replay_write( ReplayWriter *rw, int player, int turn_no,
+                          const MazeMap *mm, const ReplayScore *score,
+                          const char *turn, const char *comments );
+extern void replay_finish(ReplayWriter *rw);
+
+/* Reading: */
+extern bool replay_open(ReplayLog *log, const char *path);
+extern void replay_close(ReplayLog *log);
+extern int  replay_find(const ReplayLog *log, int player, int turn_no);
+extern void replay_record(const ReplayLog *log, int n, ReplayRecord *rec);
+extern void replay_state(const ReplayLog *log, int n, MazeMap *mm);
+
+#endif /* ndef REPLAY_H_INCLUDED */
@@ -1,87 +1,91 @@
-#define _POSIX_SOURCE
-#include "MazeMap.h"
+#define _POSIX_C_SOURCE 200112L
+#include "AsyncLog.h"
+#include "GameEngine.h"
+#include "GameStore.h"
 #include "MazeIO.h"
+#include "PlayerPlugin.h"
+#include "Replay.h"
 #include <assert.h>
 #include <ctype.h>
+#include <errno.h>
 #include <signal.h>
+#include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <dlfcn.h>
+#include <poll.h>
+#include <time.h>
 #include <sys/wait.h>
 
 #define MAX_ARGS 50
 
-typedef struct Score
+/* Buffered input from one of a player's output streams: */
+typedef struct InputBuffer
 {
-    int moves, sq_disc, sq_disc_first, captures;
-} Score;
+    int     fd;             /* non-blocking pipe; -1 once closed */
+    int     len;
+    char    data[2048];
+    char    line[1024];     /* last line returned by read_player() */
+} InputBuffer;
 
-/* Global data:
-
-   The master maze map keeps track of existing walls and squares discovered
-   (by either player). Initially, all squares are unknown, and all wals are
-   known (either present or absent). This is used to determine valid moves and
-   keep track of which player discovers squares first.
-
-   For each player, there is a maze map that keeps track of information this
-   player has; this information is used to determine how many squares each
-   player has discovered.
-
-   For each player, we have a Score struct that keeps track of the total
-   score, consisting of:
-    - number of moves requested (-1 point each)
-    - number of squares discovered (1 point each)
-    - number of squares discovered first (1 additional point each)
-    - number of times the opponent was captured (100 points each)
-*/
-
-static const char *arg_csv;
-static int num_players;
-static MazeMap mm_master, mm_player[2];
-static bool map_complete[2];
-static Score score[2];
-static FILE *fpr[2], *fpw[2], *fpe[2], *fp_csv;
-static int pid[2];
+#define COMMENT_SIZE (int)sizeof(((InputBuffer*)NULL)->data)
 
+/* Records passed to the log writer thread. The map (and its journal) is
+   copied only if the CSV file or the replay log needs it, and encoded only by
+   the writer. */
+typedef enum LogKind { LOG_TURN, LOG_MESSAGE } LogKind;
 
-/* Determines what `player' can see in the given direction. */
-static char *line_of_sight(int player, RelDir rel_dir)
+typedef struct LogRecord
 {
-    static char buf[1 + (WIDTH > HEIGHT) ? WIDTH : HEIGHT];
+    LogKind     kind;
+    int         turn_no, player;
+    int         moves, discovered, first, captures, turn_score;
+    ReplayScore score;                      /* cumulative */
+    long        think_time;
+    bool        has_comments;
+    MazeMap     mm;
+    MazeJournal journal;
+    char        turn[sizeof(((InputBuffer*)NULL)->line)];
+    char        text[COMMENT_SIZE];         /* comments, or the message */
+} LogRecord;
+
+/* More than all turn records of a game, so the game never waits for the
+   writer (unless it is flooded with warnings): */
+#define LOG_CAPACITY 512
+
+/* Phases of a turn, timed separately: */
+typedef enum Phase { LOOK, THINK, MOVE, SCORE, LOG, NUM_PHASES } Phase;
 
-    char *p = buf;
-    int r, c, front, left, right;
+/* Global data:
 
-    r = mm_player[player].loc.r;
-    c = mm_player[player].loc.c;
-    front = TURN(mm_player[player].dir, rel_dir);
-    left  = TURN(front, LEFT);
-    right = TURN(front, RIGHT);
+   The arbiter plays a single game at a time (see GameEngine.h), held in
+   `game', and talks to the player programs through pipes (or calls the
+   plugins directly). */
+
+static const char *arg_csv, *arg_trace, *arg_replay, *arg_store;
+static const char *arg_tournament, *arg_results;
+static int arg_jobs;
+static bool arg_sweep, arg_pairs;
+static long arg_turn_time, arg_game_time;   /* in milliseconds; 0: no limit */
+static int arg_seed = 1;
+static FILE *fpw[2], *fp_csv, *fp_trace;
+static ReplayWriter replay;
+static GameStore store;
+static char *player_name[2];    /* commands, as given (for the store) */
+static AsyncLog logger;
+static InputBuffer player_out[2], player_err[2];
+static long time_left[2];   /* remaining time bank (if arg_game_time > 0) */
+static bool timed_out[2];
+static int pid[2];
+static long game_start, phase_time[2][NUM_PHASES][MAX_TURNS + 1];
+static int phase_count[2][NUM_PHASES];
+static const PlayerPlugin *plugin[2];  /* NULL for external programs */
+static void *plugin_player[2];
+static Game game;
 
-    while (WALL(&mm_master, r, c, front) == ABSENT)
-    {
-        bool open_left, open_right;
-        r = RDR(r, front);
-        c = CDC(c, front);
-        open_left  = WALL(&mm_master, r, c, left)  == ABSENT;
-        open_right = WALL(&mm_master, r, c, right) == ABSENT;
-        if (open_left && open_right)
-            *p++ = 'B';
-        else
-        if (open_left && !open_right)
-            *p++ = 'L';
-        else
-        if (!open_left && open_right)
-            *p++ = 'R';
-        else  /* (!open_left && !open_right) */
-            *p++ = 'N';
-    }
-    *p++ = 'W';
-    *p   = '\0';
-    return buf;
-}
 
 static char * const *parse_args(char *command)
 {
@@ -100,7 +104,8 @@ static char * const *parse_args(char *command)
     return argv;
 }
 
-static void launch(char *command, FILE **fpr, FILE **fpw, FILE **fpe, int *pid)
+static void launch( char *command, FILE **fpw,
+                    InputBuffer *out, InputBuffer *err, int *pid )
 {
     int fd[3][2];
     if (pipe(fd[0]) != 0 || pipe(fd[1]) != 0 || pipe(fd[2]) != 0)
@@ -135,12 +140,14 @@ static void launch(char *command, FILE **fpr, FILE **fpw, FILE **fpe, int *pid)
         close(fd[0][0]);
         close(fd[1][1]);
         close(fd[2][1]);
-        /* Make reading from child's error stream non-blocking: */
+        /* Make reading from child's output streams non-blocking: */
+        fcntl(fd[1][0], F_SETFL, fcntl(fd[1][0], F_GETFL)|O_NONBLOCK);
         fcntl(fd[2][0], F_SETFL, fcntl(fd[2][0], F_GETFL)|O_NONBLOCK);
+        out->fd = fd[1][0];  /* stdout */
+        err->fd = fd[2][0];  /* stderr */
+        out->len = err->len = 0;
         *fpw = fdopen(fd[0][1], "wt");  /* stdin */
-        *fpr = fdopen(fd[1][0], "rt");  /* stdout */
-        *fpe = fdopen(fd[2][0], "rt");  /* stderr */
-        if (*fpr == NULL || *fpw == NULL || *fpe == NULL)
+        if (*fpw == NULL)
         {
             printf("launch(): couldn't fdopen pipes!");
             exit(EXIT_FAILURE);
@@ -148,259 +155,406 @@ static void launch(char *command, FILE **fpr, FILE **fpw, FILE **fpe, int *pid)
     }
 }
 
+/* Returns whether `command' refers to a player plugin rather than a program */
+static bool is_plugin(const char *command)
+{
+    size_t len = strcspn(command, " \t\v\r\n");
+    return len > 3 && memcmp(command + len - 3, ".so", 3) == 0;
+}
+
+static void load_plugin(char *command, int p)
+{
+    char * const *argv = parse_args(command);
+    PlayerPluginEntry entry;
+    void *handle;
+
+    if ((handle = dlopen(argv[0], RTLD_NOW|RTLD_LOCAL)) == NULL)
+    {
+        printf("Couldn't load plugin `%s': %s\n", argv[0], dlerror());
+        exit(EXIT_FAILURE);
+    }
+    *(void **)&entry = dlsym(handle, PLAYER_PLUGIN_ENTRY);
+    if (entry == NULL || (plugin[p] = entry()) == NULL ||
+        plugin[p]->abi_version != PLAYER_PLUGIN_ABI_VERSION)
+    {
+        printf("`%s' is not a compatible player plugin!\n", argv[0]);
+        exit(EXIT_FAILURE);
+    }
+    if ((plugin_player[p] = plugin[p]->init(p == 0)) == NULL)
+    {
+        printf("Plugin `%s' failed to initialize!\n", argv[0]);
+        exit(EXIT_FAILURE);
+    }
+}
+
 static void load_maze(const char *path)
 {
-    FILE *fp = fopen(path, "rt");
-    if (fp == NULL || !mm_scan(&mm_master, fp))
+    if (!ge_load_maze(&game, path))
     {
         printf("Couldn't load maze from `%s'!\n", path);
         exit(EXIT_FAILURE);
     }
-    fclose(fp);
-    mm_clear_squares(&mm_master);
 }
 
 static void write_player(int p, const char *msg)
 {
+    /* Plugins receive lines of sight through observe() instead, and learn
+       whether they start when they are initialized. */
+    if (plugin[p] != NULL) return;
+
     fprintf(fpw[p], "%s\n", msg);
     fflush(fpw[p]);
 }
 
-static char *read_player(int p)
+/* Returns the current value of a monotonic clock in microseconds. */
+static long time_us()
 {
-    static char buf[1024];
-    char *eol;
-
-    /* Flush output so it is visible in case the fgets() blocks */
-    fflush(stdout);
-    fflush(stderr);
-    if (fgets(buf, sizeof(buf), fpr[p]) == NULL) return NULL;
-    if ((eol = strchr(buf, '\n')) == NULL) return NULL;
-    while (eol > buf && isspace(*(eol - 1))) --eol;
-    *eol = '\0';
-    return buf;
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return 1000000L*ts.tv_sec + ts.tv_nsec/1000;
 }
 
-char *read_comments(FILE *fp)
+/* Returns the current value of a monotonic clock in milliseconds. */
+static long time_ms()
 {
-    char *p, *q;
-    static char comment_tmp[2048];
-    static char comment_buf[2*sizeof(comment_tmp) + 2];
+    return time_us()/1000;
+}
 
-    /* Read a bunch of data from stderr */
-    comment_tmp[fread(comment_tmp, 1, sizeof(comment_tmp) - 1, fp)] = '\0';
+/* Records that `player' spent the time since `*since' in `phase' of turn
+   `turn_no', and resets `*since' to the current time. Returns the time spent
+   (in microseconds). */
+static long end_phase(int player, Phase phase, int turn_no, long *since)
+{
+    static const char * const phase_names[NUM_PHASES] = {
+        "look", "think", "move", "score", "log" };
 
+    long now = time_us(), elapsed = now - *since;
 
-    /* Copy to comment_buf, while adding double-quote characters in front and
-       back and doubling all exitsing double-quote characters in comment_tmp. */
-    q = comment_buf;
-    *q++ = '"';
-    for (p = comment_tmp; *p != '\0' && (p[0] != '\n' || p[1] != '\0'); ++p)
+    if (phase_count[player][phase] < MAX_TURNS + 1)
+        phase_time[player][phase][phase_count[player][phase]++] = elapsed;
+    if (fp_trace != NULL)
     {
-        if (*p == '"') *q++ = *p;
-        *q++ = *p;
+        fprintf(fp_trace, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,"
+                          "\"tid\":%d,\"ts\":%ld,\"dur\":%ld,"
+                          "\"args\":{\"turn\":%d}}",
+                phase_names[phase], player + 1, *since - game_start, elapsed,
+                turn_no + 1);
     }
-    *q++ = '"';
-    *q   = '\0';
-    return comment_buf;
-}
-
-/* Returns the squared Euclidian distance between two players */
-static int player_dist()
-{
-    int dr, dc;
-    if (num_players < 2) return -1;
-    dr = mm_player[0].loc.r - mm_player[1].loc.r;
-    dc = mm_player[0].loc.c - mm_player[1].loc.c;
-    return dr*dr + dc*dc;
+    *since = now;
+    return elapsed;
 }
 
-static void place_player(MazeMap *mm)
+static int cmp_long(const void *a, const void *b)
 {
-    int r, c, dir;
-    do {
-        r   = rand()%HEIGHT;
-        c   = rand()%WIDTH;
-        dir = (Dir)(rand()%4);
-    } while (WALL(&mm_master, r, c, TURN(dir, BACK)) != ABSENT);
-    mm_initialize(mm, r, c, dir);
+    long x = *(const long*)a, y = *(const long*)b;
+    return (x > y) - (x < y);
 }
 
-static void player_looks(int player)
+/* Prints the 50th, 95th and 99th percentile and maximum time spent in each
+   phase of a turn, for each player. */
+static void print_timing()
 {
-    static const Dir look_dirs[4] = { FRONT, RIGHT, BACK, LEFT };
+    static const char * const phase_names[NUM_PHASES] = {
+        "Look", "Think", "Move", "Score", "Log" };
+    static const int percentiles[3] = { 50, 95, 99 };
 
-    int d;
-    char buf[12];
+    int p, ph, i, n;
+    long *times;
 
-    /* Write four lines of sight */
-    for (d = 0; d < 4; ++d)
+    printf("Phase Player     p50     p95     p99     max  (microseconds)\n");
+    for (p = 0; p < game.num_players; ++p)
     {
-        Dir dir = look_dirs[d];
-        const char *line = line_of_sight(player, dir);
-        mm_look(&mm_player[player], line, dir);
-        write_player(player, line);
+        for (ph = 0; ph < NUM_PHASES; ++ph)
+        {
+            if ((n = phase_count[p][ph]) == 0) continue;
+            times = phase_time[p][ph];
+            qsort(times, n, sizeof(long), cmp_long);
+            printf("%-5s %6d", phase_names[ph], p + 1);
+            for (i = 0; i < 3; ++i)
+                printf(" %7ld", times[(percentiles[i]*n + 99)/100 - 1]);
+            printf(" %7ld\n", times[n - 1]);
+        }
     }
-
-    /* Infer other parts of the maze */
-    mm_infer(&mm_player[player]);
-
-    /* Write distance from opponent */
-    extern int snprintf(char *str, size_t size, const char *format, ...);
-    snprintf(buf, sizeof(buf), "%d", player_dist());
-    write_player(player, buf);
 }
 
-/* Checks the syntax of the turn for syntactic validity.
-
-   A turn is syntactically valid if it consists only of letters F, T, L and R,
-   and is between 1 and 256 (inclusive) letters long. */
-static bool is_valid_turn(const char *s)
+/* Reads all data currently available from `in'. Data that doesn't fit in the
+   buffer is discarded, so the player never blocks on a full pipe. */
+static void drain(InputBuffer *in)
 {
-    const char *p;
-    for (p = s; *p; ++p) if (strchr("FTLR", *p) == NULL) return false;
-    return p > s && p <= s + 256;
-}
+    char scratch[512];
+    ssize_t n;
 
-/* Computes the length of the maximal prefix of `turn' that constitues a valid
-   turn for `player', assuming the turn is syntactically valid. A turn is valid
-   if all moves in the turn can be performed in order without walking through
-   walls. */
-static int valid_turn_size(const char *turn, int r, int c, Dir dir)
-{
-    int i;
-
-    for (i = 0; turn[i]; ++i)
+    while (in->fd != -1)
     {
-        switch (turn[i])
+        if (in->len < (int)sizeof(in->data) - 1)
         {
-        case 'F': dir = TURN(dir, FRONT); break;
-        case 'T': dir = TURN(dir, BACK);  break;
-        case 'L': dir = TURN(dir, LEFT);  break;
-        case 'R': dir = TURN(dir, RIGHT); break;
-        default: assert(0);
+            n = read(in->fd, in->data + in->len,
+                     sizeof(in->data) - 1 - in->len);
+            if (n > 0) in->len += n;
+        }
+        else
+        {
+            n = read(in->fd, scratch, sizeof(scratch));
+        }
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0 && errno == EAGAIN) break;
+        if (n <= 0)  /* end of file or error */
+        {
+            close(in->fd);
+            in->fd = -1;
         }
-        if (WALL(&mm_master, r, c, dir) != ABSENT) break;
-        r = RDR(r, dir);
-        c = CDC(c, dir);
     }
+    in->data[in->len] = '\0';
+}
 
-    return i;
+/* Waits up to `timeout' milliseconds (or indefinitely, if negative) for
+   output from any player, and drains all streams that have data. */
+static void poll_players(long timeout)
+{
+    struct pollfd fds[4];
+    InputBuffer *in[4];
+    int p, n = 0, i;
+
+    for (p = 0; p < game.num_players; ++p)
+    {
+        if (player_out[p].fd != -1) in[n++] = &player_out[p];
+        if (player_err[p].fd != -1) in[n++] = &player_err[p];
+    }
+    for (i = 0; i < n; ++i)
+    {
+        fds[i].fd      = in[i]->fd;
+        fds[i].events  = POLLIN;
+        fds[i].revents = 0;
+    }
+    if (poll(fds, n, (int)timeout) <= 0) return;
+    for (i = 0; i < n; ++i)
+        if (fds[i].revents != 0) drain(in[i]);
 }
 
-static bool player_moves(int player, const char *turn)
+/* Reads the next turn from player `p'. Returns NULL if the player closed its
+   output, wrote an overlong line, or exceeded its time limit: the time it
+   takes to respond is limited to `arg_turn_time' for each turn, and charged
+   against a bank of `arg_game_time' for the whole game. */
+static char *read_player(int p)
 {
-    MazeMap *mm = &mm_player[player];
-    Point old_loc = mm->loc;
+    InputBuffer *out = &player_out[p];
+    char *buf = out->line;
+    long start = time_ms(), limit = -1, elapsed;
+    char *eol;
     int len;
 
-    if (!is_valid_turn(turn))
+    if (arg_turn_time > 0) limit = arg_turn_time;
+    if (arg_game_time > 0 && (limit == -1 || time_left[p] < limit))
+        limit = time_left[p];
+
+    if (plugin[p] != NULL)
     {
-        printf("Player %d made an invalid move: `%s'!\n", player + 1, turn);
-        return false;
+        /* Plugins can't be interrupted; check the limit afterwards. */
+        const char *move = plugin[p]->move(plugin_player[p]);
+        elapsed = time_ms() - start;
+        time_left[p] -= elapsed;
+        if (limit != -1 && elapsed > limit) timed_out[p] = true;
+        if (timed_out[p]) return NULL;
+        if (move == NULL || strlen(move) >= sizeof(out->line)) return NULL;
+        return strcpy(buf, move);
     }
 
-    /* Perform valid moves */
-    len = valid_turn_size(turn, mm->loc.r, mm->loc.c, mm->dir);
-    if (len < (int)strlen(turn))
+    while ((eol = memchr(out->data, '\n', out->len)) == NULL)
     {
-        printf("WARNING: Player %d's turn (`%s') was truncated by %d moves.\n",
-               player + 1, turn, (int)strlen(turn) - len);
+        if (out->fd == -1 || out->len >= (int)sizeof(out->line) - 1)
+            return NULL;
+        elapsed = time_ms() - start;
+        if (limit != -1 && elapsed >= limit)
+        {
+            timed_out[p] = true;
+            time_left[p] -= elapsed;
+            return NULL;
+        }
+        poll_players((limit == -1) ? -1 : limit - elapsed);
     }
-    for (; len > 0; --len) mm_move(mm, *turn++);
+    time_left[p] -= time_ms() - start;
+
+    /* Remove the line from the input buffer */
+    len = eol - out->data;
+    if (len >= (int)sizeof(out->line)) return NULL;
+    memcpy(buf, out->data, len);
+    out->len -= len + 1;
+    memmove(out->data, eol + 1, out->len + 1);
+
+    /* Remove trailing whitespace */
+    while (len > 0 && isspace(buf[len - 1])) --len;
+    buf[len] = '\0';
+    return buf;
+}
 
-    /* If we end up at our starting point, do an extra T move */
-    if (mm->loc.r == old_loc.r && mm->loc.c == old_loc.c)
+/* Returns everything collected from the player's stderr since the last call
+   (plugins have none) in `comment_tmp'. */
+static char *read_comments(int player, char comment_tmp[COMMENT_SIZE])
+{
+    comment_tmp[0] = '\0';
+    if (plugin[player] == NULL)
     {
-        printf("WARNING: Player %d returned to his original location.\n",
-               player + 1);
-        mm_move(mm, 'T');
+        poll_players(0);
+        strcpy(comment_tmp, player_err[player].data);
+        player_err[player].len = 0;
+        player_err[player].data[0] = '\0';
     }
-
-    return true;
+    return comment_tmp;
 }
 
-static int total_score(const Score *sc)
+static char *quote_comments( const char *comment_tmp,
+                             char comment_buf[2*COMMENT_SIZE + 2] )
 {
-    return -sc->moves + sc->sq_disc + sc->sq_disc_first + 100*sc->captures;
+    const char *p;
+    char *q;
+
+    /* Copy to comment_buf, while adding double-quote characters in front and
+       back and doubling all exitsing double-quote characters in comment_tmp. */
+    q = comment_buf;
+    *q++ = '"';
+    for (p = comment_tmp; *p != '\0' && (p[0] != '\n' || p[1] != '\0'); ++p)
+    {
+        if (*p == '"') *q++ = *p;
+        *q++ = *p;
+    }
+    *q++ = '"';
+    *q   = '\0';
+    return comment_buf;
 }
 
-static Score player_scores(int player, const char *turn)
+static void player_looks(int player)
 {
-    int r, c;
-    MazeMap *mm = &mm_player[player];
-    const Score *sc = &score[player];
-    Score new_score = score[player];
+    int d;
+    char buf[12];
+    const char *lines[4];
 
-    new_score.moves          = sc->moves + strlen(turn);
-    new_score.captures       = sc->captures;
-    new_score.sq_disc        = 0;
-    new_score.sq_disc_first  = sc->sq_disc_first;
+    ge_observe(&game, player, lines);
 
-    /* Count discovered squares */
-    new_score.sq_disc = 0;
-    for (r = 0; r < HEIGHT; ++r)
+    if (plugin[player] != NULL)
     {
-        for (c = 0; c < WIDTH; ++c)
-        {
-            if (SQUARE(mm, r, c) == PRESENT)
-            {
-                ++new_score.sq_disc;
-                if (SQUARE(&mm_master, r, c) == UNKNOWN)
-                {
-                    SET_SQUARE(&mm_master, r, c, PRESENT);
-                    ++new_score.sq_disc_first;
-                }
-            }
-        }
+        plugin[player]->observe( plugin_player[player], lines,
+                                 ge_player_dist(&game) );
+        return;
     }
 
-    if (new_score.sq_disc == HEIGHT*WIDTH)
+    /* Write four lines of sight */
+    for (d = 0; d < 4; ++d)
+        write_player(player, lines[d]);
+
+    /* Write distance from opponent */
+    extern int snprintf(char *str, size_t size, const char *format, ...);
+    snprintf(buf, sizeof(buf), "%d", ge_player_dist(&game));
+    write_player(player, buf);
+}
+
+/* Writes a record to the progress table, the CSV file and the replay log.
+   Runs on the log writer thread. */
+static void write_record(void *arg, void *record)
+{
+    LogRecord *rec = record;
+    char map_desc[MM_ENCODE_SIZE], quoted[2*COMMENT_SIZE + 2];
+
+    (void)arg;
+    if (rec->kind == LOG_MESSAGE)
     {
-        map_complete[player] = true;
+        fputs(rec->text, stdout);
+        return;
     }
-    else
+
+    printf(" %5d %5d %5d %5d %5d %5d %5d %5d\n", rec->turn_no + 1,
+            rec->player + 1, rec->moves, rec->discovered, rec->first,
+            rec->captures, rec->turn_score, rec->score.total );
+
+    if (fp_csv != NULL)
     {
-        if (player_dist() == 0)
-            ++new_score.captures;
+        mm_encode_r(&rec->mm, true, map_desc);
+        fprintf(fp_csv, "%d,%d,%d,%d,%d,%d,%d,%d,%ld,%s,%s,%s\n",
+                        rec->turn_no + 1, rec->player + 1,
+                        rec->moves, rec->discovered, rec->first,
+                        rec->captures, rec->turn_score, rec->score.total,
+                        rec->think_time, rec->turn, map_desc,
+                        rec->has_comments ?
+                            quote_comments(rec->text, quoted) : "" );
     }
 
-    return new_score;
+    if (replay.fp != NULL)
+    {
+        if (rec->mm.journal != NULL) rec->mm.journal = &rec->journal;
+        replay_write( &replay, rec->player, rec->turn_no, &rec->mm,
+                      &rec->score, rec->turn, rec->text );
+    }
 }
 
-static void log_progress( int turn_no, int player,
-                          const char *turn, Score *new_score,
-                          const char *comments )
+/* Makes progress visible whenever the writer has caught up, in case the
+   game is waiting for a player. */
+static void flush_output(void *arg)
 {
-    const Score *old_score = &score[player];
-    const int moves      = new_score->moves - old_score->moves;
-    const int discovered = new_score->sq_disc - old_score->sq_disc;
-    const int first      = new_score->sq_disc_first - old_score->sq_disc_first;
-    const int captures   = new_score->captures - old_score->captures;
-    const int total      = total_score(new_score);
-    const int score      = total - total_score(old_score);
-    const char *map_desc = mm_encode(&mm_player[player], true);
-
-    printf(" %5d %5d %5d %5d %5d %5d %5d %5d\n", turn_no + 1, player + 1,
-            moves, discovered, first, captures, score, total );
+    (void)arg;
+    fflush(stdout);
+}
 
-    if (fp_csv != NULL)
+static void start_logger()
+{
+    if (!al_start( &logger, sizeof(LogRecord), LOG_CAPACITY,
+                   write_record, flush_output, NULL ))
     {
-        fprintf(fp_csv, "%d,%d,%d,%d,%d,%d,%d,%d,%s,%s,%s\n",
-                        turn_no + 1, player + 1,
-                        moves, discovered, first, captures, score, total,
-                        turn, map_desc, comments );
+        printf("Couldn't start log writer thread!\n");
+        exit(EXIT_FAILURE);
     }
 }
 
+/* Prints a message, in order with the progress table. */
+static void log_message(const char *fmt, ...)
+{
+    LogRecord *rec = al_reserve(&logger);
+    va_list ap;
+
+    rec->kind = LOG_MESSAGE;
+    va_start(ap, fmt);
+    vsprintf(rec->text, fmt, ap);
+    va_end(ap);
+    al_commit(&logger);
+}
 
-static int final_score(int player, int winner)
+/* Reports the turn just played; the player's score was `old_score' before.
+   Only copies what the sinks need; all formatting and output happens on the
+   log writer thread. */
+static void log_progress( int turn_no, int player, const char *turn,
+                          const Score *old_score, long think_time,
+                          const char *comments )
 {
-    int res = total_score(&score[player]);
-    if (winner != -1) res = (player == winner) ? 2*res : 0;
-    if (res < 0) res = 0;
-    if (res > 1000) res = 1000;
-    return res;
+    const Score *new_score = &game.score[player];
+    const MazeMap *mm = &game.mm_player[player];
+    LogRecord *rec = al_reserve(&logger);
+
+    rec->kind       = LOG_TURN;
+    rec->turn_no    = turn_no;
+    rec->player     = player;
+    rec->moves      = new_score->moves - old_score->moves;
+    rec->discovered = new_score->sq_disc - old_score->sq_disc;
+    rec->first      = new_score->sq_disc_first - old_score->sq_disc_first;
+    rec->captures   = new_score->captures - old_score->captures;
+    rec->turn_score = ge_total_score(new_score) - ge_total_score(old_score);
+    rec->score.moves         = new_score->moves;
+    rec->score.sq_disc       = new_score->sq_disc;
+    rec->score.sq_disc_first = new_score->sq_disc_first;
+    rec->score.captures      = new_score->captures;
+    rec->score.total         = ge_total_score(new_score);
+    rec->think_time   = think_time;
+    rec->has_comments = comments != NULL;
+    strcpy(rec->turn, turn);
+    strcpy(rec->text, comments ? comments : "");
+
+    if (fp_csv != NULL || replay.fp != NULL) rec->mm = *mm;
+    if (replay.fp != NULL && mm->journal != NULL)
+    {
+        rec->journal.size       = mm->journal->size;
+        rec->journal.incomplete = mm->journal->incomplete;
+        rec->journal.generation = mm->journal->generation;
+        memcpy( rec->journal.entry, mm->journal->entry,
+                sizeof(*mm->journal->entry)*mm->journal->size );
+    }
+    al_commit(&logger);
 }
 
 static void disable_sigpipe()
@@ -422,11 +576,65 @@ static int parse_options(int argc, char *argv[])
         if (strcmp(argv[i], "--csv") == 0 && ++i < argc)
             arg_csv = argv[i];
         else
+        if (memcmp(argv[i], "--trace=", 8) == 0)
+            arg_trace = argv[i] + 8;
+        else
+        if (strcmp(argv[i], "--trace") == 0 && ++i < argc)
+            arg_trace = argv[i];
+        else
+        if (memcmp(argv[i], "--replay=", 9) == 0)
+            arg_replay = argv[i] + 9;
+        else
+        if (strcmp(argv[i], "--replay") == 0 && ++i < argc)
+            arg_replay = argv[i];
+        else
         if (memcmp(argv[i], "--seed=", 7) == 0)
-            srand(atoi(argv[i] + 7));
+            srand(arg_seed = atoi(argv[i] + 7));
         else
         if (strcmp(argv[i], "--seed") == 0 && ++i < argc)
-            srand(atoi(argv[i]));
+            srand(arg_seed = atoi(argv[i]));
+        else
+        if (memcmp(argv[i], "--store=", 8) == 0)
+            arg_store = argv[i] + 8;
+        else
+        if (strcmp(argv[i], "--store") == 0 && ++i < argc)
+            arg_store = argv[i];
+        else
+        if (memcmp(argv[i], "--tournament=", 13) == 0)
+            arg_tournament = argv[i] + 13;
+        else
+        if (strcmp(argv[i], "--tournament") == 0 && ++i < argc)
+            arg_tournament = argv[i];
+        else
+        if (memcmp(argv[i], "--turn-time=", 12) == 0)
+            arg_turn_time = atol(argv[i] + 12);
+        else
+        if (strcmp(argv[i], "--turn-time") == 0 && ++i < argc)
+            arg_turn_time = atol(argv[i]);
+        else
+        if (memcmp(argv[i], "--game-time=", 12) == 0)
+            arg_game_time = atol(argv[i] + 12);
+        else
+        if (strcmp(argv[i], "--game-time") == 0 && ++i < argc)
+            arg_game_time = atol(argv[i]);
+        else
+        if (memcmp(argv[i], "--results=", 10) == 0)
+            arg_results = argv[i] + 10;
+        else
+        if (strcmp(argv[i], "--results") == 0 && ++i < argc)
+            arg_results = argv[i];
+        else
+        if (memcmp(argv[i], "--jobs=", 7) == 0)
+            arg_jobs = atoi(argv[i] + 7);
+        else
+        if (strcmp(argv[i], "--jobs") == 0 && ++i < argc)
+            arg_jobs = atoi(argv[i]);
+        else
+        if (strcmp(argv[i], "--sweep") == 0)
+            arg_sweep = true;
+        else
+        if (strcmp(argv[i], "--pairs") == 0)
+            arg_pairs = true;
         else
             argv[j++] = argv[i];
     }
@@ -440,107 +648,956 @@ static void open_csv(const char *path)
         printf("Couldn't open CSV file `%s'!\n", path);
         exit(EXIT_FAILURE);
     }
+    /* Time is the player's think time in microseconds. */
     fprintf(fp_csv, "TurnNo,Player,Moves,Discovered,First,Captures,Score,"
-                    "Total,Turn,Map,Comments\n");
+                    "Total,Time,Turn,Map,Comments\n");
 }
 
-static void initialize(int argc, char *argv[])
+static void open_trace(const char *path)
 {
-    int p;
-
-    argc = parse_options(argc, argv);
+    if ((fp_trace = fopen(path, "wt")) == NULL)
+    {
+        printf("Couldn't open trace file `%s'!\n", path);
+        exit(EXIT_FAILURE);
+    }
+    fprintf(fp_trace, "{\"traceEvents\":[\n"
+            "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,"
+            "\"args\":{\"name\":\"arbiter\"}}");
+}
 
-    if (argc < 3 || argc > 4)
+static void close_trace()
+{
+    int p;
+    for (p = 0; p < game.num_players; ++p)
     {
-        printf(
+        fprintf(fp_trace, ",\n{\"name\":\"thread_name\",\"ph\":\"M\","
+                "\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"Player %d\"}}",
+                p + 1, p + 1);
+    }
+    fprintf(fp_trace, "\n]}\n");
+    fclose(fp_trace);
+    fp_trace = NULL;
+}
+
+static void usage()
+{
+    printf(
 "usage:\n"
 "\tarbiter [options] <maze file> <player 1 command> [<player 2 command>]\n"
+"\tarbiter [options] --tournament <spec file>\n"
+"\tarbiter [options] --sweep <maze file>[,<maze file>...] <player 1 command>"
+" [<player 2 command>]\n"
 "options:\n"
 "\t--csv <file>\n"
-"\t--seed <value>\n");
-        exit(EXIT_FAILURE);
-    }
-    if (arg_csv != NULL) open_csv(arg_csv);
+"\t--trace <file>       write timing in Chrome trace event format\n"
+"\t--replay <file>      write a binary replay log\n"
+"\t--seed <value>\n"
+"\t--store <dir>        append game summaries to a column store (see gamedb)\n"
+"\t--turn-time <ms>     time limit per turn (default: none)\n"
+"\t--game-time <ms>     time limit per game, per player (default: none)\n"
+"tournament and sweep options:\n"
+"\t--results <file>     (tournament default: <spec file>.results)\n"
+"\t--jobs <count>       (default: number of processors)\n"
+"\t--pairs              sweep all pairs of starting poses in 2-player games\n"
+"A player command ending in `.so' is loaded as an in-process plugin.\n"
+"A maze file of the form <pack file>:<index> selects a maze from a maze pack\n"
+"(see mkpack).\n");
+    exit(EXIT_FAILURE);
+}
 
-    load_maze(argv[1]);
-    num_players = argc - 2;
-    do {
-        for (p = 0; p < num_players; ++p)
-            place_player(&mm_player[p]);
-    } while (num_players > 1 && player_dist() < 17*17);
+/* Loads the maze, places the players and launches the player programs.
+   The first `num_fixed' players start at the given poses; the others are
+   placed randomly. */
+static void start_game( const char *maze_path, int players, char *commands[],
+                        const StartPose *poses, int num_fixed )
+{
+    int p;
+
+    load_maze(maze_path);
+    ge_init(&game, players, poses, num_fixed);
 
     /* Start player programs: */
     disable_sigpipe();
-    for (p = 0; p < num_players; ++p)
-        launch(argv[2 + p], &fpr[p], &fpw[p], &fpe[p], &pid[p]);
+    for (p = 0; p < game.num_players; ++p)
+    {
+        if (is_plugin(commands[p]))
+            load_plugin(commands[p], p);
+        else
+            launch( commands[p], &fpw[p],
+                    &player_out[p], &player_err[p], &pid[p] );
+        time_left[p] = arg_game_time;
+    }
+}
+
+/* Parses the command line and, for a single game, starts it. Returns the
+   number of remaining (non-option) arguments. */
+static int initialize(int argc, char *argv[])
+{
+    int p;
+
+    argc = parse_options(argc, argv);
+    if (arg_store != NULL && !gs_open(&store, arg_store))
+    {
+        printf("Couldn't open game store `%s'!\n", arg_store);
+        exit(EXIT_FAILURE);
+    }
+
+    if (arg_tournament != NULL)
+    {
+        if (argc != 1) usage();
+        return argc;
+    }
+
+    if (argc < 3 || argc > 4) usage();
+    if (arg_sweep) return argc;
+    if (arg_csv != NULL) open_csv(arg_csv);
+    if (arg_trace != NULL) open_trace(arg_trace);
+
+    /* Plugin commands are split up when loaded; keep copies for the store */
+    for (p = 0; p < argc - 2; ++p)
+    {
+        player_name[p] = malloc(strlen(argv[2 + p]) + 1);
+        assert(player_name[p] != NULL);
+        strcpy(player_name[p], argv[2 + p]);
+    }
+    start_game(argv[1], argc - 2, argv + 2, NULL, 0);
+    if (arg_replay != NULL &&
+        !replay_create(&replay, arg_replay, game.num_players,
+                       REPLAY_KEYFRAME_INTERVAL))
+    {
+        printf("Couldn't create replay log `%s'!\n", arg_replay);
+        exit(EXIT_FAILURE);
+    }
+    return argc;
 }
 
 static void finalize()
 {
     int p;
-    for (p = 0; p < num_players; ++p)
-        write_player(p, "Quit");
-    for (p = 0; p < num_players; ++p)
+    for (p = 0; p < game.num_players; ++p)
+    {
+        if (plugin[p] != NULL)
+            plugin[p]->quit(plugin_player[p]);
+        else
+            write_player(p, "Quit");
+    }
+    for (p = 0; p < game.num_players; ++p)
+    {
+        if (plugin[p] != NULL) continue;
+        if (timed_out[p]) kill(pid[p], SIGKILL);
         waitpid(pid[p], NULL, 0);
+    }
 }
 
-int main(int argc, char *argv[])
+/* Plays a complete game between the launched players. Returns the number of
+   turns played; the winner is stored in `game'. */
+static int play_game()
 {
-    int t, p;
-    initialize(argc, argv);
+    static const Score no_score;
 
+    int p;
+
+    game_start = time_us();
     printf("#Turn Player Moves Disc. First Capt. Score Total\n");
     printf("------------------------------------------------\n");
+    start_logger();
 
-    /* Discover starting square */
-    for (p = 0; p < num_players; ++p)
-    {
-        Score new_score = player_scores(p, "");
-        log_progress(-1, p, "", &new_score, "");
-        score[p] = new_score;
-    }
+    /* Starting squares were discovered by ge_init() */
+    for (p = 0; p < game.num_players; ++p)
+        log_progress(-1, p, "", &no_score, 0, NULL);
 
     write_player(0, "Start");
 
-    for (t = 0; t < 150*num_players; ++t)
+    while (!game.over)
     {
-        Score new_score;
+        Score old_score;
         const char *turn;
-        const char *comments;
+        char comments[COMMENT_SIZE];
+        long since = time_us(), think_time;
+        const int t = game.turn_no/game.num_players;
 
-        p = t%num_players;
+        p = ge_player(&game);
         player_looks(p);
-        if ((turn = read_player(p)) == NULL)
+        end_phase(p, LOOK, t, &since);
+        turn = read_player(p);
+        think_time = end_phase(p, THINK, t, &since);
+        if (turn == NULL)
         {
-            printf("Unexpected end of input from player %d!\n", p + 1);
+            if (timed_out[p])
+                log_message("Player %d exceeded its time limit!\n", p + 1);
+            else
+                log_message("Unexpected end of input from player %d!\n",
+                            p + 1);
+            ge_abort(&game);
+            assert(game.num_players == 1 || game.winner == 1 - p);
             break;
         }
         /*
-        mm_print(&mm_player[p], stdout, true);
-        printf("(%s)\n", mm_encode(&mm_player[p], true));
+        mm_print(&game.mm_player[p], stdout, true);
+        printf("(%s)\n", mm_encode(&game.mm_player[p], true));
         */
-        if (!player_moves(p, turn)) break;
-        comments = read_comments(fpe[p]);
-        new_score = player_scores(p, turn);
-        log_progress(t/num_players, p, turn, &new_score, comments);
-        score[p] = new_score;
-        if (map_complete[p] && (num_players == 1 || player_dist() == 0))
+        old_score = game.score[p];
+        if (!ge_move(&game, turn))
         {
-            t++;
+            log_message("Player %d made an invalid move: `%s'!\n",
+                        p + 1, turn);
+            assert(game.num_players == 1 || game.winner == 1 - p);
             break;
         }
+        if (game.truncated > 0)
+        {
+            log_message("WARNING: Player %d's turn (`%s') was truncated by "
+                        "%d moves.\n", p + 1, turn, game.truncated);
+        }
+        if (game.returned)
+        {
+            log_message("WARNING: Player %d returned to his original "
+                        "location.\n", p + 1);
+        }
+        end_phase(p, MOVE, t, &since);
+        ge_score(&game, turn);
+        end_phase(p, SCORE, t, &since);
+        read_comments(p, comments);
+        log_progress(t, p, turn, &old_score, think_time, comments);
+        end_phase(p, LOG, t, &since);
+    }
+    al_stop(&logger);
+    printf("------------------------------------------------\n");
+    print_timing();
+    if (fp_trace != NULL) close_trace();
+    if (replay.fp != NULL) replay_finish(&replay);
+
+    return game.turn_no;
+}
+
+/* Results of a game are passed around as a line of text:
+
+        <final score 1> <final score 2> <turns>
+        <moves 1> <discovered 1> <first 1> <captures 1> <total 1>
+        <moves 2> <discovered 2> <first 2> <captures 2> <total 2>
+
+   (all on one line; player 2's fields are 0 in one-player games). */
+#define RESULT_SIZE 160
+
+static char *format_result(char buf[RESULT_SIZE], int turns)
+{
+    static const Score no_score;
+
+    const Score *sc[2];
+
+    sc[0] = &game.score[0];
+    sc[1] = (game.num_players > 1) ? &game.score[1] : &no_score;
+    sprintf(buf, "%d %d %d %d %d %d %d %d %d %d %d %d %d\n",
+            ge_final_score(&game, 0),
+            (game.num_players > 1) ? ge_final_score(&game, 1) : 0, turns,
+            sc[0]->moves, sc[0]->sq_disc, sc[0]->sq_disc_first,
+            sc[0]->captures, ge_total_score(sc[0]),
+            sc[1]->moves, sc[1]->sq_disc, sc[1]->sq_disc_first,
+            sc[1]->captures, ge_total_score(sc[1]));
+    return buf;
+}
+
+/* Appends a game to the store, if one was given with --store. */
+static void store_result( const char *maze, int seed, const char *player1,
+                          const char *player2, const char *result )
+{
+    GameRow row;
+
+    if (arg_store == NULL) return;
+    if (sscanf(result, "%d %d %d %d %d %d %d %d %d %d %d %d %d",
+               &row.final[0], &row.final[1], &row.turns,
+               &row.moves[0], &row.discovered[0], &row.first[0],
+               &row.captures[0], &row.total[0],
+               &row.moves[1], &row.discovered[1], &row.first[1],
+               &row.captures[1], &row.total[1]) != 13) return;
+    row.maze      = maze;
+    row.seed      = seed;
+    row.player[0] = player1;
+    row.player[1] = player2;
+    gs_append(&store, &row);
+    if (!gs_flush(&store))
+    {
+        printf("Couldn't write to game store `%s'!\n", arg_store);
+        exit(EXIT_FAILURE);
+    }
+}
+
+/* Batch modes:
+
+   Tournaments and sweeps play many games. Each game is played in a child
+   process of its own (since all game state is global), which writes the
+   final scores and the number of turns to a pipe. Whenever one of the
+   `--jobs' slots becomes free, the next unplayed game is taken from the
+   queue, so the load is balanced dynamically across all processors. */
+
+#define MAX_MAZES     256
+#define MAX_LINE     1024
+
+typedef struct ScoreStats
+{
+    int     games;
+    double  mean, m2;       /* running mean and sum of squared deviations */
+    int     min, max;
+    int     count[1001];    /* number of games per final score */
+} ScoreStats;
+
+static void add_score(ScoreStats *st, int final)
+{
+    double delta = final - st->mean;
+
+    if (st->games == 0 || final < st->min) st->min = final;
+    if (st->games == 0 || final > st->max) st->max = final;
+    st->mean += delta/++st->games;
+    st->m2   += delta*(final - st->mean);
+    ++st->count[final];
+}
+
+/* Returns the lowest final score such that at least `pct' percent of the
+   games scored at most that. */
+static int stats_percentile(const ScoreStats *st, int pct)
+{
+    int score, seen = 0;
+    for (score = 0; score < 1000; ++score)
+    {
+        seen += st->count[score];
+        if (100*seen >= pct*st->games) break;
+    }
+    return score;
+}
+
+static void print_stats_header(const char *title)
+{
+    printf("%-24s %6s %8s %10s %5s %5s %5s %5s %5s"
+           "  score distribution (by hundreds)\n", title, "Games", "Mean",
+           "Variance", "Min", "P10", "P50", "P90", "Max");
+}
+
+static void print_stats(const char *label, const ScoreStats *st)
+{
+    int n, i, hist;
+
+    printf("%-24s %6d %8.2f %10.2f %5d %5d %5d %5d %5d ", label, st->games,
+           st->mean, (st->games > 1) ? st->m2/(st->games - 1) : 0.0, st->min,
+           stats_percentile(st, 10), stats_percentile(st, 50),
+           stats_percentile(st, 90), st->max);
+    for (n = 0; n <= 1000; n += 100)
+    {
+        for (hist = 0, i = n; i < n + 100 && i <= 1000; ++i)
+            hist += st->count[i];
+        printf(" %d", hist);
+    }
+    printf("\n");
+}
+
+/* Runs in a child process: plays a single game and writes its result (see
+   format_result()) to file descriptor `fd'. */
+static void play_in_child( int fd, const char *maze_path, int players,
+                           char *commands[], const StartPose *poses,
+                           int num_fixed )
+{
+    char buf[RESULT_SIZE];
+    int turns;
+
+    /* Suppress the per-turn progress table */
+    if (freopen("/dev/null", "w", stdout) == NULL) exit(EXIT_FAILURE);
+
+    start_game(maze_path, players, commands, poses, num_fixed);
+    turns = play_game();
+    finalize();
+
+    format_result(buf, turns);
+    if (write(fd, buf, strlen(buf)) != (ssize_t)strlen(buf))
+        exit(EXIT_FAILURE);
+    exit(EXIT_SUCCESS);
+}
+
+/* Plays all games numbered 0 through `num_jobs' - 1 that are not marked as
+   done, at most `jobs' at a time. play() is called in a child process and must
+   not return; finished() is called with its output when it exits. */
+static void run_pool( int jobs, int num_jobs, const bool *done,
+                      void (*play)(int job, int fd),
+                      void (*finished)(int job, const char *result) )
+{
+    int job_of_slot[64], fd_of_slot[64], pid_of_slot[64];
+    int next_job = 0, running = 0, slot, fd[2], child, status, len;
+    char buf[RESULT_SIZE];
+
+    if (jobs <= 0) jobs = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (jobs <= 0) jobs = 1;
+    if (jobs > 64) jobs = 64;
+    for (slot = 0; slot < jobs; ++slot) pid_of_slot[slot] = 0;
+    disable_sigpipe();
+
+    for (;;)
+    {
+        /* Hand out unplayed games to free slots */
+        for (slot = 0; slot < jobs && next_job < num_jobs; ++slot)
+        {
+            if (pid_of_slot[slot] != 0) continue;
+            while (next_job < num_jobs && done[next_job]) ++next_job;
+            if (next_job == num_jobs) break;
+            if (pipe(fd) != 0)
+            {
+                printf("Couldn't create pipe!\n");
+                exit(EXIT_FAILURE);
+            }
+            fflush(NULL);
+            if ((child = fork()) == -1)
+            {
+                printf("Couldn't fork!\n");
+                exit(EXIT_FAILURE);
+            }
+            if (child == 0)
+            {
+                close(fd[0]);
+                play(next_job, fd[1]);
+                exit(EXIT_FAILURE);
+            }
+            close(fd[1]);
+            job_of_slot[slot] = next_job++;
+            fd_of_slot[slot]  = fd[0];
+            pid_of_slot[slot] = child;
+            ++running;
+        }
+        if (running == 0) break;
+
+        /* Wait for any game to finish and collect its result */
+        if ((child = waitpid(-1, &status, 0)) == -1) break;
+        for (slot = 0; slot < jobs; ++slot)
+            if (pid_of_slot[slot] == child) break;
+        if (slot == jobs) continue;  /* not one of our games */
+
+        len = read(fd_of_slot[slot], buf, sizeof(buf) - 1);
+        buf[len > 0 ? len : 0] = '\0';
+        close(fd_of_slot[slot]);
+        pid_of_slot[slot] = 0;
+        --running;
+        finished(job_of_slot[slot], buf);
+    }
+}
+
+/* Tournament mode:
+
+   A tournament is described by a spec file with one directive per line:
+
+        maze <path>                 adds a maze
+        seed <value>                adds a seed
+        seeds <first> <last>        adds a range of seeds (inclusive)
+        player <name> <command>     defines a player program
+        game <name> [<name>]        adds a (one- or two-player) pairing
+
+   Blank lines and lines starting with `#' are ignored. Every pairing is played
+   on every maze with every seed; each game is equivalent to running:
+
+        arbiter --seed <seed> <maze> <player 1 command> [<player 2 command>]
+
+   Each finished game is appended to the results file as a line:
+
+        <maze> <seed> <player 1> <player 2 or -> <score 1> <score 2> <turns>
+
+   When the tournament is restarted, games already listed in the results file
+   are not played again, but their scores are included in the statistics.
+   (Lines with scores outside the range 0..1000 are ignored.)
+*/
+
+#define MAX_SEEDS   10000
+#define MAX_ENTRANTS   32
+#define MAX_PAIRINGS  256
+
+typedef struct Entrant
+{
+    char        name[64];
+    char        command[MAX_LINE];
+    ScoreStats  stats;
+} Entrant;
+
+typedef struct Tournament
+{
+    char    maze[MAX_MAZES][MAX_LINE];
+    int     seed[MAX_SEEDS];
+    Entrant entrant[MAX_ENTRANTS];
+    int     pairing[MAX_PAIRINGS][2];   /* entrant indices; -1 if absent */
+    int     num_mazes, num_seeds, num_entrants, num_pairings;
+    int     num_jobs, num_done;
+    bool    *done;
+    FILE    *fp_results;
+} Tournament;
+
+static Tournament tm;
+
+static void spec_error(const char *path, int line_no, const char *msg)
+{
+    printf("%s:%d: %s\n", path, line_no, msg);
+    exit(EXIT_FAILURE);
+}
+
+static int find_entrant(const char *name)
+{
+    int i;
+    for (i = 0; i < tm.num_entrants; ++i)
+        if (strcmp(tm.entrant[i].name, name) == 0) return i;
+    return -1;
+}
+
+static void load_spec(const char *path)
+{
+    char line[MAX_LINE], *cmd, *arg, *eol;
+    int line_no, first, last, n;
+    FILE *fp;
+
+    if ((fp = fopen(path, "rt")) == NULL)
+    {
+        printf("Couldn't open tournament spec `%s'!\n", path);
+        exit(EXIT_FAILURE);
+    }
+    for (line_no = 1; fgets(line, sizeof(line), fp) != NULL; ++line_no)
+    {
+        if ((eol = strchr(line, '\n')) != NULL) *eol = '\0';
+        cmd = strtok(line, " \t\v\r");
+        if (cmd == NULL || *cmd == '#') continue;
+
+        if (strcmp(cmd, "maze") == 0)
+        {
+            if ((arg = strtok(NULL, " \t\v\r")) == NULL)
+                spec_error(path, line_no, "missing maze path");
+            if (tm.num_mazes == MAX_MAZES)
+                spec_error(path, line_no, "too many mazes");
+            strcpy(tm.maze[tm.num_mazes++], arg);
+        }
+        else
+        if (strcmp(cmd, "seed") == 0 || strcmp(cmd, "seeds") == 0)
+        {
+            if ((arg = strtok(NULL, " \t\v\r")) == NULL)
+                spec_error(path, line_no, "missing seed");
+            first = last = atoi(arg);
+            if (cmd[4] == 's')
+            {
+                if ((arg = strtok(NULL, " \t\v\r")) == NULL)
+                    spec_error(path, line_no, "missing last seed");
+                last = atoi(arg);
+            }
+            for (n = first; n <= last; ++n)
+            {
+                if (tm.num_seeds == MAX_SEEDS)
+                    spec_error(path, line_no, "too many seeds");
+                tm.seed[tm.num_seeds++] = n;
+            }
+        }
+        else
+        if (strcmp(cmd, "player") == 0)
+        {
+            Entrant *e = &tm.entrant[tm.num_entrants];
+            if ((arg = strtok(NULL, " \t\v\r")) == NULL ||
+                strlen(arg) >= sizeof(e->name))
+                spec_error(path, line_no, "missing or invalid player name");
+            if (find_entrant(arg) != -1)
+                spec_error(path, line_no, "duplicate player name");
+            if (tm.num_entrants == MAX_ENTRANTS)
+                spec_error(path, line_no, "too many players");
+            strcpy(e->name, arg);
+            if ((arg = strtok(NULL, "")) == NULL)
+                spec_error(path, line_no, "missing player command");
+            strcpy(e->command, arg);
+            ++tm.num_entrants;
+        }
+        else
+        if (strcmp(cmd, "game") == 0)
+        {
+            int *pairing = tm.pairing[tm.num_pairings];
+            if (tm.num_pairings == MAX_PAIRINGS)
+                spec_error(path, line_no, "too many games");
+            for (n = 0; n < 2; ++n)
+            {
+                pairing[n] = -1;
+                if ((arg = strtok(NULL, " \t\v\r")) == NULL)
+                    continue;
+                if ((pairing[n] = find_entrant(arg)) == -1)
+                    spec_error(path, line_no, "undefined player");
+            }
+            if (pairing[0] == -1)
+                spec_error(path, line_no, "missing player name");
+            ++tm.num_pairings;
+        }
+        else
+        {
+            spec_error(path, line_no, "unknown directive");
+        }
+    }
+    fclose(fp);
+
+    tm.num_jobs = tm.num_pairings*tm.num_mazes*tm.num_seeds;
+    if (tm.num_jobs == 0)
+        spec_error(path, line_no, "no games to play");
+    tm.done = calloc(tm.num_jobs, sizeof(bool));
+    assert(tm.done != NULL);
+}
+
+/* Jobs are numbered pairing-major, then maze, then seed. */
+static int job_pairing(int job) { return job/tm.num_seeds/tm.num_mazes; }
+static int job_maze(int job)    { return job/tm.num_seeds%tm.num_mazes; }
+static int job_seed(int job)    { return tm.seed[job%tm.num_seeds]; }
+
+static const char *entrant_name(int i)
+{
+    return (i == -1) ? "-" : tm.entrant[i].name;
+}
+
+static void record_job(int job, const int final[2])
+{
+    const int *pairing = tm.pairing[job_pairing(job)];
+    int n;
+
+    tm.done[job] = true;
+    ++tm.num_done;
+    for (n = 0; n < 2; ++n)
+    {
+        if (pairing[n] != -1)
+            add_score(&tm.entrant[pairing[n]].stats, final[n]);
+    }
+}
+
+/* Reads results of previously played games and marks them as done. */
+static void load_results(const char *path)
+{
+    char maze[MAX_LINE], name[2][64];
+    int seed, final[2], turns, job, m, s, g;
+    FILE *fp;
+
+    if ((fp = fopen(path, "rt")) == NULL) return;
+    while (fscanf(fp, "%1023s %d %63s %63s %d %d %d", maze, &seed,
+                  name[0], name[1], &final[0], &final[1], &turns) == 7)
+    {
+        for (m = 0; m < tm.num_mazes; ++m)
+            if (strcmp(tm.maze[m], maze) == 0) break;
+        for (s = 0; s < tm.num_seeds; ++s)
+            if (tm.seed[s] == seed) break;
+        for (g = 0; g < tm.num_pairings; ++g)
+        {
+            if (strcmp(entrant_name(tm.pairing[g][0]), name[0]) == 0 &&
+                strcmp(entrant_name(tm.pairing[g][1]), name[1]) == 0) break;
+        }
+        if (m == tm.num_mazes || s == tm.num_seeds || g == tm.num_pairings)
+            continue;  /* not part of this tournament */
+        if (final[0] < 0 || final[0] > 1000 ||
+            final[1] < 0 || final[1] > 1000)
+            continue;  /* damaged; the game is played again */
+        job = (g*tm.num_mazes + m)*tm.num_seeds + s;
+        if (!tm.done[job]) record_job(job, final);
+    }
+    fclose(fp);
+}
+
+static void play_tournament_game(int job, int fd)
+{
+    const int *pairing = tm.pairing[job_pairing(job)];
+    char *commands[2];
+    int p, players = (pairing[1] == -1) ? 1 : 2;
+
+    for (p = 0; p < players; ++p)
+        commands[p] = tm.entrant[pairing[p]].command;
+    srand(job_seed(job));
+    play_in_child(fd, tm.maze[job_maze(job)], players, commands, NULL, 0);
+}
+
+static void tournament_game_finished(int job, const char *result)
+{
+    const int *pairing = tm.pairing[job_pairing(job)];
+    int final[2], turns;
+
+    if (sscanf(result, "%d %d %d", &final[0], &final[1], &turns) != 3)
+    {
+        printf("Game %s seed %d (%s vs %s) failed!\n",
+               tm.maze[job_maze(job)], job_seed(job),
+               entrant_name(pairing[0]), entrant_name(pairing[1]));
+        return;
+    }
+    fprintf(tm.fp_results, "%s %d %s %s %d %d %d\n",
+            tm.maze[job_maze(job)], job_seed(job),
+            entrant_name(pairing[0]), entrant_name(pairing[1]),
+            final[0], final[1], turns);
+    fflush(tm.fp_results);
+    store_result( tm.maze[job_maze(job)], job_seed(job),
+                  entrant_name(pairing[0]),
+                  (pairing[1] != -1) ? entrant_name(pairing[1]) : NULL,
+                  result );
+    record_job(job, final);
+    printf("[%d/%d] %s seed %d: %s %d", tm.num_done, tm.num_jobs,
+           tm.maze[job_maze(job)], job_seed(job),
+           entrant_name(pairing[0]), final[0]);
+    if (pairing[1] != -1)
+        printf(" - %s %d", entrant_name(pairing[1]), final[1]);
+    printf(" (after %d turns)\n", turns);
+}
+
+static int run_tournament(const char *spec_path, const char *results_path,
+                          int jobs)
+{
+    char default_results[MAX_LINE + 8];
+    int i;
+
+    load_spec(spec_path);
+    if (results_path == NULL)
+    {
+        sprintf(default_results, "%.*s.results", MAX_LINE - 1, spec_path);
+        results_path = default_results;
+    }
+    load_results(results_path);
+    if ((tm.fp_results = fopen(results_path, "at")) == NULL)
+    {
+        printf("Couldn't open results file `%s'!\n", results_path);
+        exit(EXIT_FAILURE);
+    }
+
+    printf("%d of %d games already played.\n", tm.num_done, tm.num_jobs);
+    run_pool( jobs, tm.num_jobs, tm.done,
+              play_tournament_game, tournament_game_finished );
+    fclose(tm.fp_results);
+
+    printf("------------------------------------------------\n");
+    print_stats_header("Player");
+    for (i = 0; i < tm.num_entrants; ++i)
+    {
+        if (tm.entrant[i].stats.games > 0)
+            print_stats(tm.entrant[i].name, &tm.entrant[i].stats);
+    }
+    return (tm.num_done == tm.num_jobs) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* Sweep mode:
+
+   Plays one game from every legal starting pose (every square and direction
+   with an opening behind the player, as in place_player) on each of the given
+   mazes. In a two-player sweep, the second player is placed randomly (at the
+   usual minimum distance) unless `--pairs' is given, in which case every
+   valid combination of starting poses is played instead. Poses from which no
+   valid opponent pose exists are skipped.
+
+   The score distribution over all poses is printed for each maze (and each
+   player), and if `--results' is given, the scores of each game are written
+   to the results file as a line:
+
+        <maze> <row> <col> <dir> [<row> <col> <dir>] <score 1> <score 2>
+               <turns>
+*/
+
+typedef struct Sweep
+{
+    char        maze[MAX_MAZES][MAX_LINE];
+    StartPose   *pose[MAX_MAZES];
+    int         num_poses[MAX_MAZES];
+    int         first_job[MAX_MAZES + 1];
+    ScoreStats  stats[MAX_MAZES][2];
+    int         num_mazes, num_players, num_jobs, num_done;
+    char        **commands;
+    bool        pairs, *skip;
+    FILE        *fp_results;
+} Sweep;
+
+static Sweep sw;
+
+static int pose_dist(const StartPose *a, const StartPose *b)
+{
+    const int dr = a->r - b->r, dc = a->c - b->c;
+    return dr*dr + dc*dc;
+}
+
+/* Enumerates the legal starting poses on maze `m'. */
+static void find_poses(int m)
+{
+    int r, c, dir, n = 0;
+
+    load_maze(sw.maze[m]);
+    sw.pose[m] = malloc(sizeof(StartPose)*HEIGHT*WIDTH*4);
+    assert(sw.pose[m] != NULL);
+    for (r = 0; r < HEIGHT; ++r)
+    {
+        for (c = 0; c < WIDTH; ++c)
+        {
+            for (dir = 0; dir < 4; ++dir)
+            {
+                if (WALL(&game.mm_master, r, c, TURN(dir, BACK)) == ABSENT)
+                {
+                    sw.pose[m][n].r   = r;
+                    sw.pose[m][n].c   = c;
+                    sw.pose[m][n].dir = (Dir)dir;
+                    ++n;
+                }
+            }
+        }
+    }
+    sw.num_poses[m] = n;
+}
+
+static int sweep_maze(int job)
+{
+    int m = 0;
+    while (job >= sw.first_job[m + 1]) ++m;
+    return m;
+}
+
+/* Determines the maze and starting poses of a game; returns the number of
+   fixed poses. */
+static int sweep_poses(int job, int *maze, StartPose poses[2])
+{
+    const int m = sweep_maze(job), n = sw.num_poses[m];
+    const int i = job - sw.first_job[m];
+
+    *maze = m;
+    if (sw.pairs)
+    {
+        poses[0] = sw.pose[m][i/n];
+        poses[1] = sw.pose[m][i%n];
+        return 2;
+    }
+    poses[0] = sw.pose[m][i];
+    return 1;
+}
+
+static void init_sweep(const char *mazes)
+{
+    char buf[MAX_MAZES*MAX_LINE], *path;
+    StartPose poses[2];
+    int m, job, i, n;
+
+    if (strlen(mazes) >= sizeof(buf)) usage();
+    strcpy(buf, mazes);
+    for (path = strtok(buf, ","); path != NULL; path = strtok(NULL, ","))
+    {
+        if (sw.num_mazes == MAX_MAZES || strlen(path) >= MAX_LINE) usage();
+        strcpy(sw.maze[sw.num_mazes++], path);
+    }
+
+    for (m = 0; m < sw.num_mazes; ++m)
+    {
+        find_poses(m);
+        n = sw.num_poses[m];
+        sw.first_job[m + 1] = sw.first_job[m] + (sw.pairs ? n*n : n);
+    }
+    sw.num_jobs = sw.first_job[sw.num_mazes];
+    sw.skip = calloc(sw.num_jobs, sizeof(bool));
+    assert(sw.skip != NULL);
+
+    if (sw.num_players < 2) return;
+    for (job = 0; job < sw.num_jobs; ++job)
+    {
+        if (sweep_poses(job, &m, poses) == 2)
+        {
+            sw.skip[job] = pose_dist(&poses[0], &poses[1]) < 17*17;
+        }
+        else
+        {
+            for (i = 0; i < sw.num_poses[m]; ++i)
+                if (pose_dist(&poses[0], &sw.pose[m][i]) >= 17*17) break;
+            sw.skip[job] = (i == sw.num_poses[m]);
+        }
     }
+}
+
+static void play_sweep_game(int job, int fd)
+{
+    StartPose poses[2];
+    int m, num_fixed = sweep_poses(job, &m, poses);
+
+    srand(job);
+    play_in_child( fd, sw.maze[m], sw.num_players, sw.commands,
+                   poses, num_fixed );
+}
+
+static void sweep_game_finished(int job, const char *result)
+{
+    StartPose poses[2];
+    int m, final[2], turns, p, num_fixed = sweep_poses(job, &m, poses);
+
+    if (sscanf(result, "%d %d %d", &final[0], &final[1], &turns) != 3)
+    {
+        printf("Game %s from (%d,%d,%d) failed!\n", sw.maze[m],
+               poses[0].r, poses[0].c, (int)poses[0].dir);
+        return;
+    }
+    for (p = 0; p < sw.num_players; ++p)
+        add_score(&sw.stats[m][p], final[p]);
+    if (sw.fp_results != NULL)
+    {
+        fprintf(sw.fp_results, "%s", sw.maze[m]);
+        for (p = 0; p < num_fixed; ++p)
+        {
+            fprintf(sw.fp_results, " %d %d %d",
+                    poses[p].r, poses[p].c, (int)poses[p].dir);
+        }
+        fprintf(sw.fp_results, " %d %d %d\n", final[0], final[1], turns);
+    }
+    /* Sweep games are seeded with their job number */
+    store_result( sw.maze[m], job, sw.commands[0],
+                  (sw.num_players > 1) ? sw.commands[1] : NULL, result );
+    if (++sw.num_done%100 == 0) printf("[%d games played]\n", sw.num_done);
+}
+
+static int run_sweep( const char *mazes, int players, char *commands[],
+                      bool pairs, const char *results_path, int jobs )
+{
+    char label[MAX_LINE + 32];
+    int m, p, n = 0;
+
+    sw.num_players = players;
+    sw.commands    = commands;
+    sw.pairs       = pairs && players > 1;  /* no pairs with one player */
+    init_sweep(mazes);
+    for (m = 0; m < sw.num_jobs; ++m) if (!sw.skip[m]) ++n;
+    printf("Playing %d games.\n", n);
+
+    if (results_path != NULL &&
+        (sw.fp_results = fopen(results_path, "wt")) == NULL)
+    {
+        printf("Couldn't open results file `%s'!\n", results_path);
+        exit(EXIT_FAILURE);
+    }
+    run_pool(jobs, sw.num_jobs, sw.skip, play_sweep_game, sweep_game_finished);
+    if (sw.fp_results != NULL) fclose(sw.fp_results);
+
     printf("------------------------------------------------\n");
+    print_stats_header("Maze");
+    for (m = 0; m < sw.num_mazes; ++m)
+    {
+        for (p = 0; p < players; ++p)
+        {
+            if (players == 1)
+                sprintf(label, "%s", sw.maze[m]);
+            else
+                sprintf(label, "%s (player %d)", sw.maze[m], p + 1);
+            print_stats(label, &sw.stats[m][p]);
+        }
+    }
+    return (sw.num_done == n) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main(int argc, char *argv[])
+{
+    char result[RESULT_SIZE];
+    int turns;
+
+    argc = initialize(argc, argv);
+    if (arg_tournament != NULL)
+        return run_tournament(arg_tournament, arg_results, arg_jobs);
+    if (arg_sweep)
+    {
+        return run_sweep( argv[1], argc - 2, argv + 2,
+                          arg_pairs, arg_results, arg_jobs );
+    }
 
-    if (num_players == 1)
+    turns = play_game();
+    if (game.num_players == 1)
     {
-        printf("Score: %d (after %d turns)\n", final_score(0, -1), t);
+        printf("Score: %d (after %d turns)\n",
+               ge_final_score(&game, 0), turns);
     }
     else  /* (num_players == 2) */
     {
-        if (t == 150*num_players) p = -1;  /* drawn */
-        printf("Score: %d - %d (after %d turns)\n", final_score(0, p), final_score(1, p), t);
+        printf("Score: %d - %d (after %d turns)\n",
+               ge_final_score(&game, 0),
+               ge_final_score(&game, 1), turns);
     }
+    store_result( argv[1], arg_seed, player_name[0], player_name[1],
+                  format_result(result, turns) );
     finalize();
     return 0;
 }
@@ -0,0 +1,346 @@
+#include "MazeIO.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Compares the table-driven compact codec of MazeIO.c (mm_encode_r() and
+   mm_decode()) with the straightforward implementation it replaced, which is
+   kept below as a reference. Both must produce identical descriptions for
+   maps derived from the given mazes (with random parts made unknown, and
+   random borders and poses), and identical maps (or failures) when decoding
+   those descriptions as well as random strings. The time per call is
+   reported for each; decoding includes mm_rehash(), which is timed on its
+   own as well. */
+
+#define MAX_MAPS    4096
+#define MAX_STRINGS (3*MAX_MAPS)
+
+static MazeMap maps[MAX_MAPS];
+static char strings[MAX_STRINGS][MM_ENCODE_SIZE];
+static int num_maps, num_strings;
+
+
+/* Reference implementation */
+
+static bool ref_decode(MazeMap *mm, const char *desc)
+{
+    char buf[512], *p;
+    int H, W, r, c, val, len, pass;
+
+    /* decode base-64 chars (into integers in range [0,64)) */
+    strncpy(buf, desc, sizeof(buf) - 1);
+    buf[sizeof(buf) - 1] = '\0';
+    for (p = buf; *p; ++p)
+    {
+        if (*p >= 'A' && *p <= 'Z') *p = *p - 'A' +  0;
+        else
+        if (*p >= 'a' && *p <= 'z') *p = *p - 'a' + 26;
+        else
+        if (*p >= '0' && *p <= '9') *p = *p - '0' + 52;
+        else
+        if (*p == '-')              *p =            62;
+        else
+        if (*p == '_')              *p =            63;
+        else
+            return false;  /* invalid char */
+    }
+
+    /* Parse first five fields */
+    mm_clear(mm);
+    H = buf[0];
+    W = buf[1];
+    if (H > HEIGHT) return false;
+    if (W > WIDTH)  return false;
+    mm->border.top    = 0;
+    mm->border.left   = 0;
+    mm->border.bottom = H%HEIGHT;
+    mm->border.right  = W%WIDTH;
+    if (buf[2] && buf[3]) {
+        mm->loc.r = buf[2] - 1;
+        mm->loc.c = buf[3] - 1;
+    }
+    if (mm->loc.r >= H) return false;
+    if (mm->loc.c >= W) return false;
+    mm->dir = (Dir)(buf[4]&3);
+    p = &buf[5];
+
+    /* Parse squares */
+    val = len = 0;
+    for (r = 0; r < H; ++r)
+    {
+        for (c = 0; c < W; ++c)
+        {
+            if (len == 0)
+            {
+                val = *p++;
+                len = 6;
+            }
+            mm->grid[r][c].square = (val%2) ? PRESENT : UNKNOWN;
+            val /= 2;
+            --len;
+        }
+    }
+
+    /* Parse walls */
+    val = len = 0;
+    for (pass = 0; pass < 2; ++pass)
+    {
+        for (r = 0; r < H + (pass == 0 ? 1 : 0); ++r)
+        {
+            for (c = 0; c < W + (pass == 0 ? 0 : 1); ++c)
+            {
+                if (len == 0)
+                {
+                    val = p[0] + 64*p[1] + 64*64*p[2] + 64*64*64*p[3];
+                    p += 4;
+                    len = 15;
+                }
+
+                if (pass == 0)
+                    mm->grid[r%HEIGHT][c].wall_n = val%3 - 1;
+                else /* pass == 1 */
+                    mm->grid[r][c%WIDTH].wall_w = val%3 - 1;
+
+                val /= 3;
+                --len;
+            }
+        }
+    }
+
+    mm_rehash(mm);
+    return true;
+}
+
+static char *ref_encode(const MazeMap *mm, bool full,
+                        char buf[MM_ENCODE_SIZE])
+{
+    const int top    = full ? 0 : mm->border.top;
+    const int left   = full ? 0 : mm->border.left;
+    const int bottom = full ? 0 : mm->border.bottom;
+    const int right  = full ? 0 : mm->border.right;
+
+    const int h = (bottom == top) ? HEIGHT : (bottom - top + HEIGHT)%HEIGHT;
+    const int w = (right == left) ? WIDTH : (right - left + WIDTH)%WIDTH;
+
+    char *p = buf;
+    int val, len, r, c, i, j, pass, n;
+
+    static const char *base64_digits = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdef"
+                                       "ghijklmnopqrstuvwxyz0123456789-_";
+
+    static const int pow3[15] = { 1, 3, 9, 27, 81, 243, 729, 2187, 6561, 19683,
+                                  59049, 177147, 531441, 1594323, 4782969 };
+
+
+    /* Encode first five fields: */
+    *p++ = base64_digits[h];
+    *p++ = base64_digits[w];
+    *p++ = base64_digits[1 + (mm->loc.r - top + HEIGHT)%HEIGHT];
+    *p++ = base64_digits[1 + (mm->loc.c - left + WIDTH)%WIDTH];
+    *p++ = base64_digits[(int)mm->dir];
+
+    /* Encode squares */
+    val = len = 0;
+    for (i = 0; i < h; ++i)
+    {
+        for (j = 0; j < w; ++j)
+        {
+            r = (top  + i)%HEIGHT;
+            c = (left + j)%WIDTH;
+            val |= SQUARE(mm, r, c) << len++;
+            if (len == 6)
+            {
+                *p++ = base64_digits[val];
+                val = len = 0;
+            }
+        }
+    }
+
+    if (len > 0)
+        *p++ = base64_digits[val];
+
+    /* Encode walls */
+    val = len = 0;
+    for (pass = 0; pass < 2; ++pass)
+    {
+        for (i = 0; i < h + (pass ? 0 : 1); ++i)
+        {
+            for (j = 0; j < w + (pass ? 1 : 0); ++j)
+            {
+                r = (top  + i)%HEIGHT;
+                c = (left + j)%WIDTH;
+                if (pass == 0)  /* horizontal walls */
+                    val += pow3[len++]*(mm->grid[r][c].wall_n + 1);
+                else  /* pass == 1: vertical walls */
+                    val += pow3[len++]*(mm->grid[r][c].wall_w + 1);
+                if (len == 15)
+                {
+                    for (n = 0; n < 4; ++n)
+                    {
+                        *p++ = base64_digits[val%64];
+                        val /= 64;
+                    }
+                    assert(val == 0);
+                    len = 0;
+                }
+            }
+        }
+    }
+    while (val > 0)
+    {
+        *p++ = base64_digits[val%64];
+        val /= 64;
+    }
+
+    *p = '\0';
+    return buf;
+}
+
+
+/* Test data */
+
+static int random_value()
+{
+    return rand()%3 - 1;
+}
+
+/* Adds a maze and variants of it with random parts unknown, and random
+   borders, locations and directions. */
+static void add_maps(const MazeMap *maze, int variants)
+{
+    MazeMap *mm;
+    int n, r, c;
+
+    for (n = 0; n <= variants && num_maps < MAX_MAPS; ++n)
+    {
+        mm = &maps[num_maps++];
+        *mm = *maze;
+        if (n == 0) continue;
+        for (r = 0; r < HEIGHT; ++r)
+        {
+            for (c = 0; c < WIDTH; ++c)
+            {
+                if (rand()%2) mm->grid[r][c].square = UNKNOWN;
+                if (rand()%2) mm->grid[r][c].wall_n = random_value();
+                if (rand()%2) mm->grid[r][c].wall_w = random_value();
+            }
+        }
+        mm->border.top    = rand()%HEIGHT;
+        mm->border.left   = rand()%WIDTH;
+        mm->border.bottom = rand()%HEIGHT;
+        mm->border.right  = rand()%WIDTH;
+        mm->loc.r = rand()%HEIGHT;
+        mm->loc.c = rand()%WIDTH;
+        mm->dir   = (Dir)(rand()%4);
+        mm_rehash(mm);
+    }
+}
+
+/* Adds a random string of base-64 digits, sometimes with another character
+   in it. */
+static void add_random_string()
+{
+    static const char digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdef"
+                                 "ghijklmnopqrstuvwxyz0123456789-_";
+    char *s = strings[num_strings++];
+    int len = rand()%(MM_ENCODE_SIZE - 1), i;
+
+    for (i = 0; i < len; ++i) s[i] = digits[rand()%64];
+    if (len > 0 && rand()%4 == 0) s[rand()%len] = (char)(1 + rand()%255);
+    s[len] = '\0';
+}
+
+static double elapsed(clock_t start, int ops)
+{
+    return 1e9*(clock() - start)/CLOCKS_PER_SEC/ops;
+}
+
+int main(int argc, char *argv[])
+{
+    static MazeMap maze, a, b;
+    char buf[2][MM_ENCODE_SIZE];
+    int i, n, rep, reps = 100, full, errors = 0, decoded;
+    clock_t start;
+    FILE *fp;
+
+    for (i = 1; i < argc; ++i)
+    {
+        if (memcmp(argv[i], "--reps=", 7) == 0)
+        {
+            reps = atoi(argv[i] + 7);
+            continue;
+        }
+        if ((fp = fopen(argv[i], "rt")) == NULL || !mm_scan(&maze, fp))
+        {
+            printf("Couldn't load maze from `%s'!\n", argv[i]);
+            exit(EXIT_FAILURE);
+        }
+        fclose(fp);
+        add_maps(&maze, 99);
+    }
+    if (num_maps == 0 || reps <= 0)
+    {
+        printf("usage: codecbench [--reps=<count>] <maze file>...\n");
+        exit(EXIT_FAILURE);
+    }
+
+    /* Check that both encoders produce the same descriptions */
+    for (n = 0; n < num_maps; ++n)
+    {
+        for (full = 0; full < 2; ++full)
+        {
+            ref_encode(&maps[n], full, buf[0]);
+            mm_encode_r(&maps[n], full, buf[1]);
+            if (strcmp(buf[0], buf[1]) != 0) ++errors;
+            strcpy(strings[num_strings++], buf[0]);
+        }
+    }
+    printf("%d maps encoded; %d mismatches.\n", num_maps, errors);
+
+    /* Check that both decoders produce the same maps */
+    decoded = num_strings;
+    while (num_strings < MAX_STRINGS) add_random_string();
+    for (n = 0; n < num_strings; ++n)
+    {
+        memset(&a, 0, sizeof(a));
+        memset(&b, 0, sizeof(b));
+        if (ref_decode(&a, strings[n]) != mm_decode(&b, strings[n]) ||
+            memcmp(&a, &b, sizeof(a)) != 0) ++errors;
+    }
+    printf("%d strings decoded; %d mismatches in total.\n", num_strings,
+           errors);
+
+    printf("%-24s %12s %12s\n", "Operation (ns)", "reference", "tables");
+
+    start = clock();
+    for (rep = 0; rep < reps; ++rep)
+        for (n = 0; n < num_maps; ++n)
+            ref_encode(&maps[n], false, buf[0]);
+    printf("%-24s %12.1f", "encode", elapsed(start, reps*num_maps));
+    start = clock();
+    for (rep = 0; rep < reps; ++rep)
+        for (n = 0; n < num_maps; ++n)
+            mm_encode_r(&maps[n], false, buf[1]);
+    printf(" %12.1f\n", elapsed(start, reps*num_maps));
+
+    start = clock();
+    for (rep = 0; rep < reps; ++rep)
+        for (n = 0; n < decoded; ++n)
+            ref_decode(&a, strings[n]);
+    printf("%-24s %12.1f", "decode", elapsed(start, reps*decoded));
+    start = clock();
+    for (rep = 0; rep < reps; ++rep)
+        for (n = 0; n < decoded; ++n)
+            mm_decode(&b, strings[n]);
+    printf(" %12.1f\n", elapsed(start, reps*decoded));
+
+    start = clock();
+    for (rep = 0; rep < reps; ++rep)
+        for (n = 0; n < num_maps; ++n)
+            mm_rehash(&maps[n]);
+    printf("%-24s %12.1f\n", "(rehash, in decode)",
+           elapsed(start, reps*num_maps));
+
+    return errors == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -1,19 +1,215 @@
+#define _POSIX_C_SOURCE 200112L
 #include "MazeIO.h"
+#include "MazePack.h"
+#include <pthread.h>
+#include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
+
+/* Stream mode (--stream):
+
+   Reads compact descriptions (one per line) and text mazes (concatenated), in
+   any mix, from standard input, and writes each one converted to the other
+   format, in input order: text mazes become compact descriptions (one line
+   each) and compact descriptions become text mazes. Anything that can't be
+   converted produces an empty line.
+
+   Input is read in batches of STREAM_BATCH records. While worker threads
+   convert one batch (each a contiguous slice of it, into a buffer of its
+   own), the main thread reads the next; the slices' output is then written
+   in order. */
+
+#define STREAM_BATCH    16384
+#define MAX_THREADS     64
+#define MAX_LINE        1024
+
+typedef struct Batch
+{
+    char    *text;              /* zero-terminated records */
+    size_t  len, capacity;
+    size_t  offset[STREAM_BATCH];
+    bool    is_text[STREAM_BATCH];  /* text maze, or compact description */
+    int     count;
+} Batch;
+
+typedef struct Slice
+{
+    const Batch *batch;
+    int         first, last;
+    char        *out;
+    size_t      len, capacity;
+    long        errors;
+} Slice;
 
 static MazeMap mm;
+static Batch batch[2];
+static Slice slice[MAX_THREADS];
+static char pending[MAX_LINE];  /* line read ahead, if not empty */
+
+static void append(char **buf, size_t *len, size_t *capacity,
+                   const char *data, size_t n)
+{
+    if (*len + n > *capacity)
+    {
+        size_t new_capacity = *capacity ? 2**capacity : 65536;
+        while (new_capacity < *len + n) new_capacity *= 2;
+        if ((*buf = realloc(*buf, new_capacity)) == NULL)
+        {
+            fprintf(stderr, "Out of memory!\n");
+            exit(EXIT_FAILURE);
+        }
+        *capacity = new_capacity;
+    }
+    memcpy(*buf + *len, data, n);
+    *len += n;
+}
+
+static bool read_line(char line[MAX_LINE])
+{
+    if (pending[0] != '\0')
+    {
+        strcpy(line, pending);
+        pending[0] = '\0';
+        return true;
+    }
+    return fgets(line, MAX_LINE, stdin) != NULL;
+}
+
+/* Reads up to STREAM_BATCH records; returns whether any were read. */
+static bool read_batch(Batch *b)
+{
+    char line[MAX_LINE];
+    bool row;
+
+    b->count = 0;
+    b->len   = 0;
+    while (b->count < STREAM_BATCH && read_line(line))
+    {
+        if (line[0] == '\n' || line[0] == '\r') continue;
+        b->offset[b->count] = b->len;
+        b->is_text[b->count] = line[0] == '+';
+        if (b->is_text[b->count])
+        {
+            /* Take lines of horizontal walls, alternating with rows of
+               squares, up to the first line of walls not followed by a
+               row. */
+            append(&b->text, &b->len, &b->capacity, line, strlen(line));
+            for (row = true; read_line(line); row = !row)
+            {
+                if (row ? strchr(" ?|", line[0]) == NULL : line[0] != '+')
+                {
+                    strcpy(pending, line);
+                    break;
+                }
+                append(&b->text, &b->len, &b->capacity, line, strlen(line));
+            }
+        }
+        else
+        {
+            append( &b->text, &b->len, &b->capacity,
+                    line, strcspn(line, "\r\n") );
+        }
+        append(&b->text, &b->len, &b->capacity, "", 1);
+        ++b->count;
+    }
+    return b->count > 0;
+}
+
+static void *convert_slice(void *arg)
+{
+    Slice *sl = arg;
+    const Batch *b = sl->batch;
+    char buf[MM_PRINT_SIZE];
+    const char *in;
+    MazeMap map;
+    int i;
+
+    for (i = sl->first; i < sl->last; ++i)
+    {
+        in = b->text + b->offset[i];
+        if (b->is_text[i] ? !mm_parse_unhashed(&map, in)
+                          : !mm_decode_unhashed(&map, in))
+        {
+            append(&sl->out, &sl->len, &sl->capacity, "\n", 1);
+            ++sl->errors;
+        }
+        else
+        if (b->is_text[i])
+        {
+            mm_encode_r(&map, false, buf);
+            append(&sl->out, &sl->len, &sl->capacity, buf, strlen(buf));
+            append(&sl->out, &sl->len, &sl->capacity, "\n", 1);
+        }
+        else
+        {
+            mm_print_r(&map, false, buf);
+            append(&sl->out, &sl->len, &sl->capacity, buf, strlen(buf));
+        }
+    }
+    return NULL;
+}
+
+static int stream(int threads)
+{
+    pthread_t thread[MAX_THREADS];
+    bool started[MAX_THREADS], more;
+    Batch *cur = &batch[0], *next = &batch[1], *tmp;
+    long errors = 0;
+    int t, n;
+
+    if (threads <= 0) threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (threads <= 0) threads = 1;
+    if (threads > MAX_THREADS) threads = MAX_THREADS;
+
+    for (more = read_batch(cur); more; cur = next, next = tmp)
+    {
+        n = (cur->count < threads) ? cur->count : threads;
+        for (t = 0; t < n; ++t)
+        {
+            slice[t].batch = cur;
+            slice[t].first = (int)((long)cur->count*t/n);
+            slice[t].last  = (int)((long)cur->count*(t + 1)/n);
+            slice[t].len   = 0;
+            started[t] = pthread_create( &thread[t], NULL,
+                                         convert_slice, &slice[t] ) == 0;
+        }
+        more = read_batch(next);
+        for (t = 0; t < n; ++t)
+        {
+            if (started[t])
+                pthread_join(thread[t], NULL);
+            else
+                convert_slice(&slice[t]);
+            fwrite(slice[t].out, 1, slice[t].len, stdout);
+            errors += slice[t].errors;
+            slice[t].errors = 0;
+        }
+        tmp = cur;
+    }
+    if (errors > 0)
+        fprintf(stderr, "%ld records couldn't be converted!\n", errors);
+    return (errors > 0) ? 1 : 0;
+}
 
 int main(int argc, const char *argv[])
 {
+    if (argc >= 2 && strcmp(argv[1], "--stream") == 0)
+    {
+        if (argc == 2) return stream(0);
+        if (argc == 3 && memcmp(argv[2], "--threads=", 10) == 0)
+            return stream(atoi(argv[2] + 10));
+    }
     if (argc != 2)
     {
         printf("usage:\n"
                "\tconvert <compact description>\n"
-               "\tconvert <file in human-readable format>\n");
+               "\tconvert <file in human-readable format>\n"
+               "\tconvert <maze pack>:<index>\n"
+               "\tconvert --stream [--threads=<count>]\n");
         return 1;
     }
 
-    if (mm_decode(&mm, argv[1]))
+    if (mp_load(&mm, argv[1]) || mm_decode(&mm, argv[1]))
     {
         mm_print(&mm, stdout, false);
     }
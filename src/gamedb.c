@@ -0,0 +1,499 @@
+#define _POSIX_C_SOURCE 200112L
+#include "GameEngine.h"
+#include "GameStore.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Queries and imports game summary stores (see GameStore.h).
+
+   `gamedb query' computes the number of games and the mean, minimum and
+   maximum of one column, grouped by up to MAX_KEYS other columns, over the
+   games that match all --where filters. Only the columns used are loaded.
+
+   `gamedb import' adds games from CSV logs written by the arbiter's --csv
+   option, which are parsed in parallel and added in the order given. The
+   logs don't record the maze, seed or players, so these are taken from
+   options. Final scores are reconstructed with ge_final_score(): a
+   two-player game that ended before the turn limit was won by the player
+   that made the last turn. (This holds for forfeited games too, since the
+   forfeiting turn isn't logged, unless no turn was logged for the opponent
+   yet.) */
+
+#define MAX_KEYS     4
+#define MAX_FILTERS  8
+
+typedef struct Group
+{
+    int     key[MAX_KEYS];
+    long    games;                  /* 0 if the slot is unused */
+    double  sum;
+    int     min, max;
+} Group;
+
+typedef struct Import
+{
+    const char  *path;
+    bool        ok;
+    GameRow     row;
+} Import;
+
+static GameTable gt;
+static int num_keys, key_column[MAX_KEYS], value_column = GS_FINAL1;
+static int num_filters, filter_column[MAX_FILTERS], filter_value[MAX_FILTERS];
+static Group *group;
+static int num_groups, group_capacity;      /* capacity is a power of two */
+
+static const char *import_maze, *import_player[2] = { "unknown", NULL };
+static int import_seed = -1;
+static Import *import;
+static int num_imports, next_import;
+static pthread_mutex_t import_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void usage()
+{
+    printf("usage:\n"
+           "\tgamedb query [--by=<column>[,<column>...]] [--value=<column>]\n"
+           "\t             [--where=<column>=<value>]... <store>\n"
+           "\tgamedb import [--threads=<count>] [--maze=<name>] "
+           "[--seed=<value>]\n"
+           "\t              [--players=<name>[,<name>]] <store> "
+           "<CSV file>...\n"
+           "\tgamedb columns\n");
+    exit(EXIT_FAILURE);
+}
+
+static int parse_column(const char *name)
+{
+    int c = gs_find_column(name);
+    if (c == -1)
+    {
+        printf("Unknown column `%s'! (see `gamedb columns')\n", name);
+        exit(EXIT_FAILURE);
+    }
+    return c;
+}
+
+static long time_us()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return 1000000L*ts.tv_sec + ts.tv_nsec/1000;
+}
+
+
+/* Queries */
+
+static unsigned long hash_key(const int key[MAX_KEYS])
+{
+    unsigned long h = 0;
+    int k;
+    for (k = 0; k < num_keys; ++k)
+        h = ((h ^ (unsigned long)key[k])*2654435761ul)&0xfffffffful;
+    return h ^ (h >> 15);
+}
+
+static void grow_groups()
+{
+    Group *old = group;
+    int old_capacity = group_capacity, i;
+    unsigned long j;
+
+    group_capacity = old_capacity ? 2*old_capacity : 256;
+    group = calloc(group_capacity, sizeof(Group));
+    if (group == NULL)
+    {
+        printf("Out of memory!\n");
+        exit(EXIT_FAILURE);
+    }
+    for (i = 0; i < old_capacity; ++i)
+    {
+        if (old[i].games == 0) continue;
+        for (j = hash_key(old[i].key); group[j&(group_capacity - 1)].games;
+             ++j) { }
+        group[j&(group_capacity - 1)] = old[i];
+    }
+    free(old);
+}
+
+/* Returns the group with the given key, adding it if necessary. */
+static Group *find_group(const int key[MAX_KEYS])
+{
+    Group *g;
+    unsigned long i;
+
+    for (i = hash_key(key); ; ++i)
+    {
+        g = &group[i&(group_capacity - 1)];
+        if (g->games == 0) break;
+        if (memcmp(g->key, key, sizeof(int)*num_keys) == 0) return g;
+    }
+    if (2*(num_groups + 1) > group_capacity)
+    {
+        grow_groups();
+        return find_group(key);
+    }
+    ++num_groups;
+    memcpy(g->key, key, sizeof(int)*num_keys);
+    return g;
+}
+
+static int cmp_group(const void *a, const void *b)
+{
+    const Group *g = a, *h = b;
+    int k, d;
+
+    for (k = 0; k < num_keys; ++k)
+    {
+        if (gs_is_name_column(key_column[k]))
+            d = strcmp(gt_name(&gt, g->key[k]), gt_name(&gt, h->key[k]));
+        else
+            d = (g->key[k] > h->key[k]) - (g->key[k] < h->key[k]);
+        if (d != 0) return d;
+    }
+    return 0;
+}
+
+static const int *load_column(int c)
+{
+    const int *values = gt_column(&gt, c);
+    if (values == NULL)
+    {
+        printf("Couldn't read column `%s'!\n", gs_column_names[c]);
+        exit(EXIT_FAILURE);
+    }
+    return values;
+}
+
+static void parse_filter(const char *arg)
+{
+    char name[64];
+    const char *eq = strchr(arg, '=');
+    int c;
+
+    if (eq == NULL || eq - arg >= (int)sizeof(name) ||
+        num_filters == MAX_FILTERS) usage();
+    memcpy(name, arg, eq - arg);
+    name[eq - arg] = '\0';
+    filter_column[num_filters] = c = parse_column(name);
+    if (!gs_is_name_column(c))
+        filter_value[num_filters] = atoi(eq + 1);
+    else
+    if (c == GS_PLAYER2 && strcmp(eq + 1, "-") == 0)
+        filter_value[num_filters] = GS_NO_PLAYER;
+    else
+    if ((filter_value[num_filters] = gt_find_name(&gt, eq + 1)) == -1)
+        filter_value[num_filters] = -2;     /* matches no games */
+    ++num_filters;
+}
+
+static int query(int argc, char *argv[])
+{
+    const int *key_values[MAX_KEYS], *filter_values[MAX_FILTERS], *values;
+    const char *store = NULL, *arg;
+    int key[MAX_KEYS], i, k, f, v, n;
+    long row, matched = 0, start;
+    Group *g;
+
+    for (i = 0; i < argc; ++i)
+        if (memcmp(argv[i], "--", 2) != 0) store = argv[i];
+    if (store == NULL) usage();
+    if (!gt_open(&gt, store))
+    {
+        printf("Couldn't open game store `%s'!\n", store);
+        exit(EXIT_FAILURE);
+    }
+
+    for (i = 0; i < argc; ++i)
+    {
+        if (memcmp(argv[i], "--by=", 5) == 0)
+        {
+            char buf[256], *name;
+            if (strlen(argv[i] + 5) >= sizeof(buf)) usage();
+            strcpy(buf, argv[i] + 5);
+            for (name = strtok(buf, ","); name != NULL;
+                 name = strtok(NULL, ","))
+            {
+                if (num_keys == MAX_KEYS) usage();
+                key_column[num_keys++] = parse_column(name);
+            }
+        }
+        else
+        if (memcmp(argv[i], "--value=", 8) == 0)
+            value_column = parse_column(argv[i] + 8);
+        else
+        if (memcmp(argv[i], "--where=", 8) == 0)
+            parse_filter(argv[i] + 8);
+        else
+        if (argv[i][0] == '-')
+            usage();
+    }
+
+    /* Scan */
+    start = time_us();
+    for (k = 0; k < num_keys; ++k) key_values[k] = load_column(key_column[k]);
+    for (f = 0; f < num_filters; ++f)
+        filter_values[f] = load_column(filter_column[f]);
+    values = load_column(value_column);
+    grow_groups();
+    for (k = num_keys; k < MAX_KEYS; ++k) key[k] = 0;
+    for (row = 0; row < gt.rows; ++row)
+    {
+        for (f = 0; f < num_filters; ++f)
+            if (filter_values[f][row] != filter_value[f]) break;
+        if (f < num_filters) continue;
+        for (k = 0; k < num_keys; ++k) key[k] = key_values[k][row];
+        g = find_group(key);
+        v = values[row];
+        if (g->games++ == 0 || v < g->min) g->min = v;
+        if (g->games == 1 || v > g->max) g->max = v;
+        g->sum += v;
+        ++matched;
+    }
+
+    /* Sort and print the groups */
+    for (i = n = 0; i < group_capacity; ++i)
+        if (group[i].games != 0) group[n++] = group[i];
+    qsort(group, n, sizeof(Group), cmp_group);
+    for (k = 0; k < num_keys; ++k)
+    {
+        arg = gs_column_names[key_column[k]];
+        printf(gs_is_name_column(key_column[k]) ? "%-24s " : "%8s ", arg);
+    }
+    printf("%8s %10s %8s %8s  (%s)\n", "Games", "Mean", "Min", "Max",
+           gs_column_names[value_column]);
+    for (i = 0; i < n; ++i)
+    {
+        for (k = 0; k < num_keys; ++k)
+        {
+            if (gs_is_name_column(key_column[k]))
+                printf("%-24s ", gt_name(&gt, group[i].key[k]));
+            else
+                printf("%8d ", group[i].key[k]);
+        }
+        printf("%8ld %10.2f %8d %8d\n", group[i].games,
+               group[i].sum/group[i].games, group[i].min, group[i].max);
+    }
+    printf("%ld of %ld games matched (%.2f ms)\n", matched, gt.rows,
+           (time_us() - start)/1000.0);
+    free(group);
+    gt_close(&gt);
+    return EXIT_SUCCESS;
+}
+
+
+/* Imports */
+
+/* Reads the whole file into memory, zero-terminated. */
+static char *read_file(const char *path)
+{
+    FILE *fp;
+    long size;
+    char *data = NULL;
+
+    if ((fp = fopen(path, "rb")) == NULL) return NULL;
+    if (fseek(fp, 0, SEEK_END) == 0 && (size = ftell(fp)) >= 0 &&
+        fseek(fp, 0, SEEK_SET) == 0 && (data = malloc(size + 1)) != NULL)
+    {
+        if (fread(data, 1, size, fp) == (size_t)size)
+        {
+            data[size] = '\0';
+        }
+        else
+        {
+            free(data);
+            data = NULL;
+        }
+    }
+    fclose(fp);
+    return data;
+}
+
+/* Summarizes a game from its CSV log. Returns false if the file couldn't be
+   read or is malformed. */
+static bool parse_csv(const char *path, GameRow *row)
+{
+    char *data = read_file(path), *p, *q;
+    int field[8], f, player, num_players = 0, last = -1;
+    bool quoted, ok;
+    Game game;
+
+    if (data == NULL) return false;
+    memset(&game, 0, sizeof(game));
+    memset(row, 0, sizeof(*row));
+
+    /* Skip the header; then read the first 8 fields of each record (up to
+       Total) and skip the rest, in which comments may contain (quoted)
+       newlines. */
+    ok = (p = strchr(data, '\n')) != NULL;
+    while (ok && *++p != '\0')
+    {
+        for (f = 0; f < 8; ++f)
+        {
+            field[f] = (int)strtol(p, &q, 10);
+            if (q == p || *q != ',') break;
+            p = q + 1;
+        }
+        player = field[1] - 1;
+        if (f < 8 || player < 0 || player > 1)
+        {
+            ok = false;
+            break;
+        }
+        if (player + 1 > num_players) num_players = player + 1;
+        row->moves[player]      += field[2];
+        row->discovered[player] += field[3];
+        row->first[player]      += field[4];
+        row->captures[player]   += field[5];
+        row->total[player]       = field[7];
+        if (field[0] > 0) ++row->turns;
+        last = player;
+
+        for (quoted = false; *p != '\0' && (quoted || *p != '\n'); ++p)
+            if (*p == '"') quoted = !quoted;
+        if (*p == '\0') break;
+    }
+    free(data);
+    if (!ok || num_players == 0) return false;
+
+    game.num_players = num_players;
+    game.winner = -1;
+    if (num_players == 2 && row->turns < 2*MAX_TURNS) game.winner = last;
+    for (player = 0; player < num_players; ++player)
+    {
+        game.score[player].moves         = row->moves[player];
+        game.score[player].sq_disc       = row->discovered[player];
+        game.score[player].sq_disc_first = row->first[player];
+        game.score[player].captures      = row->captures[player];
+        row->final[player] = ge_final_score(&game, player);
+    }
+    row->maze      = (import_maze != NULL) ? import_maze : path;
+    row->seed      = import_seed;
+    row->player[0] = import_player[0];
+    row->player[1] = (num_players > 1) ?
+                     (import_player[1] ? import_player[1] : "unknown") : NULL;
+    return true;
+}
+
+static void *import_worker(void *arg)
+{
+    int i;
+
+    (void)arg;
+    for (;;)
+    {
+        pthread_mutex_lock(&import_lock);
+        i = next_import++;
+        pthread_mutex_unlock(&import_lock);
+        if (i >= num_imports) break;
+        import[i].ok = parse_csv(import[i].path, &import[i].row);
+    }
+    return NULL;
+}
+
+static int import_csv(int argc, char *argv[])
+{
+    static char players[256];
+
+    pthread_t thread[64];
+    GameStore store;
+    const char *path = NULL;
+    int i, threads = 0, started, failed = 0;
+    long start = time_us();
+
+    if ((import = malloc(sizeof(Import)*(argc + 1))) == NULL)
+    {
+        printf("Out of memory!\n");
+        exit(EXIT_FAILURE);
+    }
+    for (i = 0; i < argc; ++i)
+    {
+        if (memcmp(argv[i], "--threads=", 10) == 0)
+            threads = atoi(argv[i] + 10);
+        else
+        if (memcmp(argv[i], "--maze=", 7) == 0)
+            import_maze = argv[i] + 7;
+        else
+        if (memcmp(argv[i], "--seed=", 7) == 0)
+            import_seed = atoi(argv[i] + 7);
+        else
+        if (memcmp(argv[i], "--players=", 10) == 0)
+        {
+            if (strlen(argv[i] + 10) >= sizeof(players)) usage();
+            import_player[0] = strtok(strcpy(players, argv[i] + 10), ",");
+            import_player[1] = strtok(NULL, ",");
+            if (import_player[0] == NULL) usage();
+        }
+        else
+        if (argv[i][0] == '-')
+            usage();
+        else
+        if (path == NULL)
+            path = argv[i];
+        else
+            import[num_imports++].path = argv[i];
+    }
+    if (path == NULL || num_imports == 0) usage();
+    if (!gs_open(&store, path))
+    {
+        printf("Couldn't open game store `%s'!\n", path);
+        exit(EXIT_FAILURE);
+    }
+
+    /* Parse in parallel, then append in order */
+    if (threads <= 0) threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (threads <= 0) threads = 1;
+    if (threads > 64) threads = 64;
+    if (threads > num_imports) threads = num_imports;
+    for (started = 0; started < threads; ++started)
+        if (pthread_create(&thread[started], NULL, import_worker, NULL) != 0)
+            break;
+    if (started == 0) import_worker(NULL);
+    for (i = 0; i < started; ++i) pthread_join(thread[i], NULL);
+
+    for (i = 0; i < num_imports; ++i)
+    {
+        if (import[i].ok)
+        {
+            gs_append(&store, &import[i].row);
+        }
+        else
+        {
+            printf("Couldn't import `%s'!\n", import[i].path);
+            ++failed;
+        }
+    }
+    if (!gs_close(&store))
+    {
+        printf("Couldn't write to game store `%s'!\n", path);
+        exit(EXIT_FAILURE);
+    }
+    printf("%d games imported (%d failed) in %.2f ms\n",
+           num_imports - failed, failed, (time_us() - start)/1000.0);
+    free(import);
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+int main(int argc, char *argv[])
+{
+    int c;
+
+    if (argc >= 2 && strcmp(argv[1], "query") == 0)
+        return query(argc - 2, argv + 2);
+    if (argc >= 2 && strcmp(argv[1], "import") == 0)
+        return import_csv(argc - 2, argv + 2);
+    if (argc == 2 && strcmp(argv[1], "columns") == 0)
+    {
+        for (c = 0; c < GS_NUM_COLUMNS; ++c)
+        {
+            printf("%s%s\n", gs_column_names[c],
+                   gs_is_name_column(c) ? " (name)" : "");
+        }
+        return EXIT_SUCCESS;
+    }
+    usage();
+    return EXIT_FAILURE;
+}
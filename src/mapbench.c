@@ -0,0 +1,412 @@
+#include "Analysis.h"
+#include "MazeBits.h"
+#include "MazeGrid.h"
+#include "MazeInfer.h"
+#include "MazeIO.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Compares the MazeMap and MazeBits representations on maps taken from
+   simulated games: both must infer exactly the same map, and the time taken
+   for counting squares, reading walls and inference is reported for each.
+   The simulated games also compare mm_infer() with incremental inference
+   (mi_infer()) on every turn, and the C kernels with their template
+   instances from MazeGrid.hpp (which must produce the same maps, journals,
+   distances and turns). Finally, the breadth-first search of find_distance()
+   is compared with its bit-parallel version (mb_find_distance()). */
+
+#define MAX_SNAPSHOTS 4096
+#define SIGHT_LEN ((WIDTH > HEIGHT ? WIDTH : HEIGHT) + 2)
+
+static MazeMap mm_master, snapshot[MAX_SNAPSHOTS];
+static MazeBits bits[MAX_SNAPSHOTS];
+static int num_snapshots, incremental_errors, kernel_errors;
+static clock_t infer_time[2];
+
+static void line_of_sight(const MazeMap *mm, Dir front, char *p)
+{
+    Dir left = TURN(front, LEFT), right = TURN(front, RIGHT);
+    int r = mm->loc.r, c = mm->loc.c;
+
+    while (WALL(&mm_master, r, c, front) == ABSENT)
+    {
+        bool open_left, open_right;
+        r = RDR(r, front);
+        c = CDC(c, front);
+        open_left  = WALL(&mm_master, r, c, left)  == ABSENT;
+        open_right = WALL(&mm_master, r, c, right) == ABSENT;
+        if (open_left)
+            *p++ = open_right ? 'B' : 'L';
+        else
+            *p++ = open_right ? 'R' : 'N';
+    }
+    *p++ = 'W';
+    *p   = '\0';
+}
+
+static bool same_map(const MazeMap *a, const MazeMap *b)
+{
+    return memcmp(a->grid, b->grid, sizeof(a->grid)) == 0 &&
+           a->loc.r == b->loc.r && a->loc.c == b->loc.c && a->dir == b->dir &&
+           memcmp(&a->border, &b->border, sizeof(Rect)) == 0 &&
+           a->hash == b->hash;
+}
+
+static bool same_journal(const MazeJournal *a, const MazeJournal *b)
+{
+    return a->size == b->size && a->incomplete == b->incomplete &&
+           memcmp(a->entry, b->entry, sizeof(a->entry[0])*a->size) == 0;
+}
+
+/* Looks in all four directions on both a MazeMap and its copy using the C
+   and template kernels, and checks that both change in the same way. */
+static void look_around(MazeMap *mm, MazeMap *mm_grid)
+{
+    static MazeJournal journal[2];
+    char sight[SIGHT_LEN], sight_grid[SIGHT_LEN];
+    int rel_dir;
+
+    mm_set_journal(mm, &journal[0]);
+    mm_set_journal(mm_grid, &journal[1]);
+    for (rel_dir = 0; rel_dir < 4; ++rel_dir)
+    {
+        line_of_sight(mm, TURN(mm->dir, rel_dir), sight);
+        mmg_line_of_sight(&mm_master, mm->loc.r, mm->loc.c,
+                          TURN(mm->dir, rel_dir), sight_grid);
+        if (strcmp(sight, sight_grid) != 0) ++kernel_errors;
+        mm_look(mm, sight, (RelDir)rel_dir);
+        mmg_look(mm_grid, sight, (RelDir)rel_dir);
+    }
+    if (!same_map(mm, mm_grid) ||
+        !same_journal(&journal[0], &journal[1])) ++kernel_errors;
+    mm_set_journal(mm, NULL);
+    mm_set_journal(mm_grid, NULL);
+}
+
+/* Takes a random walk through the master maze, recording the player's map
+   before inference on every turn. */
+static void simulate(int turns)
+{
+    static const char moves[4] = { 'F', 'R', 'T', 'L' };
+    static MazeInference mi;
+    MazeMap mm, mm_incremental, mm_grid;
+    char sight[SIGHT_LEN];
+    clock_t start;
+    int r, c, dir, turn, n, rel_dir;
+
+    do {
+        r   = rand()%HEIGHT;
+        c   = rand()%WIDTH;
+        dir = rand()%4;
+    } while (WALL(&mm_master, r, c, TURN(dir, BACK)) != ABSENT);
+    mm_initialize(&mm, r, c, (Dir)dir);
+    mm_incremental = mm_grid = mm;
+    mi_reset(&mi);
+
+    for (turn = 0; turn < turns && num_snapshots < MAX_SNAPSHOTS; ++turn)
+    {
+        for (rel_dir = 0; rel_dir < 4; ++rel_dir)
+        {
+            line_of_sight(&mm, TURN(mm.dir, rel_dir), sight);
+            mm_look(&mm_incremental, sight, (RelDir)rel_dir);
+        }
+        look_around(&mm, &mm_grid);
+        snapshot[num_snapshots++] = mm;
+        start = clock();
+        mm_infer(&mm);
+        infer_time[0] += clock() - start;
+        start = clock();
+        mi_infer(&mi, &mm_incremental);
+        infer_time[1] += clock() - start;
+        if (memcmp(mm.grid, mm_incremental.grid, sizeof(mm.grid)) != 0)
+            ++incremental_errors;
+        mmg_infer(&mm_grid);
+        if (!same_map(&mm, &mm_grid)) ++kernel_errors;
+
+        /* Walk a few steps in random open directions */
+        for (n = 1 + rand()%8; n > 0; --n)
+        {
+            do rel_dir = rand()%4;
+            while (WALL(&mm_master, mm.loc.r, mm.loc.c,
+                        TURN(mm.dir, rel_dir)) != ABSENT);
+            mm_move(&mm, moves[rel_dir]);
+            mm_move(&mm_incremental, moves[rel_dir]);
+            mm_move(&mm_grid, moves[rel_dir]);
+        }
+    }
+}
+
+static double elapsed(clock_t start, int ops)
+{
+    return 1e9*(clock() - start)/CLOCKS_PER_SEC/ops;
+}
+
+/* Finds the reachable square furthest from the player. */
+static Point furthest(int dist[HEIGHT][WIDTH])
+{
+    Point p = { 0, 0 };
+    int r, c;
+
+    for (r = 0; r < HEIGHT; ++r)
+    {
+        for (c = 0; c < WIDTH; ++c)
+        {
+            if (dist[r][c] > dist[p.r][p.c])
+                p.r = r, p.c = c;
+        }
+    }
+    return p;
+}
+
+/* Checks that the bit-parallel search finds the same distances as
+   find_distance() on all (inferred) snapshots, and times both, with and
+   without converting the map first. Returns the number of mismatches. */
+static int compare_distances(int reps)
+{
+    static MazeMap inferred[MAX_SNAPSHOTS];
+    static MazeBits mb, inferred_bits[MAX_SNAPSHOTS];
+    static int dist[2][HEIGHT][WIDTH];
+    int n, rep, errors = 0;
+    clock_t start;
+
+    for (n = 0; n < num_snapshots; ++n)
+    {
+        inferred[n] = snapshot[n];
+        mm_infer(&inferred[n]);
+        mb_load(&inferred_bits[n], &inferred[n]);
+        find_distance(&inferred[n], dist[0], inferred[n].loc.r,
+                      inferred[n].loc.c);
+        mb_find_distance(&inferred_bits[n], dist[1], inferred[n].loc.r,
+                         inferred[n].loc.c);
+        if (memcmp(dist[0], dist[1], sizeof(dist[0])) != 0) ++errors;
+    }
+
+    start = clock();
+    for (rep = 0; rep < reps; ++rep)
+        for (n = 0; n < num_snapshots; ++n)
+            find_distance(&inferred[n], dist[0], inferred[n].loc.r,
+                          inferred[n].loc.c);
+    printf("%-24s %12.1f", "find distance", elapsed(start, reps*num_snapshots));
+    start = clock();
+    for (rep = 0; rep < reps; ++rep)
+        for (n = 0; n < num_snapshots; ++n)
+            mb_find_distance(&inferred_bits[n], dist[1], inferred[n].loc.r,
+                             inferred[n].loc.c);
+    printf(" %12.1f\n", elapsed(start, reps*num_snapshots));
+    start = clock();
+    for (rep = 0; rep < reps; ++rep)
+    {
+        for (n = 0; n < num_snapshots; ++n)
+        {
+            mb_load(&mb, &inferred[n]);
+            mb_find_distance(&mb, dist[1], mb.loc.r, mb.loc.c);
+        }
+    }
+    printf("%-24s %12s %12.1f\n", "distance w/ conversion", "",
+           elapsed(start, reps*num_snapshots));
+    printf("Bit-parallel distances: %d mismatches.\n", errors);
+
+    return errors;
+}
+
+/* Checks that the template kernels infer the same maps (with the same
+   journals), distances and turns as the C kernels on all snapshots, and
+   times both. Returns the number of mismatches. */
+static int compare_kernels(int reps)
+{
+    static MazeMap a, b;
+    static MazeJournal journal[2];
+    static int dist[2][HEIGHT][WIDTH];
+    static Point path[2][HEIGHT*WIDTH];
+    static char turn[2][HEIGHT*WIDTH];
+    int n, rep, len[2], errors = 0;
+    clock_t start;
+    Point p;
+
+    for (n = 0; n < num_snapshots; ++n)
+    {
+        a = b = snapshot[n];
+        mm_set_journal(&a, &journal[0]);
+        mm_set_journal(&b, &journal[1]);
+        mm_infer(&a);
+        mmg_infer(&b);
+        if (!same_map(&a, &b) || !same_journal(&journal[0], &journal[1]))
+            ++errors;
+
+        find_distance(&a, dist[0], a.loc.r, a.loc.c);
+        mmg_find_distance(&b, dist[1], b.loc.r, b.loc.c);
+        if (memcmp(dist[0], dist[1], sizeof(dist[0])) != 0) ++errors;
+
+        p = furthest(dist[0]);
+        construct_turn_r(&a, dist[0], a.loc.r, a.loc.c, a.dir, p.r, p.c,
+                         path[0], turn[0], &len[0]);
+        mmg_construct_turn_r(&b, dist[1], b.loc.r, b.loc.c, b.dir, p.r, p.c,
+                             path[1], turn[1], &len[1]);
+        if (strcmp(turn[0], turn[1]) != 0 ||
+            len[0] != len[1] ||
+            memcmp(path[0], path[1], sizeof(Point)*(len[0] + 1)) != 0)
+            ++errors;
+    }
+    printf("Template kernels: %d mismatches.\n", errors + kernel_errors);
+
+    printf("%-24s %12s %12s\n", "Kernel (ns)", "C", "Template");
+
+    start = clock();
+    for (rep = 0; rep < reps; ++rep)
+    {
+        for (n = 0; n < num_snapshots; ++n)
+        {
+            a = snapshot[n];
+            mm_infer(&a);
+        }
+    }
+    printf("%-24s %12.1f", "infer", elapsed(start, reps*num_snapshots));
+    start = clock();
+    for (rep = 0; rep < reps; ++rep)
+    {
+        for (n = 0; n < num_snapshots; ++n)
+        {
+            a = snapshot[n];
+            mmg_infer(&a);
+        }
+    }
+    printf(" %12.1f\n", elapsed(start, reps*num_snapshots));
+
+    start = clock();
+    for (rep = 0; rep < reps; ++rep)
+        for (n = 0; n < num_snapshots; ++n)
+            find_distance(&snapshot[n], dist[0], snapshot[n].loc.r,
+                          snapshot[n].loc.c);
+    printf("%-24s %12.1f", "find distance",
+           elapsed(start, reps*num_snapshots));
+    start = clock();
+    for (rep = 0; rep < reps; ++rep)
+        for (n = 0; n < num_snapshots; ++n)
+            mmg_find_distance(&snapshot[n], dist[0], snapshot[n].loc.r,
+                              snapshot[n].loc.c);
+    printf(" %12.1f\n", elapsed(start, reps*num_snapshots));
+
+    return errors + kernel_errors;
+}
+
+int main(int argc, char *argv[])
+{
+    static MazeMap mm;
+    static MazeBits mb;
+    int i, n, rep, reps = 100, r, c, dir, sum1, sum2, errors = 0;
+    clock_t start;
+    FILE *fp;
+
+    for (i = 1; i < argc; ++i)
+    {
+        if (memcmp(argv[i], "--reps=", 7) == 0)
+        {
+            reps = atoi(argv[i] + 7);
+            continue;
+        }
+        if ((fp = fopen(argv[i], "rt")) == NULL || !mm_scan(&mm_master, fp))
+        {
+            printf("Couldn't load maze from `%s'!\n", argv[i]);
+            exit(EXIT_FAILURE);
+        }
+        fclose(fp);
+        for (n = 0; n < 8; ++n) simulate(100);
+    }
+    if (num_snapshots == 0 || reps <= 0)
+    {
+        printf("usage: mapbench [--reps=<count>] <maze file>...\n");
+        exit(EXIT_FAILURE);
+    }
+
+    /* Check that both representations infer the same maps */
+    for (n = 0; n < num_snapshots; ++n)
+    {
+        MazeMap a = snapshot[n], b = snapshot[n];
+        mm_infer(&a);
+        mb_load(&mb, &b);
+        mb_infer(&mb);
+        mb_store(&mb, &b);
+        if (!same_map(&a, &b) ||
+            mm_count_squares(&a) != mb_count_squares(&mb)) ++errors;
+    }
+    printf("%d maps checked; %d mismatches.\n", num_snapshots, errors);
+    printf("Incremental inference: %d mismatches; %.1f ns vs. %.1f ns "
+           "per turn.\n", incremental_errors,
+           1e9*infer_time[0]/CLOCKS_PER_SEC/num_snapshots,
+           1e9*infer_time[1]/CLOCKS_PER_SEC/num_snapshots);
+    errors += incremental_errors;
+
+    for (n = 0; n < num_snapshots; ++n) mb_load(&bits[n], &snapshot[n]);
+    printf("%-24s %12s %12s\n", "Operation (ns)", "MazeMap", "MazeBits");
+
+    start = clock();
+    for (sum1 = rep = 0; rep < reps; ++rep)
+        for (n = 0; n < num_snapshots; ++n)
+            sum1 += mm_count_squares(&snapshot[n]);
+    printf("%-24s %12.1f", "count squares",
+           elapsed(start, reps*num_snapshots));
+    start = clock();
+    for (sum2 = rep = 0; rep < reps; ++rep)
+        for (n = 0; n < num_snapshots; ++n)
+            sum2 += mb_count_squares(&bits[n]);
+    printf(" %12.1f\n", elapsed(start, reps*num_snapshots));
+    assert(sum1 == sum2);
+
+    start = clock();
+    for (sum1 = n = 0; n < num_snapshots; ++n)
+        for (r = 0; r < HEIGHT; ++r)
+            for (c = 0; c < WIDTH; ++c)
+                for (dir = 0; dir < 4; ++dir)
+                    sum1 += WALL(&snapshot[n], r, c, dir);
+    printf("%-24s %12.1f", "read all walls", elapsed(start, num_snapshots));
+    start = clock();
+    for (sum2 = n = 0; n < num_snapshots; ++n)
+        for (r = 0; r < HEIGHT; ++r)
+            for (c = 0; c < WIDTH; ++c)
+                for (dir = 0; dir < 4; ++dir)
+                    sum2 += MB_WALL(&bits[n], r, c, dir);
+    printf(" %12.1f\n", elapsed(start, num_snapshots));
+    assert(sum1 == sum2);
+
+    start = clock();
+    for (rep = 0; rep < reps; ++rep)
+    {
+        for (n = 0; n < num_snapshots; ++n)
+        {
+            mm = snapshot[n];
+            mm_infer(&mm);
+        }
+    }
+    printf("%-24s %12.1f", "infer", elapsed(start, reps*num_snapshots));
+    start = clock();
+    for (rep = 0; rep < reps; ++rep)
+    {
+        for (n = 0; n < num_snapshots; ++n)
+        {
+            mb = bits[n];
+            mb_infer(&mb);
+        }
+    }
+    printf(" %12.1f\n", elapsed(start, reps*num_snapshots));
+
+    start = clock();
+    for (rep = 0; rep < reps; ++rep)
+    {
+        for (n = 0; n < num_snapshots; ++n)
+        {
+            mm = snapshot[n];
+            mb_load(&mb, &mm);
+            mb_infer(&mb);
+            mb_store(&mb, &mm);
+        }
+    }
+    printf("%-24s %12s %12.1f\n", "infer with conversion", "",
+           elapsed(start, reps*num_snapshots));
+
+    errors += compare_distances(reps);
+    errors += compare_kernels(reps);
+
+    return errors == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
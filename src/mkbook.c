@@ -0,0 +1,140 @@
+#include "AI.h"
+#include "GameEngine.h"
+#include "OpeningBook.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Builds an opening book (see OpeningBook.h) by self-play: plays games
+   between copies of the built-in AI, as selfplay does, and records the turn
+   picked in each of the first few turns of every player, keyed by the hash
+   of the player's map at the time. Since the book is built offline, the AI
+   can be given more time to plan (with --plan-time) than during a game. */
+
+typedef struct BookPlayer
+{
+    MazeMap         mm;
+    MazeJournal     journal;
+    MazeInference   mi;
+    MazeDistance    md;
+    AIContext       ai;
+} BookPlayer;
+
+static Game game[16];
+static BookPlayer player[2];
+static BookWriter book;
+static int book_turns = 3;
+static long plan_time, added, rejected;
+
+/* Plays the first `book_turns' turns of each player in a game, adding them
+   to the book. */
+static void play(Game *g, int num_players)
+{
+    const char *lines[4];
+    const char *turn;
+    BookPlayer *pl;
+    int p;
+
+    ge_init(g, num_players, NULL, 0);
+    for (p = 0; p < num_players; ++p)
+    {
+        mm_initialize(&player[p].mm, 0, 0, NORTH);
+        mm_set_journal(&player[p].mm, &player[p].journal);
+        mi_reset(&player[p].mi);
+        md_reset(&player[p].md);
+        player[p].ai.md = &player[p].md;
+        player[p].ai.plan_time = plan_time;
+        bt_reset(&player[p].ai.belief, BT_MAX_MOVES);
+    }
+    while (!g->over && g->turn_no < book_turns*num_players)
+    {
+        p  = ge_player(g);
+        pl = &player[p];
+        ge_observe(g, p, lines);
+        mm_look(&pl->mm, lines[0], FRONT);
+        mm_look(&pl->mm, lines[1], RIGHT);
+        mm_look(&pl->mm, lines[2], BACK);
+        mm_look(&pl->mm, lines[3], LEFT);
+        mi_infer(&pl->mi, &pl->mm);
+        turn = pick_move_r(&pl->mm, ge_player_dist(g), &pl->ai);
+        if (book_add(&book, pl->mm.hash, turn))
+            ++added;
+        else
+            ++rejected;
+        mm_journal_reset(&pl->journal);
+        mm_turn(&pl->mm, turn);
+        if (!ge_step(g, turn)) break;
+    }
+}
+
+static void usage()
+{
+    printf("usage: mkbook [--games=<count>] [--players=<1|2>] "
+           "[--seed=<seed>]\n"
+           "              [--turns=<count>] [--slots=<count>] "
+           "[--plan-time=<ms>]\n"
+           "              <book file> <maze file>...\n");
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char *argv[])
+{
+    int i, n, num_mazes = 0, games = 1000, players = 2;
+    long slots = 65536;
+    const char *path = NULL;
+
+    for (i = 1; i < argc; ++i)
+    {
+        if (memcmp(argv[i], "--games=", 8) == 0)
+            games = atoi(argv[i] + 8);
+        else
+        if (memcmp(argv[i], "--players=", 10) == 0)
+            players = atoi(argv[i] + 10);
+        else
+        if (memcmp(argv[i], "--seed=", 7) == 0)
+            srand(atoi(argv[i] + 7));
+        else
+        if (memcmp(argv[i], "--turns=", 8) == 0)
+            book_turns = atoi(argv[i] + 8);
+        else
+        if (memcmp(argv[i], "--slots=", 8) == 0)
+            slots = atol(argv[i] + 8);
+        else
+        if (memcmp(argv[i], "--plan-time=", 12) == 0)
+            plan_time = atol(argv[i] + 12);
+        else
+        if (path == NULL)
+            path = argv[i];
+        else
+        if (num_mazes == (int)(sizeof(game)/sizeof(*game)))
+        {
+            printf("Too many mazes!\n");
+            exit(EXIT_FAILURE);
+        }
+        else
+        if (!ge_load_maze(&game[num_mazes++], argv[i]))
+        {
+            printf("Couldn't load maze from `%s'!\n", argv[i]);
+            exit(EXIT_FAILURE);
+        }
+    }
+    if (num_mazes == 0 || games <= 0 || players < 1 || players > 2 ||
+        book_turns < 1 || slots < 1) usage();
+
+    if (!book_create(&book, slots))
+    {
+        printf("Couldn't allocate %ld slots!\n", slots);
+        exit(EXIT_FAILURE);
+    }
+    for (n = 0; n < games; ++n) play(&game[n%num_mazes], players);
+    if (!book_save(&book, path))
+    {
+        printf("Couldn't write book to `%s'!\n", path);
+        exit(EXIT_FAILURE);
+    }
+    printf("%ld turns recorded: %lu distinct states in %lu slots "
+           "(%ld turns rejected)\n", added, book.count, book.num_slots,
+           rejected);
+    book_free(&book);
+    return 0;
+}
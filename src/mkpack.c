@@ -0,0 +1,88 @@
+#include "MazeIO.h"
+#include "MazePack.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Builds a maze pack (see MazePack.h) from mazes in the formats described in
+   doc/maze-encoding.txt: each argument is a compact description, a file in
+   the human-readable format, or `-' to read compact descriptions from
+   standard input, one per line. Mazes are numbered in the order given. */
+
+static MazePackWriter pack;
+static MazeMap mm;
+static int rejected;
+
+static void add(const char *what)
+{
+    if (!mp_add(&pack, &mm))
+    {
+        printf("Maze %s is incomplete; skipped.\n", what);
+        ++rejected;
+    }
+}
+
+static void add_stdin()
+{
+    char line[MM_ENCODE_SIZE + 2], *eol;
+    long line_no;
+
+    for (line_no = 1; fgets(line, sizeof(line), stdin) != NULL; ++line_no)
+    {
+        if ((eol = strchr(line, '\n')) != NULL) *eol = '\0';
+        if (line[0] == '\0') continue;
+        if (!mm_decode(&mm, line))
+        {
+            printf("Couldn't decode line %ld of standard input!\n", line_no);
+            exit(EXIT_FAILURE);
+        }
+        add(line);
+    }
+}
+
+static void add_arg(const char *arg)
+{
+    FILE *fp;
+
+    if (!mm_decode(&mm, arg))
+    {
+        if ((fp = fopen(arg, "rt")) == NULL || !mm_scan(&mm, fp))
+        {
+            printf("Couldn't read maze from `%s'!\n", arg);
+            exit(EXIT_FAILURE);
+        }
+        fclose(fp);
+    }
+    add(arg);
+}
+
+int main(int argc, char *argv[])
+{
+    int i;
+
+    if (argc < 3)
+    {
+        printf("usage: mkpack <pack file> <maze>...\n"
+               "\t<maze> is a compact description, a file in "
+               "human-readable format,\n"
+               "\tor `-' to read compact descriptions from standard "
+               "input\n");
+        return 1;
+    }
+
+    mp_create(&pack);
+    for (i = 2; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "-") == 0)
+            add_stdin();
+        else
+            add_arg(argv[i]);
+    }
+    if (!mp_save(&pack, argv[1]))
+    {
+        printf("Couldn't write maze pack to `%s'!\n", argv[1]);
+        exit(EXIT_FAILURE);
+    }
+    printf("%d mazes packed (%d skipped)\n", pack.count, rejected);
+    mp_free(&pack);
+    return 0;
+}
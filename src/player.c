@@ -1,4 +1,5 @@
-#include "Analysis.h"
+#include "AI.h"
+#include "MazeInfer.h"
 #include <stdio.h>
 #include <assert.h>
 #include <string.h>
@@ -6,9 +7,15 @@
 #include <ctype.h>
 
 static MazeMap mm;
+static MazeJournal journal;
+static MazeInference mi;
+static MazeDistance md;
+static AIContext ai;
+static Pursuit pursuit;
+static OpeningBook book;
 static int distsq;
-
-extern const char *pick_move(MazeMap *mm, int distsq);
+static int opponent_moves = BT_MAX_MOVES;
+static long pursuit_time;
 
 static char *get_line(bool remove)
 {
@@ -60,11 +67,68 @@ static void write_output(const char *move)
     fflush(stdout);
 }
 
-int main()
+static void open_book(const char *path)
+{
+    if (!book_open(&book, path))
+    {
+        fprintf(stderr, "Could not open opening book `%s'!\n", path);
+        exit(EXIT_FAILURE);
+    }
+    ai.book = &book;
+}
+
+static void parse_options(int argc, char *argv[])
+{
+    int i;
+    for (i = 1; i < argc; ++i)
+    {
+        if (memcmp(argv[i], "--plan-time=", 12) == 0)
+            ai.plan_time = atol(argv[i] + 12);
+        else
+        if (strcmp(argv[i], "--plan-time") == 0 && ++i < argc)
+            ai.plan_time = atol(argv[i]);
+        else
+        if (memcmp(argv[i], "--opponent-moves=", 17) == 0)
+            opponent_moves = atoi(argv[i] + 17);
+        else
+        if (strcmp(argv[i], "--opponent-moves") == 0 && ++i < argc)
+            opponent_moves = atoi(argv[i]);
+        else
+        if (memcmp(argv[i], "--pursuit-time=", 15) == 0)
+            pursuit_time = atol(argv[i] + 15);
+        else
+        if (strcmp(argv[i], "--pursuit-time") == 0 && ++i < argc)
+            pursuit_time = atol(argv[i]);
+        else
+        if (memcmp(argv[i], "--book=", 7) == 0)
+            open_book(argv[i] + 7);
+        else
+        if (strcmp(argv[i], "--book") == 0 && ++i < argc)
+            open_book(argv[i]);
+        else
+        {
+            fprintf(stderr, "usage: player [--plan-time=<ms>] "
+                            "[--opponent-moves=<n>] "
+                            "[--pursuit-time=<ms>] [--book=<file>]\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+}
+
+int main(int argc, char *argv[])
 {
     int turn;
 
+    parse_options(argc, argv);
+    ai.md = &md;
+    bt_reset(&ai.belief, opponent_moves);
+    if (pursuit_time > 0)
+    {
+        ps_reset(&pursuit, pursuit_time);
+        ai.pursuit = &pursuit;
+    }
     mm_initialize(&mm, 0, 0, NORTH);
+    mm_set_journal(&mm, &journal);
 
     if (strcmp(get_line(false), "Start") == 0)
     {
@@ -74,9 +138,15 @@ int main()
 
     for (turn = 0; ; ++turn)
     {
+        const char *move;
+
         read_input();
-        mm_infer(&mm);
-        write_output(pick_move(&mm, distsq));
+        mi_infer(&mi, &mm);
+        move = pick_move_r(&mm, distsq, &ai);
+
+        /* Changes have been processed by both mi_infer() and pick_move_r() */
+        mm_journal_reset(&journal);
+        write_output(move);
     }
     return 0;
 }
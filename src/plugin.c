@@ -0,0 +1,71 @@
+#include "PlayerPlugin.h"
+#include "AI.h"
+#include "MazeInfer.h"
+#include <stdlib.h>
+
+/* Exposes the AI in AI.c through the in-process player interface; this
+   behaves exactly like the player program built from player.c. */
+
+typedef struct PluginPlayer
+{
+    MazeMap         mm;
+    MazeJournal     journal;
+    MazeInference   mi;
+    MazeDistance    md;
+    AIContext       ai;
+    int             distsq;
+} PluginPlayer;
+
+static void *plugin_init(int first)
+{
+    PluginPlayer *pl = calloc(1, sizeof(PluginPlayer));  /* all zero */
+    (void)first;  /* unused */
+    if (pl != NULL)
+    {
+        mm_initialize(&pl->mm, 0, 0, NORTH);
+        mm_set_journal(&pl->mm, &pl->journal);
+        mi_reset(&pl->mi);
+        md_reset(&pl->md);
+        pl->ai.md = &pl->md;
+        pl->ai.plan_time = 0;
+        pl->ai.pursuit = NULL;
+        pl->ai.cache = NULL;
+        pl->ai.book = NULL;
+        bt_reset(&pl->ai.belief, BT_MAX_MOVES);
+    }
+    return pl;
+}
+
+static void plugin_observe(void *player, const char *const sight[4],
+                           int distsq)
+{
+    PluginPlayer *pl = player;
+    mm_look(&pl->mm, sight[0], FRONT);
+    mm_look(&pl->mm, sight[1], RIGHT);
+    mm_look(&pl->mm, sight[2], BACK);
+    mm_look(&pl->mm, sight[3], LEFT);
+    pl->distsq = distsq;
+    mi_infer(&pl->mi, &pl->mm);
+}
+
+static const char *plugin_move(void *player)
+{
+    PluginPlayer *pl = player;
+    const char *move = pick_move_r(&pl->mm, pl->distsq, &pl->ai);
+    mm_journal_reset(&pl->journal);
+    mm_turn(&pl->mm, move);
+    return move;
+}
+
+static void plugin_quit(void *player)
+{
+    free(player);
+}
+
+const PlayerPlugin *player_plugin(void)
+{
+    static const PlayerPlugin plugin = {
+        PLAYER_PLUGIN_ABI_VERSION,
+        plugin_init, plugin_observe, plugin_move, plugin_quit };
+    return &plugin;
+}
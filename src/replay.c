@@ -0,0 +1,81 @@
+#include "Replay.h"
+#include "MazeIO.h"
+#include <stdlib.h>
+#include <string.h>
+
+static ReplayLog log;
+static MazeMap mm;
+
+static void list_records()
+{
+    ReplayRecord rec;
+    int n;
+
+    printf("#Turn Player Moves Disc. First Capt. Total Turn\n");
+    printf("------------------------------------------------\n");
+    for (n = 0; n < log.count; ++n)
+    {
+        replay_record(&log, n, &rec);
+        printf(" %5d %5d %5d %5d %5d %5d %5d %.*s\n",
+               rec.turn_no + 1, rec.player + 1, rec.score.moves,
+               rec.score.sq_disc, rec.score.sq_disc_first,
+               rec.score.captures, rec.score.total,
+               rec.turn_len, rec.turn);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    bool encode = false;
+    ReplayRecord rec;
+    int turn_no, player = 1, n;
+
+    if (argc > 1 && strcmp(argv[1], "--encode") == 0)
+    {
+        encode = true;
+        --argc, ++argv;
+    }
+    if (argc < 2 || argc > 4)
+    {
+        printf("usage:\n"
+               "\treplay <log file>\n"
+               "\treplay [--encode] <log file> <turn> [<player>]\n");
+        return 1;
+    }
+    if (!replay_open(&log, argv[1]))
+    {
+        printf("Couldn't open replay log `%s'!\n", argv[1]);
+        return 1;
+    }
+
+    if (argc == 2)
+    {
+        list_records();
+    }
+    else
+    {
+        turn_no = atoi(argv[2]);
+        if (argc > 3) player = atoi(argv[3]);
+        if ((n = replay_find(&log, player - 1, turn_no - 1)) == -1)
+        {
+            printf("No record for turn %d of player %d!\n", turn_no, player);
+            return 1;
+        }
+        replay_record(&log, n, &rec);
+        replay_state(&log, n, &mm);
+        if (encode)
+        {
+            puts(mm_encode(&mm, true));
+        }
+        else
+        {
+            printf("Turn %d, player %d: %.*s (total score: %d)\n",
+                   turn_no, player, rec.turn_len, rec.turn, rec.score.total);
+            mm_print(&mm, stdout, false);
+            if (rec.comments_len > 0)
+                printf("%.*s\n", rec.comments_len, rec.comments);
+        }
+    }
+    replay_close(&log);
+    return 0;
+}
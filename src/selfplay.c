@@ -0,0 +1,212 @@
+#include "AI.h"
+#include "GameEngine.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Measures self-play throughput: plays games between copies of the built-in
+   AI (pick_move_r(), as used by the player program) on the game engine,
+   without any processes or pipes, and reports the number of games played per
+   second along with the average scores.
+
+   Games are distributed round-robin over the given mazes. With the same
+   --seed, the first game on the first maze is identical to the game played by
+   the arbiter with the same maze and player.so as both players.
+
+   With --cache, all players share a MazeCache for inference and exploration,
+   and its hit rates are reported. With --check-cache, every game is also
+   replayed without the cache from the same starting poses, and the program
+   fails if any turn, score or winner differs. With --book, all players play
+   the turns found in the given opening book (see mkbook.c). */
+
+/* A player: its own view of the maze, as in plugin.c. */
+typedef struct SelfPlayer
+{
+    MazeMap         mm;
+    MazeJournal     journal;
+    MazeInference   mi;
+    MazeDistance    md;
+    AIContext       ai;
+    Pursuit         pursuit;
+} SelfPlayer;
+
+static Game game[16];
+static SelfPlayer player[2];
+static long plan_time;
+static int opponent_moves = BT_MAX_MOVES;
+static long pursuit_time;
+static MazeCache cache;
+static OpeningBook book;
+static bool use_cache;
+static StartPose poses[2];          /* of the last game played */
+static unsigned long transcript;    /* checksum of the turns played */
+
+/* Plays a single game, from the starting poses in `poses' if `replay' is set
+   (or from random ones, which are then stored in `poses'), using the cache if
+   `cached' is set. Returns the number of turns played. */
+static int play(Game *g, int num_players, bool replay, bool cached)
+{
+    const char *lines[4];
+    const char *turn, *q;
+    SelfPlayer *pl;
+    int p;
+
+    ge_init(g, num_players, poses, replay ? num_players : 0);
+    for (p = 0; p < num_players; ++p)
+    {
+        poses[p].r   = g->mm_player[p].loc.r;
+        poses[p].c   = g->mm_player[p].loc.c;
+        poses[p].dir = g->mm_player[p].dir;
+        mm_initialize(&player[p].mm, 0, 0, NORTH);
+        mm_set_journal(&player[p].mm, &player[p].journal);
+        mi_reset(&player[p].mi);
+        md_reset(&player[p].md);
+        player[p].ai.md = &player[p].md;
+        player[p].ai.plan_time = plan_time;
+        bt_reset(&player[p].ai.belief, opponent_moves);
+        ps_reset(&player[p].pursuit, pursuit_time);
+        player[p].ai.pursuit = (pursuit_time > 0) ? &player[p].pursuit : NULL;
+        player[p].ai.cache = cached ? &cache : NULL;
+        player[p].ai.book = (book.data != NULL) ? &book : NULL;
+    }
+    transcript = 0;
+    while (!g->over)
+    {
+        p  = ge_player(g);
+        pl = &player[p];
+        ge_observe(g, p, lines);
+        mm_look(&pl->mm, lines[0], FRONT);
+        mm_look(&pl->mm, lines[1], RIGHT);
+        mm_look(&pl->mm, lines[2], BACK);
+        mm_look(&pl->mm, lines[3], LEFT);
+        if (cached)
+            mc_infer(&cache, &pl->mi, &pl->mm);
+        else
+            mi_infer(&pl->mi, &pl->mm);
+        turn = pick_move_r(&pl->mm, ge_player_dist(g), &pl->ai);
+        for (q = turn; *q != '\0'; ++q) transcript = 31*transcript + *q;
+        transcript = 31*transcript + '\n';
+        mm_journal_reset(&pl->journal);
+        mm_turn(&pl->mm, turn);
+        if (!ge_step(g, turn)) break;
+    }
+    return g->turn_no;
+}
+
+static void usage()
+{
+    printf("usage: selfplay [--games=<count>] [--players=<1|2>] "
+           "[--seed=<seed>]\n"
+           "                [--plan-time=<ms>] [--opponent-moves=<n>] "
+           "[--pursuit-time=<ms>]\n"
+           "                [--cache] [--check-cache] [--book=<file>] "
+           "<maze file>...\n");
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char *argv[])
+{
+    int i, n, p, num_mazes = 0, games = 1000, players = 2, turns = 0;
+    int mismatches = 0, score[2], winner;
+    long total[2] = { 0, 0 }, wins[2] = { 0, 0 };
+    unsigned long cached_transcript;
+    bool check_cache = false;
+    clock_t start;
+    double secs;
+
+    for (i = 1; i < argc; ++i)
+    {
+        if (memcmp(argv[i], "--games=", 8) == 0)
+            games = atoi(argv[i] + 8);
+        else
+        if (memcmp(argv[i], "--players=", 10) == 0)
+            players = atoi(argv[i] + 10);
+        else
+        if (memcmp(argv[i], "--seed=", 7) == 0)
+            srand(atoi(argv[i] + 7));
+        else
+        if (memcmp(argv[i], "--plan-time=", 12) == 0)
+            plan_time = atol(argv[i] + 12);
+        else
+        if (memcmp(argv[i], "--opponent-moves=", 17) == 0)
+            opponent_moves = atoi(argv[i] + 17);
+        else
+        if (memcmp(argv[i], "--pursuit-time=", 15) == 0)
+            pursuit_time = atol(argv[i] + 15);
+        else
+        if (strcmp(argv[i], "--cache") == 0)
+            use_cache = true;
+        else
+        if (strcmp(argv[i], "--check-cache") == 0)
+            use_cache = check_cache = true;
+        else
+        if (memcmp(argv[i], "--book=", 7) == 0)
+        {
+            if (!book_open(&book, argv[i] + 7))
+            {
+                printf("Couldn't open opening book `%s'!\n", argv[i] + 7);
+                exit(EXIT_FAILURE);
+            }
+        }
+        else
+        if (num_mazes == (int)(sizeof(game)/sizeof(*game)))
+        {
+            printf("Too many mazes!\n");
+            exit(EXIT_FAILURE);
+        }
+        else
+        if (!ge_load_maze(&game[num_mazes++], argv[i]))
+        {
+            printf("Couldn't load maze from `%s'!\n", argv[i]);
+            exit(EXIT_FAILURE);
+        }
+    }
+    if (num_mazes == 0 || games <= 0 || players < 1 || players > 2) usage();
+
+    mc_reset(&cache);
+    start = clock();
+    for (n = 0; n < games; ++n)
+    {
+        Game *g = &game[n%num_mazes];
+        turns += play(g, players, false, use_cache);
+        for (p = 0; p < players; ++p)
+            total[p] += score[p] = ge_final_score(g, p);
+        if (g->winner != -1) ++wins[g->winner];
+        if (check_cache)
+        {
+            cached_transcript = transcript;
+            winner = g->winner;
+            play(g, players, true, false);
+            for (p = 0; p < players; ++p)
+                if (ge_final_score(g, p) != score[p]) break;
+            if (p < players || g->winner != winner ||
+                transcript != cached_transcript)
+            {
+                printf("Game %d differs without the cache!\n", n + 1);
+                ++mismatches;
+            }
+        }
+    }
+    secs = (double)(clock() - start)/CLOCKS_PER_SEC;
+
+    printf("%d games (%d turns) in %.3f s: %.1f games/s, %.0f turns/s\n",
+           games, turns, secs, games/secs, turns/secs);
+    for (p = 0; p < players; ++p)
+    {
+        printf("Player %d: average score %.1f, %ld wins\n",
+               p + 1, (double)total[p]/games, wins[p]);
+    }
+    if (use_cache)
+    {
+        printf("Cache: %ld/%ld inference hits, %ld/%ld move hits\n",
+               cache.infer_hits, cache.infer_hits + cache.infer_misses,
+               cache.move_hits, cache.move_hits + cache.move_misses);
+    }
+    if (check_cache)
+    {
+        printf("%d of %d games differ without the cache\n", mismatches, games);
+        if (mismatches > 0) exit(EXIT_FAILURE);
+    }
+    return 0;
+}
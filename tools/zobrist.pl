@@ -0,0 +1,28 @@
+#!/usr/bin/perl
+use strict;
+
+# Generates src/MazeKeys.c: the Zobrist keys of all map features hashed by
+# MazeMap.c, for maps of 25 by 25 squares. Each key is stored as its high
+# and low 32 bits, which are mix32(2*feature) and mix32(2*feature + 1).
+
+my ($height, $width) = (25, 25);
+my $features = 3*$height*$width*2 + $height*$width + 4 + 4*$height;
+
+sub mix32
+{
+    my ($x) = @_;
+    $x = ((($x >> 16) ^ $x)*0x45d9f3b) & 0xffffffff;
+    $x = ((($x >> 16) ^ $x)*0x45d9f3b) & 0xffffffff;
+    return ($x >> 16) ^ $x;
+}
+
+print "#include \"MazeKeys.h\"\n\n";
+print "/* Generated by tools/zobrist.pl; do not edit. */\n\n";
+print "const unsigned long mm_zobrist_keys[MM_NUM_KEYS][2] = {\n";
+for (my $f = 0; $f < $features; $f += 2)
+{
+    my @keys = map { sprintf "{ 0x%08x, 0x%08x }",
+                             mix32(2*$_), mix32(2*$_ + 1) }
+               grep { $_ < $features } ($f, $f + 1);
+    print "    ", join(", ", @keys), ($f + 2 < $features) ? ",\n" : " };\n";
+}